@@ -113,9 +113,7 @@ struct layer_data {
     void Cleanup();
 };
 
-static std::unordered_map<void *, layer_data *> layer_data_map;
-
-template layer_data *GetLayerDataPtr<layer_data>(void *data_key, std::unordered_map<void *, layer_data *> &data_map);
+static LayerDataRegistry<layer_data> layer_data_map;
 
 // static LOADER_PLATFORM_THREAD_ONCE_DECLARATION(g_initOnce);
 // TODO : This can be much smarter, using separate locks for separate global
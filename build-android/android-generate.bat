@@ -26,6 +26,7 @@ py -3 ../../../scripts/lvl_genvk.py -registry ../../../scripts/vk.xml vk_struct_
 py -3 ../../../scripts/lvl_genvk.py -registry ../../../scripts/vk.xml vk_struct_size_helper.c
 py -3 ../../../scripts/lvl_genvk.py -registry ../../../scripts/vk.xml vk_enum_string_helper.h
 py -3 ../../../scripts/lvl_genvk.py -registry ../../../scripts/vk.xml vk_object_types.h
+py -3 ../../../scripts/lvl_genvk.py -registry ../../../scripts/vk.xml vk_command_ids.h
 py -3 ../../../scripts/lvl_genvk.py -registry ../../../scripts/vk.xml vk_dispatch_table_helper.h
 py -3 ../../../scripts/lvl_genvk.py -registry ../../../scripts/vk.xml thread_check.h
 py -3 ../../../scripts/lvl_genvk.py -registry ../../../scripts/vk.xml parameter_validation.h
@@ -37,9 +38,11 @@ copy /Y ..\layers\vk_layer_config.cpp   generated\common\
 copy /Y ..\layers\vk_layer_extension_utils.cpp  generated\common\
 copy /Y ..\layers\vk_layer_utils.cpp    generated\common\
 copy /Y ..\layers\vk_format_utils.cpp   generated\common\
+copy /Y ..\layers\vk_layer_binary_log.cpp generated\common\
 copy /Y ..\layers\vk_layer_table.cpp    generated\common\
 copy /Y ..\layers\descriptor_sets.cpp   generated\common\
 copy /Y ..\layers\buffer_validation.cpp generated\common\
+copy /Y ..\layers\mapped_memory_guard.cpp generated\common\
 
 REM create build-script root directory
 mkdir generated\gradle-build
@@ -57,6 +60,7 @@ for %%G in (core_validation object_tracker parameter_validation swapchain thread
 )
 copy generated\common\descriptor_sets.cpp generated\layer-src\core_validation\descriptor_sets.cpp
 copy generated\common\buffer_validation.cpp generated\layer-src\core_validation\buffer_validation.cpp
+copy generated\common\mapped_memory_guard.cpp generated\layer-src\core_validation\mapped_memory_guard.cpp
 copy generated\include\vk_safe_struct.cpp generated\layer-src\core_validation\vk_safe_struct.cpp
 move generated\include\vk_safe_struct.cpp generated\layer-src\unique_objects\vk_safe_struct.cpp
 echo apply from: "../common.gradle"  > generated\gradle-build\unique_objects\build.gradle
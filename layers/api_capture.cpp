@@ -0,0 +1,511 @@
+/* Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// VK_LAYER_LUNARG_api_capture records every call the application makes to a file, for vk_api_replay to play back
+// through other layers. It validates nothing; enable it first so that it sees the calls exactly as the application made
+// them. See vk_api_capture.h for the file format.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "vk_loader_platform.h"
+#include "vulkan/vk_layer.h"
+#include "vk_layer_config.h"
+#include "vk_layer_extension_utils.h"
+#include "vk_layer_utils.h"
+#include "vk_layer_table.h"
+#include "vk_layer_logging.h"
+#include "vk_dispatch_table_helper.h"
+#include "vk_layer_data.h"
+#include "vk_api_capture.h"
+#include "vk_command_ids.h"
+
+namespace api_capture {
+
+enum API_CAPTURE_ERROR {
+    API_CAPTURE_NONE,           // Used for INFO & other non-error messages
+    API_CAPTURE_NOT_CAPTURED,   // Command can not be represented in the capture file
+    API_CAPTURE_FILE_ERROR,     // Capture file could not be written
+};
+
+struct layer_data {
+    VkInstance instance = VK_NULL_HANDLE;
+    debug_report_data *report_data = nullptr;
+    std::vector<VkDebugReportCallbackEXT> logging_callback;
+    VkLayerDispatchTable *device_dispatch_table = nullptr;
+    VkLayerInstanceDispatchTable *instance_dispatch_table = nullptr;
+};
+
+static LayerDataRegistry<layer_data> layer_data_map;
+static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
+
+// Appends finished records to the capture file. Records are encoded by the calling thread and copied in under
+// capture_lock, so the file holds them in the order the calls returned. The file is flushed at every present, so a capture of an
+// application that exits without destroying its instance loses at most a frame.
+class CaptureWriter {
+   public:
+    static const size_t kFlushSize = 1024 * 1024;
+
+    explicit CaptureWriter(FILE *output) : output_(output) {
+        ApiCaptureFileHeader header;
+        memcpy(header.magic, kApiCaptureMagic, sizeof(header.magic));
+        header.version = kApiCaptureVersion;
+        header.header_version = VK_HEADER_VERSION;
+        header.command_count = kVkCommandIdCount;
+        buffer_.reserve(2 * kFlushSize);
+        Append(&header, sizeof(header));
+    }
+
+    ~CaptureWriter() {
+        Flush();
+        fclose(output_);
+    }
+
+    void Write(const ApiCaptureEncoder &record) {
+        Append(record.data(), record.size());
+        if (record.command_id() == kVkCommandQueuePresentKHR || buffer_.size() >= kFlushSize) Flush();
+    }
+
+   private:
+    void Append(const void *data, size_t size) {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+
+    void Flush() {
+        if (!buffer_.empty()) {
+            fwrite(buffer_.data(), 1, buffer_.size(), output_);
+            buffer_.clear();
+        }
+        fflush(output_);
+    }
+
+    FILE *output_;
+    std::vector<uint8_t> buffer_;
+};
+
+// Shared by all instances; opened by the first vkCreateInstance and closed with the last vkDestroyInstance. capture_lock
+// guards capture_writer and serializes writes to it, so a call that ends while the last instance is destroyed either
+// finishes its record first or finds the writer gone.
+static std::mutex capture_lock;
+static CaptureWriter *capture_writer = nullptr;
+static uint32_t capture_instance_count = 0;
+
+static ApiCaptureEncoder *BeginCapture(VkCommandId command_id) {
+    static thread_local ApiCaptureEncoder encoder;
+    encoder.Begin(command_id);
+    return &encoder;
+}
+
+static void EndCapture(ApiCaptureEncoder *encoder) {
+    encoder->End();
+    std::lock_guard<std::mutex> lock(capture_lock);
+    if (capture_writer) capture_writer->Write(*encoder);
+}
+
+// Reports each command that can not be captured once; the call itself still goes through
+static void WarnNotCaptured(layer_data *my_data, VkCommandId command_id) {
+    static std::atomic<bool> warned[kVkCommandIdCount];
+    if (warned[command_id].exchange(true)) return;
+    log_msg(my_data->report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+            API_CAPTURE_NOT_CAPTURED, "APICapture",
+            "%s can not be captured; it is passed to the next layer, but will be missing from the replay.",
+            vk_command_names[command_id]);
+}
+
+// The state pointers vkCreateGraphicsPipelines ignores when rasterization is disabled
+static bool RasterizerDiscardEnabled(const VkGraphicsPipelineCreateInfo *value) {
+    return value->pRasterizationState && value->pRasterizationState->rasterizerDiscardEnable;
+}
+
+}  // namespace api_capture
+
+#include "api_capture_wrappers.h"
+
+namespace api_capture {
+
+static void OpenCaptureFile(layer_data *my_data) {
+    std::lock_guard<std::mutex> lock(capture_lock);
+    if (capture_instance_count++ > 0) return;
+    std::string filename = getLayerOption("lunarg_api_capture.capture_file");
+    if (filename.empty()) filename = "lunarg_api_capture.vkac";
+    FILE *output = fopen(filename.c_str(), "wb");
+    if (output) {
+        capture_writer = new CaptureWriter(output);
+    } else {
+        log_msg(my_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_INSTANCE_EXT,
+                reinterpret_cast<uint64_t>(my_data->instance), __LINE__, API_CAPTURE_FILE_ERROR, "APICapture",
+                "Could not open capture file %s; calls will not be captured.", filename.c_str());
+    }
+}
+
+static void CloseCaptureFile() {
+    std::lock_guard<std::mutex> lock(capture_lock);
+    if (--capture_instance_count > 0) return;
+    delete capture_writer;
+    capture_writer = nullptr;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo *pCreateInfo, const VkAllocationCallbacks *pAllocator,
+                                              VkInstance *pInstance) {
+    VkLayerInstanceCreateInfo *chain_info = get_chain_info(pCreateInfo, VK_LAYER_LINK_INFO);
+
+    assert(chain_info->u.pLayerInfo);
+    PFN_vkGetInstanceProcAddr fpGetInstanceProcAddr = chain_info->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+    PFN_vkCreateInstance fpCreateInstance = (PFN_vkCreateInstance)fpGetInstanceProcAddr(NULL, "vkCreateInstance");
+    if (fpCreateInstance == NULL) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    // Advance the link info for the next element on the chain
+    chain_info->u.pLayerInfo = chain_info->u.pLayerInfo->pNext;
+
+    // The encoding skips the loader's chain info, which the replayer's loader provides again
+    ApiCaptureEncoder *encoder = BeginCapture(kVkCommandCreateInstance);
+    if (encoder->Pointer(pCreateInfo, 1)) EncodeVkInstanceCreateInfo(encoder, pCreateInfo);
+    encoder->Pointer(pInstance, 1);
+
+    VkResult result = fpCreateInstance(pCreateInfo, pAllocator, pInstance);
+    if (result == VK_SUCCESS) {
+        layer_data *my_data = GetLayerDataPtr(get_dispatch_key(*pInstance), layer_data_map);
+        my_data->instance = *pInstance;
+        my_data->instance_dispatch_table = new VkLayerInstanceDispatchTable;
+        layer_init_instance_dispatch_table(*pInstance, my_data->instance_dispatch_table, fpGetInstanceProcAddr);
+
+        my_data->report_data = debug_report_create_instance(my_data->instance_dispatch_table, *pInstance,
+                                                            pCreateInfo->enabledExtensionCount,
+                                                            pCreateInfo->ppEnabledExtensionNames);
+        layer_debug_actions(my_data->report_data, my_data->logging_callback, pAllocator, "lunarg_api_capture");
+        OpenCaptureFile(my_data);
+    }
+
+    encoder->Value(result);
+    encoder->Handles(result == VK_SUCCESS ? pInstance : nullptr, 1);
+    EndCapture(encoder);
+    return result;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyInstance(VkInstance instance, const VkAllocationCallbacks *pAllocator) {
+    dispatch_key key = get_dispatch_key(instance);
+    layer_data *my_data = GetLayerDataPtr(key, layer_data_map);
+
+    ApiCaptureEncoder *encoder = BeginCapture(kVkCommandDestroyInstance);
+    encoder->Handle(instance);
+    my_data->instance_dispatch_table->DestroyInstance(instance, pAllocator);
+    EndCapture(encoder);
+    CloseCaptureFile();
+
+    // Clean up logging callback, if any
+    while (my_data->logging_callback.size() > 0) {
+        VkDebugReportCallbackEXT callback = my_data->logging_callback.back();
+        layer_destroy_msg_callback(my_data->report_data, callback, pAllocator);
+        my_data->logging_callback.pop_back();
+    }
+
+    layer_debug_report_destroy_instance(my_data->report_data);
+    delete my_data->instance_dispatch_table;
+    delete my_data;
+    layer_data_map.erase(key);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(VkPhysicalDevice gpu, const VkDeviceCreateInfo *pCreateInfo,
+                                            const VkAllocationCallbacks *pAllocator, VkDevice *pDevice) {
+    layer_data *my_instance_data = GetLayerDataPtr(get_dispatch_key(gpu), layer_data_map);
+    VkLayerDeviceCreateInfo *chain_info = get_chain_info(pCreateInfo, VK_LAYER_LINK_INFO);
+
+    assert(chain_info->u.pLayerInfo);
+    PFN_vkGetInstanceProcAddr fpGetInstanceProcAddr = chain_info->u.pLayerInfo->pfnNextGetInstanceProcAddr;
+    PFN_vkGetDeviceProcAddr fpGetDeviceProcAddr = chain_info->u.pLayerInfo->pfnNextGetDeviceProcAddr;
+    PFN_vkCreateDevice fpCreateDevice = (PFN_vkCreateDevice)fpGetInstanceProcAddr(my_instance_data->instance, "vkCreateDevice");
+    if (fpCreateDevice == NULL) {
+        return VK_ERROR_INITIALIZATION_FAILED;
+    }
+
+    // Advance the link info for the next element on the chain
+    chain_info->u.pLayerInfo = chain_info->u.pLayerInfo->pNext;
+
+    ApiCaptureEncoder *encoder = BeginCapture(kVkCommandCreateDevice);
+    encoder->Handle(gpu);
+    if (encoder->Pointer(pCreateInfo, 1)) EncodeVkDeviceCreateInfo(encoder, pCreateInfo);
+    encoder->Pointer(pDevice, 1);
+
+    VkResult result = fpCreateDevice(gpu, pCreateInfo, pAllocator, pDevice);
+    if (result == VK_SUCCESS) {
+        layer_data *my_device_data = GetLayerDataPtr(get_dispatch_key(*pDevice), layer_data_map);
+        my_device_data->device_dispatch_table = new VkLayerDispatchTable;
+        layer_init_device_dispatch_table(*pDevice, my_device_data->device_dispatch_table, fpGetDeviceProcAddr);
+        my_device_data->report_data = layer_debug_report_create_device(my_instance_data->report_data, *pDevice);
+    }
+
+    encoder->Value(result);
+    encoder->Handles(result == VK_SUCCESS ? pDevice : nullptr, 1);
+    EndCapture(encoder);
+    return result;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCallbacks *pAllocator) {
+    dispatch_key key = get_dispatch_key(device);
+    layer_data *dev_data = GetLayerDataPtr(key, layer_data_map);
+
+    ApiCaptureEncoder *encoder = BeginCapture(kVkCommandDestroyDevice);
+    encoder->Handle(device);
+    encoder->Pointer(pAllocator, 0);
+    dev_data->device_dispatch_table->DestroyDevice(device, pAllocator);
+    EndCapture(encoder);
+
+    layer_debug_report_destroy_device(device);
+    delete dev_data->device_dispatch_table;
+    delete dev_data;
+    layer_data_map.erase(key);
+}
+
+static const VkExtensionProperties api_capture_extensions[] = {
+    {VK_EXT_DEBUG_REPORT_EXTENSION_NAME, VK_EXT_DEBUG_REPORT_SPEC_VERSION}};
+
+static const VkLayerProperties layerProps = {
+    "VK_LAYER_LUNARG_api_capture",
+    VK_LAYER_API_VERSION,  // specVersion
+    1, "LunarG API capture layer",
+};
+
+static inline PFN_vkVoidFunction layer_intercept_proc(const char *name) {
+    static const auto procmap_table = MakeVkCommandTable(procmap);
+    auto entry = procmap_table.Find(name);
+    if (entry) return entry->pFunc;
+    return NULL;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceLayerProperties(uint32_t *pCount, VkLayerProperties *pProperties) {
+    return util_GetLayerProperties(1, &layerProps, pCount, pProperties);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t *pCount,
+                                                              VkLayerProperties *pProperties) {
+    return util_GetLayerProperties(1, &layerProps, pCount, pProperties);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pCount,
+                                                                    VkExtensionProperties *pProperties) {
+    if (pLayerName && !strcmp(pLayerName, layerProps.layerName))
+        return util_GetExtensionProperties(1, api_capture_extensions, pCount, pProperties);
+
+    return VK_ERROR_LAYER_NOT_PRESENT;
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, const char *pLayerName,
+                                                                  uint32_t *pCount, VkExtensionProperties *pProperties) {
+    // API capture layer does not have any device extensions
+    if (pLayerName && !strcmp(pLayerName, layerProps.layerName))
+        return util_GetExtensionProperties(0, nullptr, pCount, pProperties);
+
+    assert(physicalDevice);
+
+    dispatch_key key = get_dispatch_key(physicalDevice);
+    layer_data *my_data = GetLayerDataPtr(key, layer_data_map);
+    return my_data->instance_dispatch_table->EnumerateDeviceExtensionProperties(physicalDevice, NULL, pCount, pProperties);
+}
+
+// Need to prototype this call because it's internal and does not show up in vk.xml
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char *funcName);
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *funcName);
+
+static inline PFN_vkVoidFunction layer_intercept_instance_proc(const char *name) {
+    static const struct {
+        const char *name;
+        PFN_vkVoidFunction pFunc;
+    } instance_procmap[] = {
+        {"vkEnumerateInstanceLayerProperties", (PFN_vkVoidFunction)EnumerateInstanceLayerProperties},
+        {"vkEnumerateInstanceExtensionProperties", (PFN_vkVoidFunction)EnumerateInstanceExtensionProperties},
+        {"vkEnumerateDeviceLayerProperties", (PFN_vkVoidFunction)EnumerateDeviceLayerProperties},
+        {"vkEnumerateDeviceExtensionProperties", (PFN_vkVoidFunction)EnumerateDeviceExtensionProperties},
+        {"vkGetInstanceProcAddr", (PFN_vkVoidFunction)GetInstanceProcAddr},
+        {"vk_layerGetPhysicalDeviceProcAddr", (PFN_vkVoidFunction)GetPhysicalDeviceProcAddr},
+    };
+    static const auto instance_procmap_table = MakeVkCommandTable(instance_procmap);
+
+    auto entry = instance_procmap_table.Find(name);
+    return entry ? entry->pFunc : NULL;
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *funcName) {
+    PFN_vkVoidFunction addr;
+    layer_data *dev_data;
+
+    assert(device);
+
+    addr = layer_intercept_proc(funcName);
+    if (addr) return addr;
+
+    dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    VkLayerDispatchTable *pTable = dev_data->device_dispatch_table;
+
+    if (pTable->GetDeviceProcAddr == NULL) return NULL;
+    return pTable->GetDeviceProcAddr(device, funcName);
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetInstanceProcAddr(VkInstance instance, const char *funcName) {
+    PFN_vkVoidFunction addr;
+    layer_data *my_data;
+
+    addr = layer_intercept_instance_proc(funcName);
+    if (!addr) addr = layer_intercept_proc(funcName);
+    if (addr) {
+        return addr;
+    }
+
+    assert(instance);
+
+    my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
+    addr = debug_report_get_instance_proc_addr(my_data->report_data, funcName);
+    if (addr) {
+        return addr;
+    }
+
+    VkLayerInstanceDispatchTable *pTable = my_data->instance_dispatch_table;
+    if (pTable->GetInstanceProcAddr == NULL) {
+        return NULL;
+    }
+    return pTable->GetInstanceProcAddr(instance, funcName);
+}
+
+VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char *funcName) {
+    assert(instance);
+
+    layer_data *my_data;
+    my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
+    VkLayerInstanceDispatchTable *pTable = my_data->instance_dispatch_table;
+
+    if (pTable->GetPhysicalDeviceProcAddr == NULL) return NULL;
+    return pTable->GetPhysicalDeviceProcAddr(instance, funcName);
+}
+
+VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(VkInstance instance,
+                                                            const VkDebugReportCallbackCreateInfoEXT *pCreateInfo,
+                                                            const VkAllocationCallbacks *pAllocator,
+                                                            VkDebugReportCallbackEXT *pMsgCallback) {
+    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
+    VkResult result =
+        my_data->instance_dispatch_table->CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pMsgCallback);
+    if (VK_SUCCESS == result) {
+        result = layer_create_msg_callback(my_data->report_data, false, pCreateInfo, pAllocator, pMsgCallback);
+    }
+    return result;
+}
+
+VKAPI_ATTR void VKAPI_CALL DestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback,
+                                                         const VkAllocationCallbacks *pAllocator) {
+    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
+    my_data->instance_dispatch_table->DestroyDebugReportCallbackEXT(instance, callback, pAllocator);
+    layer_destroy_msg_callback(my_data->report_data, callback, pAllocator);
+}
+
+VKAPI_ATTR void VKAPI_CALL DebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags,
+                                                 VkDebugReportObjectTypeEXT objType, uint64_t object, size_t location,
+                                                 int32_t msgCode, const char *pLayerPrefix, const char *pMsg) {
+    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(instance), layer_data_map);
+    my_data->instance_dispatch_table->DebugReportMessageEXT(instance, flags, objType, object, location, msgCode, pLayerPrefix,
+                                                            pMsg);
+}
+
+}  // namespace api_capture
+
+// vk_layer_logging.h expects these to be defined
+
+VKAPI_ATTR VkResult VKAPI_CALL vkCreateDebugReportCallbackEXT(VkInstance instance,
+                                                              const VkDebugReportCallbackCreateInfoEXT *pCreateInfo,
+                                                              const VkAllocationCallbacks *pAllocator,
+                                                              VkDebugReportCallbackEXT *pMsgCallback) {
+    return api_capture::CreateDebugReportCallbackEXT(instance, pCreateInfo, pAllocator, pMsgCallback);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT msgCallback,
+                                                           const VkAllocationCallbacks *pAllocator) {
+    api_capture::DestroyDebugReportCallbackEXT(instance, msgCallback, pAllocator);
+}
+
+VKAPI_ATTR void VKAPI_CALL vkDebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags,
+                                                   VkDebugReportObjectTypeEXT objType, uint64_t object, size_t location,
+                                                   int32_t msgCode, const char *pLayerPrefix, const char *pMsg) {
+    api_capture::DebugReportMessageEXT(instance, flags, objType, object, location, msgCode, pLayerPrefix, pMsg);
+}
+
+// loader-layer interface v0, just wrappers since there is only a layer
+
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceExtensionProperties(const char *pLayerName, uint32_t *pCount,
+                                                                                      VkExtensionProperties *pProperties) {
+    return api_capture::EnumerateInstanceExtensionProperties(pLayerName, pCount, pProperties);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateInstanceLayerProperties(uint32_t *pCount,
+                                                                                  VkLayerProperties *pProperties) {
+    return api_capture::EnumerateInstanceLayerProperties(pCount, pProperties);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t *pCount,
+                                                                                VkLayerProperties *pProperties) {
+    // the layer command handles VK_NULL_HANDLE just fine internally
+    assert(physicalDevice == VK_NULL_HANDLE);
+    return api_capture::EnumerateDeviceLayerProperties(VK_NULL_HANDLE, pCount, pProperties);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice,
+                                                                                    const char *pLayerName, uint32_t *pCount,
+                                                                                    VkExtensionProperties *pProperties) {
+    // the layer command handles VK_NULL_HANDLE just fine internally
+    assert(physicalDevice == VK_NULL_HANDLE);
+    return api_capture::EnumerateDeviceExtensionProperties(VK_NULL_HANDLE, pLayerName, pCount, pProperties);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice dev, const char *funcName) {
+    return api_capture::GetDeviceProcAddr(dev, funcName);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char *funcName) {
+    return api_capture::GetInstanceProcAddr(instance, funcName);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_layerGetPhysicalDeviceProcAddr(VkInstance instance,
+                                                                                           const char *funcName) {
+    return api_capture::GetPhysicalDeviceProcAddr(instance, funcName);
+}
+
+VK_LAYER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkNegotiateLoaderLayerInterfaceVersion(VkNegotiateLayerInterface *pVersionStruct) {
+    assert(pVersionStruct != NULL);
+    assert(pVersionStruct->sType == LAYER_NEGOTIATE_INTERFACE_STRUCT);
+
+    // Fill in the function pointers if our version is at least capable of having the structure contain them.
+    if (pVersionStruct->loaderLayerInterfaceVersion >= 2) {
+        pVersionStruct->pfnGetInstanceProcAddr = vkGetInstanceProcAddr;
+        pVersionStruct->pfnGetDeviceProcAddr = vkGetDeviceProcAddr;
+        pVersionStruct->pfnGetPhysicalDeviceProcAddr = vk_layerGetPhysicalDeviceProcAddr;
+    }
+
+    if (pVersionStruct->loaderLayerInterfaceVersion < CURRENT_LOADER_LAYER_INTERFACE_VERSION) {
+        api_capture::loader_layer_if_version = pVersionStruct->loaderLayerInterfaceVersion;
+    } else if (pVersionStruct->loaderLayerInterfaceVersion > CURRENT_LOADER_LAYER_INTERFACE_VERSION) {
+        pVersionStruct->loaderLayerInterfaceVersion = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
+    }
+
+    return VK_SUCCESS;
+}
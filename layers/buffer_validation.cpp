@@ -310,28 +310,15 @@ bool VerifyFramebufferAndRenderPassLayouts(layer_data *device_data, GLOBAL_CB_NO
     return skip;
 }
 
-void TransitionAttachmentRefLayout(layer_data *device_data, GLOBAL_CB_NODE *pCB, FRAMEBUFFER_STATE *pFramebuffer,
-                                   VkAttachmentReference ref) {
-    if (ref.attachment != VK_ATTACHMENT_UNUSED) {
-        auto image_view = pFramebuffer->createInfo.pAttachments[ref.attachment];
-        SetImageViewLayout(device_data, pCB, image_view, ref.layout);
-    }
-}
-
+// Apply the attachment layouts of a subpass, as gathered from its input, color and depth references at render pass creation
 void TransitionSubpassLayouts(layer_data *device_data, GLOBAL_CB_NODE *pCB, const RENDER_PASS_STATE *render_pass_state,
                               const int subpass_index, FRAMEBUFFER_STATE *framebuffer_state) {
     assert(render_pass_state);
 
-    if (framebuffer_state) {
-        auto const &subpass = render_pass_state->createInfo.pSubpasses[subpass_index];
-        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
-            TransitionAttachmentRefLayout(device_data, pCB, framebuffer_state, subpass.pInputAttachments[j]);
-        }
-        for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
-            TransitionAttachmentRefLayout(device_data, pCB, framebuffer_state, subpass.pColorAttachments[j]);
-        }
-        if (subpass.pDepthStencilAttachment) {
-            TransitionAttachmentRefLayout(device_data, pCB, framebuffer_state, *subpass.pDepthStencilAttachment);
+    if (framebuffer_state && static_cast<size_t>(subpass_index) < render_pass_state->subpass_layouts.size()) {
+        for (auto const &ref : render_pass_state->subpass_layouts[subpass_index]) {
+            auto image_view = framebuffer_state->createInfo.pAttachments[ref.attachment];
+            SetImageViewLayout(device_data, pCB, image_view, ref.layout);
         }
     }
 }
@@ -615,19 +602,17 @@ bool PreCallValidateCreateImage(layer_data *device_data, const VkImageCreateInfo
     const VkFormatProperties *properties = GetFormatProperties(device_data, pCreateInfo->format);
 
     if ((pCreateInfo->tiling == VK_IMAGE_TILING_LINEAR) && (properties->linearTilingFeatures == 0)) {
-        std::stringstream ss;
-        ss << "vkCreateImage format parameter (" << string_VkFormat(pCreateInfo->format) << ") is an unsupported format";
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                        VALIDATION_ERROR_02150, "IMAGE", "%s. %s", ss.str().c_str(), validation_error_map[VALIDATION_ERROR_02150]);
+                        VALIDATION_ERROR_02150, "IMAGE", "vkCreateImage format parameter (%s) is an unsupported format. %s",
+                        string_VkFormat(pCreateInfo->format), validation_error_map[VALIDATION_ERROR_02150]);
 
         return skip;
     }
 
     if ((pCreateInfo->tiling == VK_IMAGE_TILING_OPTIMAL) && (properties->optimalTilingFeatures == 0)) {
-        std::stringstream ss;
-        ss << "vkCreateImage format parameter (" << string_VkFormat(pCreateInfo->format) << ") is an unsupported format";
         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                        VALIDATION_ERROR_02155, "IMAGE", "%s. %s", ss.str().c_str(), validation_error_map[VALIDATION_ERROR_02155]);
+                        VALIDATION_ERROR_02155, "IMAGE", "vkCreateImage format parameter (%s) is an unsupported format. %s",
+                        string_VkFormat(pCreateInfo->format), validation_error_map[VALIDATION_ERROR_02155]);
 
         return skip;
     }
@@ -636,21 +621,19 @@ bool PreCallValidateCreateImage(layer_data *device_data, const VkImageCreateInfo
     if (pCreateInfo->usage & VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT) {
         if ((pCreateInfo->tiling == VK_IMAGE_TILING_OPTIMAL) &&
             ((properties->optimalTilingFeatures & VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT) == 0)) {
-            std::stringstream ss;
-            ss << "vkCreateImage: VkFormat for TILING_OPTIMAL image (" << string_VkFormat(pCreateInfo->format)
-               << ") does not support requested Image usage type VK_IMAGE_USAGE_COLOR_ATTACHMENT";
-            skip |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                        VALIDATION_ERROR_02158, "IMAGE", "%s. %s", ss.str().c_str(), validation_error_map[VALIDATION_ERROR_02158]);
+            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                            VALIDATION_ERROR_02158, "IMAGE",
+                            "vkCreateImage: VkFormat for TILING_OPTIMAL image (%s) does not support requested Image usage type "
+                            "VK_IMAGE_USAGE_COLOR_ATTACHMENT. %s", string_VkFormat(pCreateInfo->format),
+                            validation_error_map[VALIDATION_ERROR_02158]);
         }
         if ((pCreateInfo->tiling == VK_IMAGE_TILING_LINEAR) &&
             ((properties->linearTilingFeatures & VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT) == 0)) {
-            std::stringstream ss;
-            ss << "vkCreateImage: VkFormat for TILING_LINEAR image (" << string_VkFormat(pCreateInfo->format)
-               << ") does not support requested Image usage type VK_IMAGE_USAGE_COLOR_ATTACHMENT";
-            skip |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                        VALIDATION_ERROR_02153, "IMAGE", "%s. %s", ss.str().c_str(), validation_error_map[VALIDATION_ERROR_02153]);
+            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                            VALIDATION_ERROR_02153, "IMAGE",
+                            "vkCreateImage: VkFormat for TILING_LINEAR image (%s) does not support requested Image usage type "
+                            "VK_IMAGE_USAGE_COLOR_ATTACHMENT. %s", string_VkFormat(pCreateInfo->format),
+                            validation_error_map[VALIDATION_ERROR_02153]);
         }
     }
 
@@ -658,21 +641,19 @@ bool PreCallValidateCreateImage(layer_data *device_data, const VkImageCreateInfo
     if (pCreateInfo->usage & VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT) {
         if ((pCreateInfo->tiling == VK_IMAGE_TILING_OPTIMAL) &&
             ((properties->optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) == 0)) {
-            std::stringstream ss;
-            ss << "vkCreateImage: VkFormat for TILING_OPTIMAL image (" << string_VkFormat(pCreateInfo->format)
-               << ") does not support requested Image usage type VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT";
-            skip |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                        VALIDATION_ERROR_02159, "IMAGE", "%s. %s", ss.str().c_str(), validation_error_map[VALIDATION_ERROR_02159]);
+            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                            VALIDATION_ERROR_02159, "IMAGE",
+                            "vkCreateImage: VkFormat for TILING_OPTIMAL image (%s) does not support requested Image usage type "
+                            "VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT. %s", string_VkFormat(pCreateInfo->format),
+                            validation_error_map[VALIDATION_ERROR_02159]);
         }
         if ((pCreateInfo->tiling == VK_IMAGE_TILING_LINEAR) &&
             ((properties->linearTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) == 0)) {
-            std::stringstream ss;
-            ss << "vkCreateImage: VkFormat for TILING_LINEAR image (" << string_VkFormat(pCreateInfo->format)
-               << ") does not support requested Image usage type VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT";
-            skip |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                        VALIDATION_ERROR_02154, "IMAGE", "%s. %s", ss.str().c_str(), validation_error_map[VALIDATION_ERROR_02154]);
+            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                            VALIDATION_ERROR_02154, "IMAGE",
+                            "vkCreateImage: VkFormat for TILING_LINEAR image (%s) does not support requested Image usage type "
+                            "VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT. %s", string_VkFormat(pCreateInfo->format),
+                            validation_error_map[VALIDATION_ERROR_02154]);
         }
     }
 
@@ -801,6 +782,7 @@ void PostCallRecordDestroyImage(layer_data *device_data, VkImage image, IMAGE_ST
     core_validation::ClearMemoryObjectBindings(device_data, obj_struct.handle, kVulkanObjectTypeImage);
     // Remove image from imageMap
     core_validation::GetImageMap(device_data)->erase(image);
+    debug_report_forget_object(core_validation::GetReportData(device_data), reinterpret_cast<uint64_t &>(image));
     std::unordered_map<VkImage, std::vector<ImageSubresourcePair>> *imageSubresourceMap =
         core_validation::GetImageSubresourceMap(device_data);
 
@@ -1308,30 +1290,24 @@ bool PreCallValidateCmdCopyImage(layer_data *device_data, GLOBAL_CB_NODE *cb_nod
 
     for (uint32_t i = 0; i < region_count; i++) {
         if (regions[i].srcSubresource.layerCount == 0) {
-            std::stringstream ss;
-            ss << "vkCmdCopyImage: number of layers in pRegions[" << i << "] srcSubresource is zero";
             skip |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, DRAWSTATE_INVALID_IMAGE_ASPECT, "IMAGE", "%s",
-                            ss.str().c_str());
+                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, DRAWSTATE_INVALID_IMAGE_ASPECT, "IMAGE",
+                            "vkCmdCopyImage: number of layers in pRegions[%u] srcSubresource is zero", i);
         }
 
         if (regions[i].dstSubresource.layerCount == 0) {
-            std::stringstream ss;
-            ss << "vkCmdCopyImage: number of layers in pRegions[" << i << "] dstSubresource is zero";
             skip |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, DRAWSTATE_INVALID_IMAGE_ASPECT, "IMAGE", "%s",
-                            ss.str().c_str());
+                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, DRAWSTATE_INVALID_IMAGE_ASPECT, "IMAGE",
+                            "vkCmdCopyImage: number of layers in pRegions[%u] dstSubresource is zero", i);
         }
 
         if (!GetDeviceExtensions(device_data)->khr_maintenance1) {
             // For each region the layerCount member of srcSubresource and dstSubresource must match
             if (regions[i].srcSubresource.layerCount != regions[i].dstSubresource.layerCount) {
-                std::stringstream ss;
-                ss << "vkCmdCopyImage: number of layers in source and destination subresources for pRegions[" << i
-                   << "] do not match";
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                                reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01198, "IMAGE", "%s. %s",
-                                ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01198]);
+                                reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01198, "IMAGE",
+                                "vkCmdCopyImage: number of layers in source and destination subresources for pRegions[%u] do not "
+                                "match. %s", i, validation_error_map[VALIDATION_ERROR_01198]);
             }
         }
 
@@ -1345,31 +1321,27 @@ bool PreCallValidateCmdCopyImage(layer_data *device_data, GLOBAL_CB_NODE *cb_nod
 
         // For each region, the aspectMask member of srcSubresource must be present in the source image
         if (!VerifyAspectsPresent(regions[i].srcSubresource.aspectMask, src_image_state->createInfo.format)) {
-            std::stringstream ss;
-            ss << "vkCmdCopyImage: pRegion[" << i
-               << "] srcSubresource.aspectMask cannot specify aspects not present in source image";
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01200, "IMAGE", "%s. %s",
-                            ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01200]);
+                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01200, "IMAGE",
+                            "vkCmdCopyImage: pRegion[%u] srcSubresource.aspectMask cannot specify aspects not present in source "
+                            "image. %s", i, validation_error_map[VALIDATION_ERROR_01200]);
         }
 
         // For each region, the aspectMask member of dstSubresource must be present in the destination image
         if (!VerifyAspectsPresent(regions[i].dstSubresource.aspectMask, dst_image_state->createInfo.format)) {
-            std::stringstream ss;
-            ss << "vkCmdCopyImage: pRegion[" << i << "] dstSubresource.aspectMask cannot specify aspects not present in dest image";
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01201, "IMAGE", "%s. %s",
-                            ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01201]);
+                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01201, "IMAGE",
+                            "vkCmdCopyImage: pRegion[%u] dstSubresource.aspectMask cannot specify aspects not present in dest "
+                            "image. %s", i, validation_error_map[VALIDATION_ERROR_01201]);
         }
 
         // AspectMask must not contain VK_IMAGE_ASPECT_METADATA_BIT
         if ((regions[i].srcSubresource.aspectMask & VK_IMAGE_ASPECT_METADATA_BIT) ||
             (regions[i].dstSubresource.aspectMask & VK_IMAGE_ASPECT_METADATA_BIT)) {
-            std::stringstream ss;
-            ss << "vkCmdCopyImage: pRegions[" << i << "] may not specify aspectMask containing VK_IMAGE_ASPECT_METADATA_BIT";
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01222, "IMAGE", "%s. %s",
-                            ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01222]);
+                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01222, "IMAGE",
+                            "vkCmdCopyImage: pRegions[%u] may not specify aspectMask containing VK_IMAGE_ASPECT_METADATA_BIT. %s",
+                            i, validation_error_map[VALIDATION_ERROR_01222]);
         }
 
         // For each region, if aspectMask contains VK_IMAGE_ASPECT_COLOR_BIT, it must not contain either of
@@ -1389,54 +1361,46 @@ bool PreCallValidateCmdCopyImage(layer_data *device_data, GLOBAL_CB_NODE *cb_nod
                  (dst_image_state->createInfo.imageType == VK_IMAGE_TYPE_3D)) &&
                 ((regions[i].srcSubresource.baseArrayLayer != 0) || (regions[i].srcSubresource.layerCount != 1) ||
                  (regions[i].dstSubresource.baseArrayLayer != 0) || (regions[i].dstSubresource.layerCount != 1))) {
-                std::stringstream ss;
-                ss << "vkCmdCopyImage: src or dstImage type was IMAGE_TYPE_3D, but in subRegion[" << i
-                   << "] baseArrayLayer was not zero or layerCount was not 1.";
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                                reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01199, "IMAGE", "%s. %s",
-                                ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01199]);
+                                reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01199, "IMAGE",
+                                "vkCmdCopyImage: src or dstImage type was IMAGE_TYPE_3D, but in subRegion[%u] baseArrayLayer was "
+                                "not zero or layerCount was not 1. %s", i, validation_error_map[VALIDATION_ERROR_01199]);
             }
         }
 
         // MipLevel must be less than the mipLevels specified in VkImageCreateInfo when the image was created
         if (regions[i].srcSubresource.mipLevel >= src_image_state->createInfo.mipLevels) {
-            std::stringstream ss;
-            ss << "vkCmdCopyImage: pRegions[" << i
-               << "] specifies a src mipLevel greater than the number specified when the srcImage was created.";
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01223, "IMAGE", "%s. %s",
-                            ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01223]);
+                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01223, "IMAGE",
+                            "vkCmdCopyImage: pRegions[%u] specifies a src mipLevel greater than the number specified when the "
+                            "srcImage was created. %s", i, validation_error_map[VALIDATION_ERROR_01223]);
         }
         if (regions[i].dstSubresource.mipLevel >= dst_image_state->createInfo.mipLevels) {
-            std::stringstream ss;
-            ss << "vkCmdCopyImage: pRegions[" << i
-               << "] specifies a dst mipLevel greater than the number specified when the dstImage was created.";
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01223, "IMAGE", "%s. %s",
-                            ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01223]);
+                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01223, "IMAGE",
+                            "vkCmdCopyImage: pRegions[%u] specifies a dst mipLevel greater than the number specified when the "
+                            "dstImage was created. %s", i, validation_error_map[VALIDATION_ERROR_01223]);
         }
 
         // (baseArrayLayer + layerCount) must be less than or equal to the arrayLayers specified in VkImageCreateInfo when the
         // image was created
         if ((regions[i].srcSubresource.baseArrayLayer + regions[i].srcSubresource.layerCount) >
             src_image_state->createInfo.arrayLayers) {
-            std::stringstream ss;
-            ss << "vkCmdCopyImage: srcImage arrayLayers was " << src_image_state->createInfo.arrayLayers << " but subRegion[" << i
-               << "] baseArrayLayer + layerCount is "
-               << (regions[i].srcSubresource.baseArrayLayer + regions[i].srcSubresource.layerCount);
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01224, "IMAGE", "%s. %s",
-                            ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01224]);
+                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01224, "IMAGE",
+                            "vkCmdCopyImage: srcImage arrayLayers was %u but subRegion[%u] baseArrayLayer + layerCount is %u. %s",
+                            src_image_state->createInfo.arrayLayers, i,
+                            (regions[i].srcSubresource.baseArrayLayer + regions[i].srcSubresource.layerCount),
+                            validation_error_map[VALIDATION_ERROR_01224]);
         }
         if ((regions[i].dstSubresource.baseArrayLayer + regions[i].dstSubresource.layerCount) >
             dst_image_state->createInfo.arrayLayers) {
-            std::stringstream ss;
-            ss << "vkCmdCopyImage: dstImage arrayLayers was " << dst_image_state->createInfo.arrayLayers << " but subRegion[" << i
-               << "] baseArrayLayer + layerCount is "
-               << (regions[i].dstSubresource.baseArrayLayer + regions[i].dstSubresource.layerCount);
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01224, "IMAGE", "%s. %s",
-                            ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01224]);
+                            reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01224, "IMAGE",
+                            "vkCmdCopyImage: dstImage arrayLayers was %u but subRegion[%u] baseArrayLayer + layerCount is %u. %s",
+                            dst_image_state->createInfo.arrayLayers, i,
+                            (regions[i].dstSubresource.baseArrayLayer + regions[i].dstSubresource.layerCount),
+                            validation_error_map[VALIDATION_ERROR_01224]);
         }
 
         // Check region extents for 1D-1D, 2D-2D, and 3D-3D copies
@@ -1444,27 +1408,23 @@ bool PreCallValidateCmdCopyImage(layer_data *device_data, GLOBAL_CB_NODE *cb_nod
             // The source region specified by a given element of regions must be a region that is contained within srcImage
             VkExtent3D img_extent = GetImageSubresourceExtent(src_image_state, &(regions[i].srcSubresource));
             if (0 != ExceedsBounds(&regions[i].srcOffset, &regions[i].extent, &img_extent)) {
-                std::stringstream ss;
-                ss << "vkCmdCopyImage: Source pRegion[" << i << "] with mipLevel [ " << regions[i].srcSubresource.mipLevel
-                   << " ], offset [ " << regions[i].srcOffset.x << ", " << regions[i].srcOffset.y << ", " << regions[i].srcOffset.z
-                   << " ], extent [ " << regions[i].extent.width << ", " << regions[i].extent.height << ", "
-                   << regions[i].extent.depth << " ] exceeds the source image dimensions";
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                                reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01175, "IMAGE", "%s. %s",
-                                ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01175]);
+                                reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01175, "IMAGE",
+                                "vkCmdCopyImage: Source pRegion[%u] with mipLevel [ %u ], offset [ %d, %d, %d ], extent [ %u, %u, "
+                                "%u ] exceeds the source image dimensions. %s", i, regions[i].srcSubresource.mipLevel,
+                                regions[i].srcOffset.x, regions[i].srcOffset.y, regions[i].srcOffset.z, regions[i].extent.width,
+                                regions[i].extent.height, regions[i].extent.depth, validation_error_map[VALIDATION_ERROR_01175]);
             }
 
             // The destination region specified by a given element of regions must be a region that is contained within dst_image
             img_extent = GetImageSubresourceExtent(dst_image_state, &(regions[i].dstSubresource));
             if (0 != ExceedsBounds(&regions[i].dstOffset, &regions[i].extent, &img_extent)) {
-                std::stringstream ss;
-                ss << "vkCmdCopyImage: Dest pRegion[" << i << "] with mipLevel [ " << regions[i].dstSubresource.mipLevel
-                   << " ], offset [ " << regions[i].dstOffset.x << ", " << regions[i].dstOffset.y << ", " << regions[i].dstOffset.z
-                   << " ], extent [ " << regions[i].extent.width << ", " << regions[i].extent.height << ", "
-                   << regions[i].extent.depth << " ] exceeds the destination image dimensions";
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                                reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01176, "IMAGE", "%s. %s",
-                                ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01176]);
+                                reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01176, "IMAGE",
+                                "vkCmdCopyImage: Dest pRegion[%u] with mipLevel [ %u ], offset [ %d, %d, %d ], extent [ %u, %u, %u "
+                                "] exceeds the destination image dimensions. %s", i, regions[i].dstSubresource.mipLevel,
+                                regions[i].dstOffset.x, regions[i].dstOffset.y, regions[i].dstOffset.z, regions[i].extent.width,
+                                regions[i].extent.height, regions[i].extent.depth, validation_error_map[VALIDATION_ERROR_01176]);
             }
         }
 
@@ -1529,11 +1489,10 @@ bool PreCallValidateCmdCopyImage(layer_data *device_data, GLOBAL_CB_NODE *cb_nod
         if (src_image_state->image == dst_image_state->image) {
             for (uint32_t j = 0; j < region_count; j++) {
                 if (RegionIntersects(&regions[i], &regions[j], src_image_state->createInfo.imageType)) {
-                    std::stringstream ss;
-                    ss << "vkCmdCopyImage: pRegions[" << i << "] src overlaps with pRegions[" << j << "].";
                     skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                     reinterpret_cast<uint64_t &>(command_buffer), __LINE__, VALIDATION_ERROR_01177, "IMAGE",
-                                    "%s. %s", ss.str().c_str(), validation_error_map[VALIDATION_ERROR_01177]);
+                                    "vkCmdCopyImage: pRegions[%u] src overlaps with pRegions[%u]. %s", i, j,
+                                    validation_error_map[VALIDATION_ERROR_01177]);
                 }
             }
         }
@@ -1858,20 +1817,16 @@ bool PreCallValidateCmdBlitImage(layer_data *device_data, GLOBAL_CB_NODE *cb_nod
             if ((pRegions[i].srcOffsets[0].x == pRegions[i].srcOffsets[1].x) ||
                 (pRegions[i].srcOffsets[0].y == pRegions[i].srcOffsets[1].y) ||
                 (pRegions[i].srcOffsets[0].z == pRegions[i].srcOffsets[1].z)) {
-                std::stringstream ss;
-                ss << "vkCmdBlitImage: pRegions[" << i << "].srcOffsets specify a zero-volume area.";
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                 reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, DRAWSTATE_INVALID_EXTENTS, "IMAGE",
-                                "%s", ss.str().c_str());
+                                "vkCmdBlitImage: pRegions[%u].srcOffsets specify a zero-volume area.", i);
             }
             if ((pRegions[i].dstOffsets[0].x == pRegions[i].dstOffsets[1].x) ||
                 (pRegions[i].dstOffsets[0].y == pRegions[i].dstOffsets[1].y) ||
                 (pRegions[i].dstOffsets[0].z == pRegions[i].dstOffsets[1].z)) {
-                std::stringstream ss;
-                ss << "vkCmdBlitImage: pRegions[" << i << "].dstOffsets specify a zero-volume area.";
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                 reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, DRAWSTATE_INVALID_EXTENTS, "IMAGE",
-                                "%s", ss.str().c_str());
+                                "vkCmdBlitImage: pRegions[%u].dstOffsets specify a zero-volume area.", i);
             }
             if (pRegions[i].srcSubresource.layerCount == 0) {
                 char const str[] = "vkCmdBlitImage: number of layers in source subresource is zero";
@@ -1908,37 +1863,31 @@ bool PreCallValidateCmdBlitImage(layer_data *device_data, GLOBAL_CB_NODE *cb_nod
 
         // Validate consistency for unsigned formats
         if (FormatIsUInt(src_format) != FormatIsUInt(dst_format)) {
-            std::stringstream ss;
-            ss << "vkCmdBlitImage: If one of srcImage and dstImage images has unsigned integer format, "
-               << "the other one must also have unsigned integer format.  "
-               << "Source format is " << string_VkFormat(src_format) << " Destination format is " << string_VkFormat(dst_format);
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, VALIDATION_ERROR_02191, "IMAGE", "%s. %s",
-                            ss.str().c_str(), validation_error_map[VALIDATION_ERROR_02191]);
+                            reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, VALIDATION_ERROR_02191, "IMAGE",
+                            "vkCmdBlitImage: If one of srcImage and dstImage images has unsigned integer format, the other one "
+                            "must also have unsigned integer format.  Source format is %s Destination format is %s. %s",
+                            string_VkFormat(src_format), string_VkFormat(dst_format), validation_error_map[VALIDATION_ERROR_02191]);
         }
 
         // Validate consistency for signed formats
         if (FormatIsSInt(src_format) != FormatIsSInt(dst_format)) {
-            std::stringstream ss;
-            ss << "vkCmdBlitImage: If one of srcImage and dstImage images has signed integer format, "
-               << "the other one must also have signed integer format.  "
-               << "Source format is " << string_VkFormat(src_format) << " Destination format is " << string_VkFormat(dst_format);
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, VALIDATION_ERROR_02190, "IMAGE", "%s. %s",
-                            ss.str().c_str(), validation_error_map[VALIDATION_ERROR_02190]);
+                            reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, VALIDATION_ERROR_02190, "IMAGE",
+                            "vkCmdBlitImage: If one of srcImage and dstImage images has signed integer format, the other one must "
+                            "also have signed integer format.  Source format is %s Destination format is %s. %s",
+                            string_VkFormat(src_format), string_VkFormat(dst_format), validation_error_map[VALIDATION_ERROR_02190]);
         }
 
         // Validate aspect bits and formats for depth/stencil images
         if (FormatIsDepthOrStencil(src_format) || FormatIsDepthOrStencil(dst_format)) {
             if (src_format != dst_format) {
-                std::stringstream ss;
-                ss << "vkCmdBlitImage: If one of srcImage and dstImage images has a format of depth, stencil or depth "
-                   << "stencil, the other one must have exactly the same format.  "
-                   << "Source format is " << string_VkFormat(src_format) << " Destination format is "
-                   << string_VkFormat(dst_format);
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                 reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, VALIDATION_ERROR_02192, "IMAGE",
-                                "%s. %s", ss.str().c_str(), validation_error_map[VALIDATION_ERROR_02192]);
+                                "vkCmdBlitImage: If one of srcImage and dstImage images has a format of depth, stencil or depth "
+                                "stencil, the other one must have exactly the same format.  Source format is %s Destination format "
+                                "is %s. %s", string_VkFormat(src_format), string_VkFormat(dst_format),
+                                validation_error_map[VALIDATION_ERROR_02192]);
             }
 
             for (uint32_t i = 0; i < regionCount; i++) {
@@ -1946,31 +1895,27 @@ bool PreCallValidateCmdBlitImage(layer_data *device_data, GLOBAL_CB_NODE *cb_nod
 
                 if (FormatIsDepthAndStencil(src_format)) {
                     if ((srcAspect != VK_IMAGE_ASPECT_DEPTH_BIT) && (srcAspect != VK_IMAGE_ASPECT_STENCIL_BIT)) {
-                        std::stringstream ss;
-                        ss << "vkCmdBlitImage: Combination depth/stencil image formats must have only one of "
-                              "VK_IMAGE_ASPECT_DEPTH_BIT "
-                           << "and VK_IMAGE_ASPECT_STENCIL_BIT set in srcImage and dstImage";
                         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                         reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__,
-                                        DRAWSTATE_INVALID_IMAGE_ASPECT, "IMAGE", "%s", ss.str().c_str());
+                                        DRAWSTATE_INVALID_IMAGE_ASPECT, "IMAGE",
+                                        "vkCmdBlitImage: Combination depth/stencil image formats must have only one of "
+                                        "VK_IMAGE_ASPECT_DEPTH_BIT and VK_IMAGE_ASPECT_STENCIL_BIT set in srcImage and dstImage");
                     }
                 } else if (FormatIsStencilOnly(src_format)) {
                     if (srcAspect != VK_IMAGE_ASPECT_STENCIL_BIT) {
-                        std::stringstream ss;
-                        ss << "vkCmdBlitImage: Stencil-only image formats must have only the VK_IMAGE_ASPECT_STENCIL_BIT "
-                           << "set in both the srcImage and dstImage";
                         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                         reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__,
-                                        DRAWSTATE_INVALID_IMAGE_ASPECT, "IMAGE", "%s", ss.str().c_str());
+                                        DRAWSTATE_INVALID_IMAGE_ASPECT, "IMAGE",
+                                        "vkCmdBlitImage: Stencil-only image formats must have only the VK_IMAGE_ASPECT_STENCIL_BIT "
+                                        "set in both the srcImage and dstImage");
                     }
                 } else if (FormatIsDepthOnly(src_format)) {
                     if (srcAspect != VK_IMAGE_ASPECT_DEPTH_BIT) {
-                        std::stringstream ss;
-                        ss << "vkCmdBlitImage: Depth-only image formats must have only the VK_IMAGE_ASPECT_DEPTH "
-                           << "set in both the srcImage and dstImage";
                         skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                                         reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__,
-                                        DRAWSTATE_INVALID_IMAGE_ASPECT, "IMAGE", "%s", ss.str().c_str());
+                                        DRAWSTATE_INVALID_IMAGE_ASPECT, "IMAGE",
+                                        "vkCmdBlitImage: Depth-only image formats must have only the VK_IMAGE_ASPECT_DEPTH set in "
+                                        "both the srcImage and dstImage");
                     }
                 }
             }
@@ -1978,12 +1923,10 @@ bool PreCallValidateCmdBlitImage(layer_data *device_data, GLOBAL_CB_NODE *cb_nod
 
         // Validate filter
         if (FormatIsDepthOrStencil(src_format) && (filter != VK_FILTER_NEAREST)) {
-            std::stringstream ss;
-            ss << "vkCmdBlitImage: If the format of srcImage is a depth, stencil, or depth stencil "
-               << "then filter must be VK_FILTER_NEAREST.";
             skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, VALIDATION_ERROR_02193, "IMAGE", "%s. %s",
-                            ss.str().c_str(), validation_error_map[VALIDATION_ERROR_02193]);
+                            reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, VALIDATION_ERROR_02193, "IMAGE",
+                            "vkCmdBlitImage: If the format of srcImage is a depth, stencil, or depth stencil then filter must be "
+                            "VK_FILTER_NEAREST. %s", validation_error_map[VALIDATION_ERROR_02193]);
         }
     } else {
         assert(0);
@@ -2088,35 +2031,34 @@ static bool ValidateMaskBits(core_validation::layer_data *device_data, VkCommand
     if ((accessMask & required_bit) || (!required_bit && (accessMask & optional_bits))) {
         if (accessMask & ~(required_bit | optional_bits)) {
             // TODO: Verify against Valid Use
-            skip |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t>(cmdBuffer), __LINE__, DRAWSTATE_INVALID_BARRIER, "DS",
-                            "Additional bits in %s accessMask 0x%X %s are specified when layout is %s.", type, accessMask,
-                            string_VkAccessFlags(accessMask).c_str(), string_VkImageLayout(layout));
+            auto format_msg = [&]() {
+                std::stringstream ss;
+                ss << "Additional bits in " << type << " accessMask 0x" << std::hex << std::uppercase << accessMask << " "
+                   << string_VkAccessFlags(accessMask) << " are specified when layout is " << string_VkImageLayout(layout) << ".";
+                return ss.str();
+            };
+            skip |= log_msg_deferred(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                                     reinterpret_cast<uint64_t>(cmdBuffer), __LINE__, DRAWSTATE_INVALID_BARRIER, "DS", format_msg);
         }
     } else {
-        if (!required_bit) {
-            skip |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t>(cmdBuffer), __LINE__, DRAWSTATE_INVALID_BARRIER, "DS",
-                            "%s AccessMask %d %s must contain at least one of access bits %d "
-                            "%s when layout is %s, unless the app has previously added a "
-                            "barrier for this transition.",
-                            type, accessMask, string_VkAccessFlags(accessMask).c_str(), optional_bits,
-                            string_VkAccessFlags(optional_bits).c_str(), string_VkImageLayout(layout));
-        } else {
-            std::string opt_bits;
-            if (optional_bits != 0) {
-                std::stringstream ss;
-                ss << optional_bits;
-                opt_bits = "and may have optional bits " + ss.str() + ' ' + string_VkAccessFlags(optional_bits);
+        // The access flag names are only spelled out if the warning is delivered
+        auto format_msg = [&]() {
+            std::stringstream ss;
+            ss << type << " AccessMask " << accessMask << " " << string_VkAccessFlags(accessMask);
+            if (!required_bit) {
+                ss << " must contain at least one of access bits " << optional_bits << " " << string_VkAccessFlags(optional_bits);
+            } else {
+                ss << " must have required access bit " << required_bit << " " << string_VkAccessFlags(required_bit) << " ";
+                if (optional_bits != 0) {
+                    ss << "and may have optional bits " << optional_bits << ' ' << string_VkAccessFlags(optional_bits);
+                }
             }
-            skip |= log_msg(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t>(cmdBuffer), __LINE__, DRAWSTATE_INVALID_BARRIER, "DS",
-                            "%s AccessMask %d %s must have required access bit %d %s %s when "
-                            "layout is %s, unless the app has previously added a barrier for "
-                            "this transition.",
-                            type, accessMask, string_VkAccessFlags(accessMask).c_str(), required_bit,
-                            string_VkAccessFlags(required_bit).c_str(), opt_bits.c_str(), string_VkImageLayout(layout));
-        }
+            ss << " when layout is " << string_VkImageLayout(layout)
+               << ", unless the app has previously added a barrier for this transition.";
+            return ss.str();
+        };
+        skip |= log_msg_deferred(report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                                 reinterpret_cast<uint64_t>(cmdBuffer), __LINE__, DRAWSTATE_INVALID_BARRIER, "DS", format_msg);
     }
     return skip;
 }
@@ -2540,22 +2482,19 @@ bool PreCallValidateCreateImageView(layer_data *device_data, const VkImageViewCr
         // Checks imported from image layer
         if ((create_info->subresourceRange.baseMipLevel + create_info->subresourceRange.levelCount) >
             image_state->createInfo.mipLevels) {
-            std::stringstream ss;
-            ss << "vkCreateImageView called with baseMipLevel " << create_info->subresourceRange.baseMipLevel << " for image "
-               << create_info->image << " that only has " << image_state->createInfo.mipLevels << " mip levels.";
-            skip |=
-                log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                        VALIDATION_ERROR_00768, "IMAGE", "%s %s", ss.str().c_str(), validation_error_map[VALIDATION_ERROR_00768]);
+            skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                            VALIDATION_ERROR_00768, "IMAGE",
+                            "vkCreateImageView called with baseMipLevel %u for image 0x%" PRIxLEAST64 " that only has %u mip "
+                            "levels. %s", create_info->subresourceRange.baseMipLevel, (uint64_t)create_info->image,
+                            image_state->createInfo.mipLevels, validation_error_map[VALIDATION_ERROR_00768]);
         }
         if (!GetDeviceExtensions(device_data)->khr_maintenance1) {
             if (create_info->subresourceRange.baseArrayLayer >= image_state->createInfo.arrayLayers) {
-                std::stringstream ss;
-                ss << "vkCreateImageView called with baseArrayLayer " << create_info->subresourceRange.baseArrayLayer
-                   << " for image " << create_info->image << " that only has " << image_state->createInfo.arrayLayers
-                   << " array layers.";
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                                VALIDATION_ERROR_00769, "IMAGE", "%s %s", ss.str().c_str(),
-                                validation_error_map[VALIDATION_ERROR_00769]);
+                                VALIDATION_ERROR_00769, "IMAGE",
+                                "vkCreateImageView called with baseArrayLayer %u for image 0x%" PRIxLEAST64 " that only has %u "
+                                "array layers. %s", create_info->subresourceRange.baseArrayLayer, (uint64_t)create_info->image,
+                                image_state->createInfo.arrayLayers, validation_error_map[VALIDATION_ERROR_00769]);
             }
         }
         // TODO: Need new valid usage language for levelCount == 0 & layerCount == 0
@@ -2570,24 +2509,22 @@ bool PreCallValidateCreateImageView(layer_data *device_data, const VkImageViewCr
         if (image_flags & VK_IMAGE_CREATE_MUTABLE_FORMAT_BIT) {
             // Format MUST be compatible (in the same format compatibility class) as the format the image was created with
             if (FormatCompatibilityClass(image_format) != FormatCompatibilityClass(view_format)) {
-                std::stringstream ss;
-                ss << "vkCreateImageView(): ImageView format " << string_VkFormat(view_format)
-                   << " is not in the same format compatibility class as image (" << (uint64_t)create_info->image << ")  format "
-                   << string_VkFormat(image_format) << ".  Images created with the VK_IMAGE_CREATE_MUTABLE_FORMAT BIT "
-                   << "can support ImageViews with differing formats but they must be in the same compatibility class.";
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                                VALIDATION_ERROR_02171, "IMAGE", "%s %s", ss.str().c_str(),
+                                VALIDATION_ERROR_02171, "IMAGE",
+                                "vkCreateImageView(): ImageView format %s is not in the same format compatibility class as image "
+                                "(%" PRIu64 ")  format %s.  Images created with the VK_IMAGE_CREATE_MUTABLE_FORMAT BIT can support "
+                                "ImageViews with differing formats but they must be in the same compatibility class. %s",
+                                string_VkFormat(view_format), (uint64_t)create_info->image, string_VkFormat(image_format),
                                 validation_error_map[VALIDATION_ERROR_02171]);
             }
         } else {
             // Format MUST be IDENTICAL to the format the image was created with
             if (image_format != view_format) {
-                std::stringstream ss;
-                ss << "vkCreateImageView() format " << string_VkFormat(view_format) << " differs from image "
-                   << (uint64_t)create_info->image << " format " << string_VkFormat(image_format)
-                   << ".  Formats MUST be IDENTICAL unless VK_IMAGE_CREATE_MUTABLE_FORMAT BIT was set on image creation.";
                 skip |= log_msg(report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
-                                VALIDATION_ERROR_02172, "IMAGE", "%s %s", ss.str().c_str(),
+                                VALIDATION_ERROR_02172, "IMAGE",
+                                "vkCreateImageView() format %s differs from image %" PRIu64 " format %s.  Formats MUST be "
+                                "IDENTICAL unless VK_IMAGE_CREATE_MUTABLE_FORMAT BIT was set on image creation. %s",
+                                string_VkFormat(view_format), (uint64_t)create_info->image, string_VkFormat(image_format),
                                 validation_error_map[VALIDATION_ERROR_02172]);
             }
         }
@@ -2679,6 +2616,7 @@ void PostCallRecordDestroyImageView(layer_data *device_data, VkImageView image_v
     // Any bound cmd buffers are now invalid
     invalidateCommandBuffers(device_data, image_view_state->cb_bindings, obj_struct);
     (*GetImageViewMap(device_data)).erase(image_view);
+    debug_report_forget_object(GetReportData(device_data), reinterpret_cast<uint64_t &>(image_view));
 }
 
 bool PreCallValidateDestroyBuffer(layer_data *device_data, VkBuffer buffer, BUFFER_STATE **buffer_state, VK_OBJECT *obj_struct) {
@@ -2702,6 +2640,7 @@ void PostCallRecordDestroyBuffer(layer_data *device_data, VkBuffer buffer, BUFFE
     }
     ClearMemoryObjectBindings(device_data, reinterpret_cast<uint64_t &>(buffer), kVulkanObjectTypeBuffer);
     GetBufferMap(device_data)->erase(buffer_state->buffer);
+    debug_report_forget_object(GetReportData(device_data), reinterpret_cast<uint64_t &>(buffer));
 }
 
 bool PreCallValidateDestroyBufferView(layer_data *device_data, VkBufferView buffer_view, BUFFER_VIEW_STATE **buffer_view_state,
@@ -2721,6 +2660,7 @@ void PostCallRecordDestroyBufferView(layer_data *device_data, VkBufferView buffe
     // Any bound cmd buffers are now invalid
     invalidateCommandBuffers(device_data, buffer_view_state->cb_bindings, obj_struct);
     GetBufferViewMap(device_data)->erase(buffer_view);
+    debug_report_forget_object(GetReportData(device_data), reinterpret_cast<uint64_t &>(buffer_view));
 }
 
 bool PreCallValidateCmdFillBuffer(layer_data *device_data, GLOBAL_CB_NODE *cb_node, BUFFER_STATE *buffer_state) {
@@ -62,10 +62,12 @@
 #endif
 #include "core_validation.h"
 #include "buffer_validation.h"
+#include "mapped_memory_guard.h"
 #include "vk_layer_table.h"
 #include "vk_layer_data.h"
 #include "vk_layer_extension_utils.h"
 #include "vk_layer_utils.h"
+#include "vk_command_ids.h"
 #include "spirv-tools/libspirv.h"
 
 #if defined __ANDROID__
@@ -105,6 +107,26 @@ static const uint32_t kSurfaceSizeFromSwapchain = 0xFFFFFFFFu;
 // fwd decls
 struct shader_module;
 
+// What render pass compatibility compares, flattened: for each subpass, the format, sample count and flags of the attachment
+// behind each reference. Render passes with equal keys share a compatibility class.
+typedef std::vector<uint32_t> RenderPassCompatibilityKey;
+
+struct RenderPassCompatibilityKeyHash {
+    size_t operator()(const RenderPassCompatibilityKey &key) const {
+        size_t hash = key.size();
+        for (auto word : key) {
+            hash ^= std::hash<uint32_t>()(word) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        }
+        return hash;
+    }
+};
+
+// Outcome of verify_renderpass_compatibility() for a pair of compatibility classes
+struct RenderPassCompatibility {
+    bool compatible;
+    std::string error;
+};
+
 struct instance_layer_data {
     VkInstance instance = VK_NULL_HANDLE;
     debug_report_data *report_data = nullptr;
@@ -116,6 +138,8 @@ struct instance_layer_data {
     CALL_STATE vkEnumeratePhysicalDeviceGroupsState = UNCALLED;
     uint32_t physical_device_groups_count = 0;
     CHECK_DISABLED disabled = {};
+    // Protect mapped non-coherent memory with guard pages rather than a padded shadow copy
+    bool noncoherent_guard_pages = false;
 
     unordered_map<VkPhysicalDevice, PHYSICAL_DEVICE_STATE> physical_device_map;
     unordered_map<VkSurfaceKHR, SURFACE_STATE> surface_map;
@@ -147,7 +171,7 @@ struct layer_data {
     unordered_map<VkFence, FENCE_NODE> fenceMap;
     unordered_map<VkQueue, QUEUE_STATE> queueMap;
     unordered_map<VkEvent, EVENT_STATE> eventMap;
-    unordered_map<QueryObject, bool> queryToStateMap;
+    QueryStateMap queryToStateMap;
     unordered_map<VkQueryPool, QUERY_POOL_NODE> queryPoolMap;
     unordered_map<VkSemaphore, SEMAPHORE_NODE> semaphoreMap;
     unordered_map<VkCommandBuffer, GLOBAL_CB_NODE *> commandBufferMap;
@@ -155,6 +179,10 @@ struct layer_data {
     unordered_map<VkImage, vector<ImageSubresourcePair>> imageSubresourceMap;
     unordered_map<ImageSubresourcePair, IMAGE_LAYOUT_NODE> imageLayoutMap;
     unordered_map<VkRenderPass, unique_ptr<RENDER_PASS_STATE>> renderPassMap;
+    // Render pass compatibility classes, and the verdicts already reached for pairs of them, keyed by the pair
+    unordered_map<RenderPassCompatibilityKey, uint32_t, RenderPassCompatibilityKeyHash> renderPassCompatibilityClasses;
+    unordered_map<uint64_t, RenderPassCompatibility> renderPassCompatibility;
+    unordered_set<uint64_t> renderPassAttachmentsCompatible;  // Pairs validateRenderPassCompatibility() found no mismatch in
     unordered_map<VkShaderModule, unique_ptr<shader_module>> shaderModuleMap;
     unordered_map<VkDescriptorUpdateTemplateKHR, unique_ptr<TEMPLATE_STATE>> desc_template_map;
     unordered_map<VkSwapchainKHR, std::unique_ptr<SWAPCHAIN_NODE>> swapchainMap;
@@ -172,9 +200,8 @@ struct layer_data {
     VkPhysicalDeviceProperties phys_dev_props = {};
 };
 
-// TODO : Do we need to guard access to layer_data_map w/ lock?
-static unordered_map<void *, layer_data *> layer_data_map;
-static unordered_map<void *, instance_layer_data *> instance_layer_data_map;
+static LayerDataRegistry<layer_data> layer_data_map;
+static LayerDataRegistry<instance_layer_data> instance_layer_data_map;
 
 static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
 
@@ -2005,22 +2032,84 @@ static bool verify_renderpass_compatibility(const layer_data *dev_data, const Vk
     return true;
 }
 
+static void AppendAttachmentReferenceKey(const VkRenderPassCreateInfo *pCreateInfo, uint32_t attachment,
+                                         RenderPassCompatibilityKey &key) {
+    if (attachment >= pCreateInfo->attachmentCount) {
+        key.push_back(VK_ATTACHMENT_UNUSED);
+        return;
+    }
+    const VkAttachmentDescription &description = pCreateInfo->pAttachments[attachment];
+    key.push_back(description.format);
+    key.push_back(description.samples);
+    key.push_back(description.flags);
+}
+
+// Find the compatibility class of a render pass, starting a new class if no render pass with the same structure has been seen
+static uint32_t GetRenderPassCompatibilityClass(layer_data *dev_data, const VkRenderPassCreateInfo *pCreateInfo) {
+    RenderPassCompatibilityKey key;
+    key.push_back(pCreateInfo->subpassCount);
+    for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
+        const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[i];
+        key.push_back(subpass.pColorAttachments != nullptr);
+        key.push_back(subpass.colorAttachmentCount);
+        for (uint32_t j = 0; subpass.pColorAttachments && j < subpass.colorAttachmentCount; ++j) {
+            AppendAttachmentReferenceKey(pCreateInfo, subpass.pColorAttachments[j].attachment, key);
+        }
+        key.push_back(subpass.pResolveAttachments != nullptr);
+        for (uint32_t j = 0; subpass.pResolveAttachments && j < subpass.colorAttachmentCount; ++j) {
+            AppendAttachmentReferenceKey(pCreateInfo, subpass.pResolveAttachments[j].attachment, key);
+        }
+        key.push_back(subpass.pDepthStencilAttachment != nullptr);
+        if (subpass.pDepthStencilAttachment) {
+            AppendAttachmentReferenceKey(pCreateInfo, subpass.pDepthStencilAttachment->attachment, key);
+        }
+        key.push_back(subpass.pInputAttachments != nullptr);
+        key.push_back(subpass.inputAttachmentCount);
+        for (uint32_t j = 0; subpass.pInputAttachments && j < subpass.inputAttachmentCount; ++j) {
+            AppendAttachmentReferenceKey(pCreateInfo, subpass.pInputAttachments[j].attachment, key);
+        }
+    }
+    auto &classes = dev_data->renderPassCompatibilityClasses;
+    auto result = classes.emplace(std::move(key), static_cast<uint32_t>(classes.size() + 1));
+    return result.first->second;
+}
+
+// Key of the cached verdicts for a pair of compatibility classes, or 0 if either class is unknown
+static uint64_t RenderPassCompatibilityPair(uint32_t primary_class, uint32_t secondary_class) {
+    if (!primary_class || !secondary_class) return 0;
+    return (static_cast<uint64_t>(primary_class) << 32) | secondary_class;
+}
+
+// verify_renderpass_compatibility(), comparing the create infos only the first time a pair of compatibility classes is seen
+static bool VerifyRenderPassCompatibility(layer_data *dev_data, uint32_t primary_class, const VkRenderPassCreateInfo *primaryRPCI,
+                                          uint32_t secondary_class, const VkRenderPassCreateInfo *secondaryRPCI,
+                                          string &errorMsg) {
+    if (primary_class && primary_class == secondary_class) return true;
+    const uint64_t pair = RenderPassCompatibilityPair(primary_class, secondary_class);
+    if (!pair) return verify_renderpass_compatibility(dev_data, primaryRPCI, secondaryRPCI, errorMsg);
+    auto verdict = dev_data->renderPassCompatibility.find(pair);
+    if (verdict == dev_data->renderPassCompatibility.end()) {
+        RenderPassCompatibility compatibility;
+        compatibility.compatible = verify_renderpass_compatibility(dev_data, primaryRPCI, secondaryRPCI, compatibility.error);
+        verdict = dev_data->renderPassCompatibility.emplace(pair, std::move(compatibility)).first;
+    }
+    if (!verdict->second.compatible) errorMsg = verdict->second.error;
+    return verdict->second.compatible;
+}
+
 // For given cvdescriptorset::DescriptorSet, verify that its Set is compatible w/ the setLayout corresponding to
-// pipelineLayout[layoutIndex]
+// pipelineLayout[layoutIndex]. On failure the cause is recorded in failure, to be formatted only if it gets reported.
 static bool verify_set_layout_compatibility(const cvdescriptorset::DescriptorSet *descriptor_set,
                                             PIPELINE_LAYOUT_NODE const *pipeline_layout, const uint32_t layoutIndex,
-                                            string &errorMsg) {
+                                            cvdescriptorset::DescriptorSetFailure *failure) {
     auto num_sets = pipeline_layout->set_layouts.size();
     if (layoutIndex >= num_sets) {
-        stringstream errorStr;
-        errorStr << "VkPipelineLayout (" << pipeline_layout->layout << ") only contains " << num_sets
-                 << " setLayouts corresponding to sets 0-" << num_sets - 1 << ", but you're attempting to bind set to index "
-                 << layoutIndex;
-        errorMsg = errorStr.str();
+        failure->Set(cvdescriptorset::DescriptorSetFailure::SetIndexOutOfRange,
+                     reinterpret_cast<const uint64_t &>(pipeline_layout->layout), 0, {num_sets, layoutIndex});
         return false;
     }
     auto layout_node = pipeline_layout->set_layouts[layoutIndex];
-    return descriptor_set->IsCompatible(layout_node, &errorMsg);
+    return descriptor_set->IsCompatible(layout_node, failure);
 }
 
 // Validate that data for each specialization entry is fully contained within the buffer.
@@ -2477,7 +2566,7 @@ static void list_bits(std::ostream &s, uint32_t bits) {
 }
 
 // Validate draw-time state related to the PSO
-static bool ValidatePipelineDrawtimeState(layer_data const *dev_data, LAST_BOUND_STATE const &state, const GLOBAL_CB_NODE *pCB,
+static bool ValidatePipelineDrawtimeState(layer_data *dev_data, LAST_BOUND_STATE const &state, const GLOBAL_CB_NODE *pCB,
                                           PIPELINE_STATE const *pPipeline) {
     bool skip = false;
 
@@ -2519,12 +2608,16 @@ static bool ValidatePipelineDrawtimeState(layer_data const *dev_data, LAST_BOUND
             auto requiredViewportsMask = (1 << pPipeline->graphicsPipelineCI.pViewportState->viewportCount) - 1;
             auto missingViewportMask = ~pCB->viewportMask & requiredViewportsMask;
             if (missingViewportMask) {
-                std::stringstream ss;
-                ss << "Dynamic viewport(s) ";
-                list_bits(ss, missingViewportMask);
-                ss << " are used by pipeline state object, but were not provided via calls to vkCmdSetViewport().";
-                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                __LINE__, DRAWSTATE_VIEWPORT_SCISSOR_MISMATCH, "DS", "%s", ss.str().c_str());
+                auto format_msg = [&]() {
+                    std::stringstream ss;
+                    ss << "Dynamic viewport(s) ";
+                    list_bits(ss, missingViewportMask);
+                    ss << " are used by pipeline state object, but were not provided via calls to vkCmdSetViewport().";
+                    return ss.str();
+                };
+                skip |= log_msg_deferred(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__, DRAWSTATE_VIEWPORT_SCISSOR_MISMATCH,
+                                         "DS", format_msg);
             }
         }
 
@@ -2532,12 +2625,16 @@ static bool ValidatePipelineDrawtimeState(layer_data const *dev_data, LAST_BOUND
             auto requiredScissorMask = (1 << pPipeline->graphicsPipelineCI.pViewportState->scissorCount) - 1;
             auto missingScissorMask = ~pCB->scissorMask & requiredScissorMask;
             if (missingScissorMask) {
-                std::stringstream ss;
-                ss << "Dynamic scissor(s) ";
-                list_bits(ss, missingScissorMask);
-                ss << " are used by pipeline state object, but were not provided via calls to vkCmdSetScissor().";
-                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                __LINE__, DRAWSTATE_VIEWPORT_SCISSOR_MISMATCH, "DS", "%s", ss.str().c_str());
+                auto format_msg = [&]() {
+                    std::stringstream ss;
+                    ss << "Dynamic scissor(s) ";
+                    list_bits(ss, missingScissorMask);
+                    ss << " are used by pipeline state object, but were not provided via calls to vkCmdSetScissor().";
+                    return ss.str();
+                };
+                skip |= log_msg_deferred(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                         VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__, DRAWSTATE_VIEWPORT_SCISSOR_MISMATCH,
+                                         "DS", format_msg);
             }
         }
     }
@@ -2584,8 +2681,9 @@ static bool ValidatePipelineDrawtimeState(layer_data const *dev_data, LAST_BOUND
     if (pCB->activeRenderPass) {
         std::string err_string;
         if ((pCB->activeRenderPass->renderPass != pPipeline->graphicsPipelineCI.renderPass) &&
-            !verify_renderpass_compatibility(dev_data, pCB->activeRenderPass->createInfo.ptr(), pPipeline->render_pass_ci.ptr(),
-                                             err_string)) {
+            !VerifyRenderPassCompatibility(dev_data, pCB->activeRenderPass->compatibility_class,
+                                           pCB->activeRenderPass->createInfo.ptr(), pPipeline->render_pass_compatibility_class,
+                                           pPipeline->render_pass_ci.ptr(), err_string)) {
             // renderPass that PSO was created with must be compatible with active renderPass that PSO is being used with
             skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT,
                             reinterpret_cast<const uint64_t &>(pPipeline->pipeline), __LINE__, DRAWSTATE_RENDERPASS_INCOMPATIBLE,
@@ -2630,7 +2728,7 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, con
 
     // Now complete other state checks
     if (VK_NULL_HANDLE != state.pipeline_layout.layout) {
-        string errorString;
+        cvdescriptorset::DescriptorSetFailure failure;
         auto pipeline_layout = pPipe->pipeline_layout;
 
         for (const auto &set_binding_pair : pPipe->active_slots) {
@@ -2642,29 +2740,36 @@ static bool ValidateDrawState(layer_data *dev_data, GLOBAL_CB_NODE *cb_node, con
                     reinterpret_cast<uint64_t>(cb_node->commandBuffer), __LINE__, DRAWSTATE_DESCRIPTOR_SET_NOT_BOUND, "DS",
                     "VkPipeline 0x%" PRIxLEAST64 " uses set #%u but that set is not bound.", (uint64_t)pPipe->pipeline, setIndex);
             } else if (!verify_set_layout_compatibility(state.boundDescriptorSets[setIndex], &pipeline_layout, setIndex,
-                                                        errorString)) {
+                                                        &failure)) {
                 // Set is bound but not compatible w/ overlapping pipeline_layout from PSO
                 VkDescriptorSet setHandle = state.boundDescriptorSets[setIndex]->GetSet();
-                result |=
-                    log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
-                            (uint64_t)setHandle, __LINE__, DRAWSTATE_PIPELINE_LAYOUTS_INCOMPATIBLE, "DS",
-                            "VkDescriptorSet (0x%" PRIxLEAST64
-                            ") bound as set #%u is not compatible with overlapping VkPipelineLayout 0x%" PRIxLEAST64 " due to: %s",
-                            reinterpret_cast<uint64_t &>(setHandle), setIndex, reinterpret_cast<uint64_t &>(pipeline_layout.layout),
-                            errorString.c_str());
+                auto format_msg = [&]() {
+                    std::stringstream ss;
+                    ss << "VkDescriptorSet (0x" << std::hex << (uint64_t)setHandle << std::dec << ") bound as set #" << setIndex
+                       << " is not compatible with overlapping VkPipelineLayout 0x" << std::hex
+                       << reinterpret_cast<uint64_t &>(pipeline_layout.layout) << std::dec << " due to: " << failure.Format();
+                    return ss.str();
+                };
+                result |= log_msg_deferred(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                           VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT, (uint64_t)setHandle, __LINE__,
+                                           DRAWSTATE_PIPELINE_LAYOUTS_INCOMPATIBLE, "DS", format_msg);
             } else {  // Valid set is bound and layout compatible, validate that it's updated
                 // Pull the set node
                 cvdescriptorset::DescriptorSet *descriptor_set = state.boundDescriptorSets[setIndex];
                 // Validate the draw-time state for this descriptor set
-                std::string err_str;
                 if (!descriptor_set->ValidateDrawState(set_binding_pair.second, state.dynamicOffsets[setIndex], cb_node, function,
-                                                       &err_str)) {
+                                                       &failure)) {
                     auto set = descriptor_set->GetSet();
-                    result |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
-                                      VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT, reinterpret_cast<const uint64_t &>(set),
-                                      __LINE__, DRAWSTATE_DESCRIPTOR_SET_NOT_UPDATED, "DS",
-                                      "Descriptor set 0x%" PRIxLEAST64 " encountered the following validation error at %s time: %s",
-                                      reinterpret_cast<const uint64_t &>(set), function, err_str.c_str());
+                    auto format_msg = [&]() {
+                        std::stringstream ss;
+                        ss << "Descriptor set 0x" << std::hex << reinterpret_cast<const uint64_t &>(set) << std::dec
+                           << " encountered the following validation error at " << function << " time: " << failure.Format();
+                        return ss.str();
+                    };
+                    result |= log_msg_deferred(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                               VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
+                                               reinterpret_cast<const uint64_t &>(set), __LINE__,
+                                               DRAWSTATE_DESCRIPTOR_SET_NOT_UPDATED, "DS", format_msg);
                 }
             }
         }
@@ -3016,6 +3121,7 @@ static bool validateIdleDescriptorSet(const layer_data *dev_data, VkDescriptorSe
 // Remove set from setMap and delete the set
 static void freeDescriptorSet(layer_data *dev_data, cvdescriptorset::DescriptorSet *descriptor_set) {
     dev_data->setMap.erase(descriptor_set->GetSet());
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t>(descriptor_set->GetSet()));
     delete descriptor_set;
 }
 // Free all DS Pools including their Sets & related sub-structs
@@ -3352,6 +3458,7 @@ bool outsideRenderPass(const layer_data *dev_data, GLOBAL_CB_NODE *pCB, const ch
 
 static void init_core_validation(instance_layer_data *instance_data, const VkAllocationCallbacks *pAllocator) {
     layer_debug_actions(instance_data->report_data, instance_data->logging_callback, pAllocator, "lunarg_core_validation");
+    instance_data->noncoherent_guard_pages = !strcmp(getLayerOption("lunarg_core_validation.noncoherent_guard_pages"), "true");
 }
 
 // For the given ValidationCheck enum, set all relevant instance disabled flags to true
@@ -3600,6 +3707,8 @@ VKAPI_ATTR void VKAPI_CALL DestroyDevice(VkDevice device, const VkAllocationCall
     dev_data->imageLayoutMap.clear();
     dev_data->bufferViewMap.clear();
     dev_data->bufferMap.clear();
+    // Memory the application never freed; this also releases the guard pages of any range still mapped
+    dev_data->memObjMap.clear();
     // Queues persist until device is destroyed
     dev_data->queueMap.clear();
     // Report any memory leaks
@@ -3718,14 +3827,16 @@ static bool VerifyQueueStateToSeq(layer_data *dev_data, QUEUE_STATE *initial_que
             for (auto cb : sub_it->cbs) {
                 auto cb_node = GetCBNode(dev_data, cb);
                 if (cb_node) {
-                    for (auto queryEventsPair : cb_node->waitedEventsBeforeQueryReset) {
-                        for (auto event : queryEventsPair.second) {
+                    for (auto &reset : cb_node->waitedEventsBeforeQueryReset) {
+                        for (auto event : reset.events) {
                             if (dev_data->eventMap[event].needsSignaled) {
-                                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
-                                                VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT, 0, 0, DRAWSTATE_INVALID_QUERY, "DS",
-                                                "Cannot get query results on queryPool 0x%" PRIx64
-                                                " with index %d which was guarded by unsignaled event 0x%" PRIx64 ".",
-                                                (uint64_t)(queryEventsPair.first.pool), queryEventsPair.first.index, (uint64_t)(event));
+                                for (uint32_t i = 0; i < reset.count; ++i) {
+                                    skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                                    VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT, 0, 0, DRAWSTATE_INVALID_QUERY, "DS",
+                                                    "Cannot get query results on queryPool 0x%" PRIx64
+                                                    " with index %d which was guarded by unsignaled event 0x%" PRIx64 ".",
+                                                    (uint64_t)(reset.pool), reset.first + i, (uint64_t)(event));
+                                }
                             }
                         }
                     }
@@ -3815,9 +3926,7 @@ static void RetireWorkOnQueue(layer_data *dev_data, QUEUE_STATE *pQueue, uint64_
                     eventNode->second.write_in_use--;
                 }
             }
-            for (auto queryStatePair : cb_node->queryToStateMap) {
-                dev_data->queryToStateMap[queryStatePair.first] = queryStatePair.second;
-            }
+            dev_data->queryToStateMap.Merge(cb_node->queryToStateMap);
             for (auto eventStagePair : cb_node->eventToStageMap) {
                 dev_data->eventMap[eventStagePair.first].stageMask = eventStagePair.second;
             }
@@ -4276,7 +4385,9 @@ static void PostCallRecordFreeMemory(layer_data *dev_data, VkDeviceMemory mem, D
     }
     // Any bound cmd buffers are now invalid
     invalidateCommandBuffers(dev_data, mem_info->cb_bindings, obj_struct);
+    // Freeing the memory implicitly unmaps it; erasing it releases any guarded mapping
     dev_data->memObjMap.erase(mem);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(mem));
 }
 
 VKAPI_ATTR void VKAPI_CALL FreeMemory(VkDevice device, VkDeviceMemory mem, const VkAllocationCallbacks *pAllocator) {
@@ -4360,6 +4471,7 @@ static bool deleteMemRanges(layer_data *dev_data, VkDeviceMemory mem) {
                            validation_error_map[VALIDATION_ERROR_00649]);
         }
         mem_info->mem_range.size = 0;
+        mem_info->guarded_mapping.reset();
         if (mem_info->shadow_copy) {
             free(mem_info->shadow_copy_base);
             mem_info->shadow_copy_base = 0;
@@ -4384,6 +4496,17 @@ static void initializeAndTrackMemory(layer_data *dev_data, VkDeviceMemory mem, V
             if (size == VK_WHOLE_SIZE) {
                 size = mem_info->alloc_info.allocationSize - offset;
             }
+            if (dev_data->instance_data->noncoherent_guard_pages) {
+                // Falls back to the shadow copy below if the mapping cannot be guarded
+                mem_info->guarded_mapping.reset(
+                    GuardedMapping::Create(*ppData, static_cast<size_t>(size), offset,
+                                           dev_data->phys_dev_properties.properties.limits.minMemoryMapAlignment,
+                                           NoncoherentMemoryFillValue));
+                if (mem_info->guarded_mapping) {
+                    *ppData = mem_info->guarded_mapping->data();
+                    return;
+                }
+            }
             mem_info->shadow_pad_size = dev_data->phys_dev_properties.properties.limits.minMemoryMapAlignment;
             assert(SafeModulo(mem_info->shadow_pad_size,
                                   dev_data->phys_dev_properties.properties.limits.minMemoryMapAlignment) == 0);
@@ -4595,7 +4718,10 @@ static bool PreCallValidateDestroyFence(layer_data *dev_data, VkFence fence, FEN
     return skip;
 }
 
-static void PostCallRecordDestroyFence(layer_data *dev_data, VkFence fence) { dev_data->fenceMap.erase(fence); }
+static void PostCallRecordDestroyFence(layer_data *dev_data, VkFence fence) {
+    dev_data->fenceMap.erase(fence);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(fence));
+}
 
 VKAPI_ATTR void VKAPI_CALL DestroyFence(VkDevice device, VkFence fence, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
@@ -4625,7 +4751,10 @@ static bool PreCallValidateDestroySemaphore(layer_data *dev_data, VkSemaphore se
     return skip;
 }
 
-static void PostCallRecordDestroySemaphore(layer_data *dev_data, VkSemaphore sema) { dev_data->semaphoreMap.erase(sema); }
+static void PostCallRecordDestroySemaphore(layer_data *dev_data, VkSemaphore sema) {
+    dev_data->semaphoreMap.erase(sema);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(sema));
+}
 
 VKAPI_ATTR void VKAPI_CALL DestroySemaphore(VkDevice device, VkSemaphore semaphore, const VkAllocationCallbacks *pAllocator) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
@@ -4655,6 +4784,7 @@ static bool PreCallValidateDestroyEvent(layer_data *dev_data, VkEvent event, EVE
 static void PostCallRecordDestroyEvent(layer_data *dev_data, VkEvent event, EVENT_STATE *event_state, VK_OBJECT obj_struct) {
     invalidateCommandBuffers(dev_data, event_state->cb_bindings, obj_struct);
     dev_data->eventMap.erase(event);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(event));
 }
 
 VKAPI_ATTR void VKAPI_CALL DestroyEvent(VkDevice device, VkEvent event, const VkAllocationCallbacks *pAllocator) {
@@ -4688,7 +4818,12 @@ static bool PreCallValidateDestroyQueryPool(layer_data *dev_data, VkQueryPool qu
 static void PostCallRecordDestroyQueryPool(layer_data *dev_data, VkQueryPool query_pool, QUERY_POOL_NODE *qp_state,
                                            VK_OBJECT obj_struct) {
     invalidateCommandBuffers(dev_data, qp_state->cb_bindings, obj_struct);
+    dev_data->queryToStateMap.ErasePool(query_pool);
+    for (auto &queue_data : dev_data->queueMap) {
+        queue_data.second.queryToStateMap.ErasePool(query_pool);
+    }
     dev_data->queryPoolMap.erase(query_pool);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(query_pool));
 }
 
 VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(VkDevice device, VkQueryPool queryPool, const VkAllocationCallbacks *pAllocator) {
@@ -4706,29 +4841,75 @@ VKAPI_ATTR void VKAPI_CALL DestroyQueryPool(VkDevice device, VkQueryPool queryPo
         }
     }
 }
+
+// The number of queries of a range that are in the pool; commands that name the others report them
+static uint32_t QueriesInPool(layer_data *dev_data, VkQueryPool query_pool, uint32_t first_query, uint32_t query_count) {
+    QUERY_POOL_NODE *pool_state = GetQueryPoolNode(dev_data, query_pool);
+    if (!pool_state || first_query >= pool_state->createInfo.queryCount) return 0;
+    return std::min(query_count, pool_state->createInfo.queryCount - first_query);
+}
+
+// Reports queries that are not in the pool: first_error when the first query is past its end, range_error when the
+// range runs past it. The end of the range is computed in 64 bits, so that it can't wrap around.
+static bool ValidateQueryRange(layer_data *dev_data, VkCommandBuffer command_buffer, VkQueryPool query_pool, uint32_t first_query,
+                               uint32_t query_count, const char *caller, UNIQUE_VALIDATION_ERROR_CODE first_error,
+                               UNIQUE_VALIDATION_ERROR_CODE range_error) {
+    QUERY_POOL_NODE *pool_state = GetQueryPoolNode(dev_data, query_pool);
+    if (!pool_state) return false;
+    const uint32_t pool_size = pool_state->createInfo.queryCount;
+    const VkDebugReportObjectTypeEXT object_type =
+        command_buffer ? VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT : VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT;
+    const uint64_t object = command_buffer ? reinterpret_cast<uint64_t>(command_buffer) : reinterpret_cast<uint64_t &>(query_pool);
+    if (first_query >= pool_size) {
+        return log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, object_type, object, __LINE__, first_error, "DS",
+                       "%s: query %u is past the end of queryPool 0x%" PRIx64 ", which has %u queries. %s", caller, first_query,
+                       reinterpret_cast<uint64_t &>(query_pool), pool_size, validation_error_map[first_error]);
+    }
+    if (static_cast<uint64_t>(first_query) + query_count > pool_size) {
+        return log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, object_type, object, __LINE__, range_error, "DS",
+                       "%s: queries %u to %" PRIu64 " run past the end of queryPool 0x%" PRIx64 ", which has %u queries. %s",
+                       caller, first_query, static_cast<uint64_t>(first_query) + query_count - 1,
+                       reinterpret_cast<uint64_t &>(query_pool), pool_size, validation_error_map[range_error]);
+    }
+    return false;
+}
+
+// Returns the events the command buffer had waited on when it last reset query, or nullptr if it did not reset it
+static const unordered_set<VkEvent> *GetEventsWaitedBeforeQueryReset(GLOBAL_CB_NODE const *cb_node, QueryObject query) {
+    for (auto reset = cb_node->waitedEventsBeforeQueryReset.rbegin(); reset != cb_node->waitedEventsBeforeQueryReset.rend();
+         ++reset) {
+        if (reset->pool == query.pool && query.index >= reset->first && query.index - reset->first < reset->count) {
+            return &reset->events;
+        }
+    }
+    return nullptr;
+}
+
 static bool PreCallValidateGetQueryPoolResults(layer_data *dev_data, VkQueryPool query_pool, uint32_t first_query,
                                                uint32_t query_count, VkQueryResultFlags flags,
                                                unordered_map<QueryObject, vector<VkCommandBuffer>> *queries_in_flight) {
+    const uint32_t pool_query_count = QueriesInPool(dev_data, query_pool, first_query, query_count);
     for (auto cmd_buffer : dev_data->globalInFlightCmdBuffers) {
         auto cb = GetCBNode(dev_data, cmd_buffer);
-        for (auto query_state_pair : cb->queryToStateMap) {
-            (*queries_in_flight)[query_state_pair.first].push_back(cmd_buffer);
+        for (uint32_t i = 0; i < pool_query_count; ++i) {
+            if (cb->queryToStateMap.Get(query_pool, first_query + i) != QueryStateMap::kUnknown) {
+                (*queries_in_flight)[{query_pool, first_query + i}].push_back(cmd_buffer);
+            }
         }
     }
     if (dev_data->instance_data->disabled.get_query_pool_results) return false;
-    bool skip = false;
-    for (uint32_t i = 0; i < query_count; ++i) {
+    bool skip = ValidateQueryRange(dev_data, VK_NULL_HANDLE, query_pool, first_query, query_count, "vkGetQueryPoolResults()",
+                                   VALIDATION_ERROR_01048, VALIDATION_ERROR_01051);
+    for (uint32_t i = 0; i < pool_query_count; ++i) {
         QueryObject query = {query_pool, first_query + i};
         auto qif_pair = queries_in_flight->find(query);
-        auto query_state_pair = dev_data->queryToStateMap.find(query);
-        if (query_state_pair != dev_data->queryToStateMap.end()) {
+        auto query_state = dev_data->queryToStateMap.Get(query_pool, query.index);
+        if (query_state != QueryStateMap::kUnknown) {
             // Available and in flight
-            if (qif_pair != queries_in_flight->end() && query_state_pair != dev_data->queryToStateMap.end() &&
-                query_state_pair->second) {
+            if (qif_pair != queries_in_flight->end() && query_state == QueryStateMap::kAvailable) {
                 for (auto cmd_buffer : qif_pair->second) {
                     auto cb = GetCBNode(dev_data, cmd_buffer);
-                    auto query_event_pair = cb->waitedEventsBeforeQueryReset.find(query);
-                    if (query_event_pair == cb->waitedEventsBeforeQueryReset.end()) {
+                    if (!GetEventsWaitedBeforeQueryReset(cb, query)) {
                         skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
                                         VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT, 0, __LINE__, DRAWSTATE_INVALID_QUERY, "DS",
                                         "Cannot get query results on queryPool 0x%" PRIx64 " with index %d which is in flight.",
@@ -4736,13 +4917,12 @@ static bool PreCallValidateGetQueryPoolResults(layer_data *dev_data, VkQueryPool
                     }
                 }
                 // Unavailable and in flight
-            } else if (qif_pair != queries_in_flight->end() && query_state_pair != dev_data->queryToStateMap.end() &&
-                       !query_state_pair->second) {
+            } else if (qif_pair != queries_in_flight->end() && query_state == QueryStateMap::kUnavailable) {
                 // TODO : Can there be the same query in use by multiple command buffers in flight?
                 bool make_available = false;
                 for (auto cmd_buffer : qif_pair->second) {
                     auto cb = GetCBNode(dev_data, cmd_buffer);
-                    make_available |= cb->queryToStateMap[query];
+                    make_available |= cb->queryToStateMap.Get(query_pool, query.index) == QueryStateMap::kAvailable;
                 }
                 if (!(((flags & VK_QUERY_RESULT_PARTIAL_BIT) || (flags & VK_QUERY_RESULT_WAIT_BIT)) && make_available)) {
                     skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
@@ -4751,13 +4931,13 @@ static bool PreCallValidateGetQueryPoolResults(layer_data *dev_data, VkQueryPool
                                     (uint64_t)(query_pool), first_query + i);
                 }
                 // Unavailable
-            } else if (query_state_pair != dev_data->queryToStateMap.end() && !query_state_pair->second) {
+            } else if (query_state == QueryStateMap::kUnavailable) {
                 skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT, 0,
                                 __LINE__, DRAWSTATE_INVALID_QUERY, "DS",
                                 "Cannot get query results on queryPool 0x%" PRIx64 " with index %d which is unavailable.",
                                 (uint64_t)(query_pool), first_query + i);
                 // Uninitialized
-            } else if (query_state_pair == dev_data->queryToStateMap.end()) {
+            } else if (query_state == QueryStateMap::kUnknown) {
                 skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT, 0,
                                 __LINE__, DRAWSTATE_INVALID_QUERY, "DS",
                                 "Cannot get query results on queryPool 0x%" PRIx64
@@ -4772,19 +4952,18 @@ static bool PreCallValidateGetQueryPoolResults(layer_data *dev_data, VkQueryPool
 static void PostCallRecordGetQueryPoolResults(layer_data *dev_data, VkQueryPool query_pool, uint32_t first_query,
                                               uint32_t query_count,
                                               unordered_map<QueryObject, vector<VkCommandBuffer>> *queries_in_flight) {
-    for (uint32_t i = 0; i < query_count; ++i) {
+    const uint32_t pool_query_count = QueriesInPool(dev_data, query_pool, first_query, query_count);
+    for (uint32_t i = 0; i < pool_query_count; ++i) {
         QueryObject query = {query_pool, first_query + i};
         auto qif_pair = queries_in_flight->find(query);
-        auto query_state_pair = dev_data->queryToStateMap.find(query);
-        if (query_state_pair != dev_data->queryToStateMap.end()) {
+        if (dev_data->queryToStateMap.Get(query_pool, query.index) == QueryStateMap::kAvailable) {
             // Available and in flight
-            if (qif_pair != queries_in_flight->end() && query_state_pair != dev_data->queryToStateMap.end() &&
-                query_state_pair->second) {
+            if (qif_pair != queries_in_flight->end()) {
                 for (auto cmd_buffer : qif_pair->second) {
                     auto cb = GetCBNode(dev_data, cmd_buffer);
-                    auto query_event_pair = cb->waitedEventsBeforeQueryReset.find(query);
-                    if (query_event_pair != cb->waitedEventsBeforeQueryReset.end()) {
-                        for (auto event : query_event_pair->second) {
+                    auto events = GetEventsWaitedBeforeQueryReset(cb, query);
+                    if (events) {
+                        for (auto event : *events) {
                             dev_data->eventMap[event].needsSignaled = true;
                         }
                     }
@@ -5234,6 +5413,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyShaderModule(VkDevice device, VkShaderModule s
 
     std::unique_lock<std::mutex> lock(global_lock);
     dev_data->shaderModuleMap.erase(shaderModule);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(shaderModule));
     lock.unlock();
 
     dev_data->dispatch_table.DestroyShaderModule(device, shaderModule, pAllocator);
@@ -5256,6 +5436,7 @@ static void PostCallRecordDestroyPipeline(layer_data *dev_data, VkPipeline pipel
     // Any bound cmd buffers are now invalid
     invalidateCommandBuffers(dev_data, pipeline_state->cb_bindings, obj_struct);
     dev_data->pipelineMap.erase(pipeline);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(pipeline));
 }
 
 VKAPI_ATTR void VKAPI_CALL DestroyPipeline(VkDevice device, VkPipeline pipeline, const VkAllocationCallbacks *pAllocator) {
@@ -5279,6 +5460,7 @@ VKAPI_ATTR void VKAPI_CALL DestroyPipelineLayout(VkDevice device, VkPipelineLayo
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
     std::unique_lock<std::mutex> lock(global_lock);
     dev_data->pipelineLayoutMap.erase(pipelineLayout);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(pipelineLayout));
     lock.unlock();
 
     dev_data->dispatch_table.DestroyPipelineLayout(device, pipelineLayout, pAllocator);
@@ -5301,6 +5483,7 @@ static void PostCallRecordDestroySampler(layer_data *dev_data, VkSampler sampler
     // Any bound cmd buffers are now invalid
     if (sampler_state) invalidateCommandBuffers(dev_data, sampler_state->cb_bindings, obj_struct);
     dev_data->samplerMap.erase(sampler);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(sampler));
 }
 
 VKAPI_ATTR void VKAPI_CALL DestroySampler(VkDevice device, VkSampler sampler, const VkAllocationCallbacks *pAllocator) {
@@ -5321,6 +5504,7 @@ VKAPI_ATTR void VKAPI_CALL DestroySampler(VkDevice device, VkSampler sampler, co
 
 static void PostCallRecordDestroyDescriptorSetLayout(layer_data *dev_data, VkDescriptorSetLayout ds_layout) {
     dev_data->descriptorSetLayoutMap.erase(ds_layout);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(ds_layout));
 }
 
 VKAPI_ATTR void VKAPI_CALL DestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout,
@@ -5352,6 +5536,7 @@ static void PostCallRecordDestroyDescriptorPool(layer_data *dev_data, VkDescript
         freeDescriptorSet(dev_data, ds);
     }
     dev_data->descriptorPoolMap.erase(descriptorPool);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(descriptorPool));
 }
 
 VKAPI_ATTR void VKAPI_CALL DestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool,
@@ -5433,6 +5618,7 @@ VKAPI_ATTR void VKAPI_CALL FreeCommandBuffers(VkDevice device, VkCommandPool com
             // reset prior to delete for data clean-up
             resetCB(dev_data, cb_node->commandBuffer);
             dev_data->commandBufferMap.erase(cb_node->commandBuffer);
+            debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t>(cb_node->commandBuffer));
             delete cb_node;
         }
 
@@ -5511,9 +5697,11 @@ static void PostCallRecordDestroyCommandPool(layer_data *dev_data, VkCommandPool
             if (fb_state) fb_state->cb_bindings.erase(cb_node);
         }
         dev_data->commandBufferMap.erase(cb);  // Remove this command buffer
+        debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t>(cb));
         delete cb_node;                        // delete CB info structure
     }
     dev_data->commandPoolMap.erase(pool);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(pool));
 }
 
 // Destroy commandPool along with all of the commandBuffers allocated from that pool
@@ -5619,6 +5807,7 @@ static void PostCallRecordDestroyFramebuffer(layer_data *dev_data, VkFramebuffer
                                              VK_OBJECT obj_struct) {
     invalidateCommandBuffers(dev_data, framebuffer_state->cb_bindings, obj_struct);
     dev_data->frameBufferMap.erase(framebuffer);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(framebuffer));
 }
 
 VKAPI_ATTR void VKAPI_CALL DestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, const VkAllocationCallbacks *pAllocator) {
@@ -5653,6 +5842,7 @@ static void PostCallRecordDestroyRenderPass(layer_data *dev_data, VkRenderPass r
                                             VK_OBJECT obj_struct) {
     invalidateCommandBuffers(dev_data, rp_state->cb_bindings, obj_struct);
     dev_data->renderPassMap.erase(render_pass);
+    debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(render_pass));
 }
 
 VKAPI_ATTR void VKAPI_CALL DestroyRenderPass(VkDevice device, VkRenderPass renderPass, const VkAllocationCallbacks *pAllocator) {
@@ -5939,7 +6129,9 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(VkDevice device, VkPipeli
     for (i = 0; i < count; i++) {
         pipe_state[i] = new PIPELINE_STATE;
         pipe_state[i]->initGraphicsPipeline(&pCreateInfos[i]);
-        pipe_state[i]->render_pass_ci.initialize(GetRenderPassState(dev_data, pCreateInfos[i].renderPass)->createInfo.ptr());
+        auto render_pass_state = GetRenderPassState(dev_data, pCreateInfos[i].renderPass);
+        pipe_state[i]->render_pass_ci.initialize(render_pass_state->createInfo.ptr());
+        pipe_state[i]->render_pass_compatibility_class = render_pass_state->compatibility_class;
         pipe_state[i]->pipeline_layout = *getPipelineLayout(dev_data, pCreateInfos[i].layout);
     }
     skip |= PreCallCreateGraphicsPipelines(dev_data, count, pCreateInfos, pipe_state);
@@ -6467,10 +6659,12 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(VkCommandBuffer commandBuffer,
                     string errorString = "";
                     auto framebuffer = GetFramebufferState(dev_data, pInfo->framebuffer);
                     if (framebuffer) {
+                        auto inherited_rp_state = GetRenderPassState(dev_data, pInfo->renderPass);
                         if ((framebuffer->createInfo.renderPass != pInfo->renderPass) &&
-                            !verify_renderpass_compatibility(dev_data, framebuffer->renderPassCreateInfo.ptr(),
-                                                             GetRenderPassState(dev_data, pInfo->renderPass)->createInfo.ptr(),
-                                                             errorString)) {
+                            !VerifyRenderPassCompatibility(dev_data, framebuffer->render_pass_compatibility_class,
+                                                           framebuffer->renderPassCreateInfo.ptr(),
+                                                           inherited_rp_state->compatibility_class,
+                                                           inherited_rp_state->createInfo.ptr(), errorString)) {
                             // renderPass that framebuffer was created with must be compatible with local renderPass
                             skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
                                             VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
@@ -6843,7 +7037,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
         skip |= ValidateCmd(dev_data, cb_state, CMD_BINDDESCRIPTORSETS, "vkCmdBindDescriptorSets()");
         // Track total count of dynamic descriptor types to make sure we have an offset for each one
         uint32_t total_dynamic_descriptors = 0;
-        string error_string = "";
+        cvdescriptorset::DescriptorSetFailure failure;
         uint32_t last_set_index = firstSet + setCount - 1;
         if (last_set_index >= cb_state->lastBound[pipelineBindPoint].boundDescriptorSets.size()) {
             cb_state->lastBound[pipelineBindPoint].boundDescriptorSets.resize(last_set_index + 1);
@@ -6869,14 +7063,18 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
                                     (uint64_t)pDescriptorSets[set_idx]);
                 }
                 // Verify that set being bound is compatible with overlapping setLayout of pipelineLayout
-                if (!verify_set_layout_compatibility(descriptor_set, pipeline_layout, set_idx + firstSet, error_string)) {
-                    skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
-                                    VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT, (uint64_t)pDescriptorSets[set_idx], __LINE__,
-                                    VALIDATION_ERROR_00974, "DS",
-                                    "descriptorSet #%u being bound is not compatible with overlapping descriptorSetLayout "
-                                    "at index %u of pipelineLayout 0x%" PRIxLEAST64 " due to: %s. %s",
-                                    set_idx, set_idx + firstSet, reinterpret_cast<uint64_t &>(layout), error_string.c_str(),
-                                    validation_error_map[VALIDATION_ERROR_00974]);
+                if (!verify_set_layout_compatibility(descriptor_set, pipeline_layout, set_idx + firstSet, &failure)) {
+                    auto format_msg = [&]() {
+                        std::stringstream ss;
+                        ss << "descriptorSet #" << set_idx << " being bound is not compatible with overlapping descriptorSetLayout "
+                           << "at index " << set_idx + firstSet << " of pipelineLayout 0x" << std::hex
+                           << reinterpret_cast<uint64_t &>(layout) << std::dec << " due to: " << failure.Format() << ". "
+                           << validation_error_map[VALIDATION_ERROR_00974];
+                        return ss.str();
+                    };
+                    skip |= log_msg_deferred(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                             VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT, (uint64_t)pDescriptorSets[set_idx],
+                                             __LINE__, VALIDATION_ERROR_00974, "DS", format_msg);
                 }
 
                 auto set_dynamic_descriptor_count = descriptor_set->GetDynamicDescriptorCount();
@@ -6948,7 +7146,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
                 for (uint32_t i = 0; i < firstSet; ++i) {
                     if (cb_state->lastBound[pipelineBindPoint].boundDescriptorSets[i] &&
                         !verify_set_layout_compatibility(cb_state->lastBound[pipelineBindPoint].boundDescriptorSets[i],
-                                                         pipeline_layout, i, error_string)) {
+                                                         pipeline_layout, i, &failure)) {
                         skip |= log_msg(
                             dev_data->report_data, VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT,
                             VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT,
@@ -6963,7 +7161,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBindDescriptorSets(VkCommandBuffer commandBuffer,
             // Check if newly last bound set invalidates any remaining bound sets
             if ((cb_state->lastBound[pipelineBindPoint].boundDescriptorSets.size() - 1) > (last_set_index)) {
                 if (old_final_bound_set &&
-                    !verify_set_layout_compatibility(old_final_bound_set, pipeline_layout, last_set_index, error_string)) {
+                    !verify_set_layout_compatibility(old_final_bound_set, pipeline_layout, last_set_index, &failure)) {
                     auto old_set = old_final_bound_set->GetSet();
                     skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT,
                                     VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT, reinterpret_cast<uint64_t &>(old_set), __LINE__,
@@ -8050,15 +8248,19 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(VkCommandBuffer commandBuffer, VkP
     }
 }
 
-bool setQueryState(VkQueue queue, VkCommandBuffer commandBuffer, QueryObject object, bool value) {
+bool setQueryState(VkQueue queue, VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount,
+                   bool value) {
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(commandBuffer), layer_data_map);
+    QUERY_POOL_NODE *pool_state = GetQueryPoolNode(dev_data, queryPool);
+    if (!pool_state) return false;
+    const uint32_t pool_size = pool_state->createInfo.queryCount;
     GLOBAL_CB_NODE *pCB = GetCBNode(dev_data, commandBuffer);
     if (pCB) {
-        pCB->queryToStateMap[object] = value;
+        pCB->queryToStateMap.Set(queryPool, pool_size, firstQuery, queryCount, value);
     }
     auto queue_data = dev_data->queueMap.find(queue);
     if (queue_data != dev_data->queueMap.end()) {
-        queue_data->second.queryToStateMap[object] = value;
+        queue_data->second.queryToStateMap.Set(queryPool, pool_size, firstQuery, queryCount, value);
     }
     return false;
 }
@@ -8076,6 +8278,8 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryP
         }
         skip |= ValidateCmdQueueFlags(dev_data, pCB, "vkCmdBeginQuery()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_01039);
+        skip |= ValidateQueryRange(dev_data, commandBuffer, queryPool, slot, 1, "vkCmdBeginQuery()", VALIDATION_ERROR_01031,
+                                   VALIDATION_ERROR_01031);
         skip |= ValidateCmd(dev_data, pCB, CMD_BEGINQUERY, "vkCmdBeginQuery()");
         UpdateCmdBufferLastCmd(pCB, CMD_BEGINQUERY);
         addCommandBufferBinding(&GetQueryPoolNode(dev_data, queryPool)->cb_bindings,
@@ -8100,10 +8304,13 @@ VKAPI_ATTR void VKAPI_CALL CmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPoo
         } else {
             cb_state->activeQueries.erase(query);
         }
-        std::function<bool(VkQueue)> query_update = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, true);
+        std::function<bool(VkQueue)> query_update =
+            std::bind(setQueryState, std::placeholders::_1, commandBuffer, queryPool, slot, 1, true);
         cb_state->queryUpdates.push_back(query_update);
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "VkCmdEndQuery()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_01046);
+        skip |= ValidateQueryRange(dev_data, commandBuffer, queryPool, slot, 1, "vkCmdEndQuery()", VALIDATION_ERROR_01042,
+                                   VALIDATION_ERROR_01042);
         skip |= ValidateCmd(dev_data, cb_state, CMD_ENDQUERY, "VkCmdEndQuery()");
         UpdateCmdBufferLastCmd(cb_state, CMD_ENDQUERY);
         addCommandBufferBinding(&GetQueryPoolNode(dev_data, queryPool)->cb_bindings,
@@ -8120,15 +8327,14 @@ VKAPI_ATTR void VKAPI_CALL CmdResetQueryPool(VkCommandBuffer commandBuffer, VkQu
     std::unique_lock<std::mutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
-        for (uint32_t i = 0; i < queryCount; i++) {
-            QueryObject query = {queryPool, firstQuery + i};
-            cb_state->waitedEventsBeforeQueryReset[query] = cb_state->waitedEvents;
-            std::function<bool(VkQueue)> query_update =
-                std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, false);
-            cb_state->queryUpdates.push_back(query_update);
-        }
+        cb_state->waitedEventsBeforeQueryReset.push_back({queryPool, firstQuery, queryCount, cb_state->waitedEvents});
+        std::function<bool(VkQueue)> query_update =
+            std::bind(setQueryState, std::placeholders::_1, commandBuffer, queryPool, firstQuery, queryCount, false);
+        cb_state->queryUpdates.push_back(query_update);
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "VkCmdResetQueryPool()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_01024);
+        skip |= ValidateQueryRange(dev_data, commandBuffer, queryPool, firstQuery, queryCount, "vkCmdResetQueryPool()",
+                                   VALIDATION_ERROR_01019, VALIDATION_ERROR_01020);
         skip |= ValidateCmd(dev_data, cb_state, CMD_RESETQUERYPOOL, "VkCmdResetQueryPool()");
         UpdateCmdBufferLastCmd(cb_state, CMD_RESETQUERYPOOL);
         skip |= insideRenderPass(dev_data, cb_state, "vkCmdResetQueryPool()", VALIDATION_ERROR_01025);
@@ -8144,30 +8350,15 @@ bool validateQuery(VkQueue queue, GLOBAL_CB_NODE *pCB, VkQueryPool queryPool, ui
     layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(pCB->commandBuffer), layer_data_map);
     auto queue_data = dev_data->queueMap.find(queue);
     if (queue_data == dev_data->queueMap.end()) return false;
-    for (uint32_t i = 0; i < queryCount; i++) {
-        QueryObject query = {queryPool, firstQuery + i};
-        auto query_data = queue_data->second.queryToStateMap.find(query);
-        bool fail = false;
-        if (query_data != queue_data->second.queryToStateMap.end()) {
-            if (!query_data->second) {
-                fail = true;
-            }
-        } else {
-            auto global_query_data = dev_data->queryToStateMap.find(query);
-            if (global_query_data != dev_data->queryToStateMap.end()) {
-                if (!global_query_data->second) {
-                    fail = true;
-                }
-            } else {
-                fail = true;
-            }
-        }
-        if (fail) {
-            skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
-                            reinterpret_cast<uint64_t>(pCB->commandBuffer), __LINE__, DRAWSTATE_INVALID_QUERY, "DS",
-                            "Requesting a copy from query to buffer with invalid query: queryPool 0x%" PRIx64 ", index %d",
-                            reinterpret_cast<uint64_t &>(queryPool), firstQuery + i);
-        }
+    const uint32_t end = firstQuery + QueriesInPool(dev_data, queryPool, firstQuery, queryCount);
+    // State recorded on this queue takes precedence over state from completed submissions
+    const QueryStateMap &queue_queries = queue_data->second.queryToStateMap;
+    for (uint32_t query = queue_queries.FirstUnavailable(queryPool, firstQuery, end - firstQuery, dev_data->queryToStateMap);
+         query < end; query = queue_queries.FirstUnavailable(queryPool, query + 1, end - query - 1, dev_data->queryToStateMap)) {
+        skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                        reinterpret_cast<uint64_t>(pCB->commandBuffer), __LINE__, DRAWSTATE_INVALID_QUERY, "DS",
+                        "Requesting a copy from query to buffer with invalid query: queryPool 0x%" PRIx64 ", index %d",
+                        reinterpret_cast<uint64_t &>(queryPool), query);
     }
     return skip;
 }
@@ -8198,6 +8389,8 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyQueryPoolResults(VkCommandBuffer commandBuffer
         cb_node->queryUpdates.push_back(query_update);
         skip |= ValidateCmdQueueFlags(dev_data, cb_node, "vkCmdCopyQueryPoolResults()",
                                       VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT, VALIDATION_ERROR_01073);
+        skip |= ValidateQueryRange(dev_data, commandBuffer, queryPool, firstQuery, queryCount, "vkCmdCopyQueryPoolResults()",
+                                   VALIDATION_ERROR_01061, VALIDATION_ERROR_01062);
         skip |= ValidateCmd(dev_data, cb_node, CMD_COPYQUERYPOOLRESULTS, "vkCmdCopyQueryPoolResults()");
         UpdateCmdBufferLastCmd(cb_node, CMD_COPYQUERYPOOLRESULTS);
         skip |= insideRenderPass(dev_data, cb_node, "vkCmdCopyQueryPoolResults()", VALIDATION_ERROR_01074);
@@ -8264,11 +8457,18 @@ VKAPI_ATTR void VKAPI_CALL CmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPi
     std::unique_lock<std::mutex> lock(global_lock);
     GLOBAL_CB_NODE *cb_state = GetCBNode(dev_data, commandBuffer);
     if (cb_state) {
-        QueryObject query = {queryPool, slot};
-        std::function<bool(VkQueue)> query_update = std::bind(setQueryState, std::placeholders::_1, commandBuffer, query, true);
+        std::function<bool(VkQueue)> query_update =
+            std::bind(setQueryState, std::placeholders::_1, commandBuffer, queryPool, slot, 1, true);
         cb_state->queryUpdates.push_back(query_update);
         skip |= ValidateCmdQueueFlags(dev_data, cb_state, "vkCmdWriteTimestamp()", VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT,
                                       VALIDATION_ERROR_01082);
+        QUERY_POOL_NODE *pool_state = GetQueryPoolNode(dev_data, queryPool);
+        if (pool_state && slot >= pool_state->createInfo.queryCount) {
+            skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
+                            reinterpret_cast<uint64_t>(commandBuffer), __LINE__, DRAWSTATE_INVALID_QUERY, "DS",
+                            "vkCmdWriteTimestamp(): query %u is past the end of queryPool 0x%" PRIx64 ", which has %u queries.",
+                            slot, reinterpret_cast<uint64_t &>(queryPool), pool_state->createInfo.queryCount);
+        }
         skip |= ValidateCmd(dev_data, cb_state, CMD_WRITETIMESTAMP, "vkCmdWriteTimestamp()");
         UpdateCmdBufferLastCmd(cb_state, CMD_WRITETIMESTAMP);
     }
@@ -8480,8 +8680,9 @@ static bool PreCallValidateCreateFramebuffer(layer_data *dev_data, const VkFrame
 // CreateFramebuffer state has been validated and call down chain completed so record new framebuffer object
 static void PostCallRecordCreateFramebuffer(layer_data *dev_data, const VkFramebufferCreateInfo *pCreateInfo, VkFramebuffer fb) {
     // Shadow create info and store in map
-    std::unique_ptr<FRAMEBUFFER_STATE> fb_state(
-        new FRAMEBUFFER_STATE(fb, pCreateInfo, dev_data->renderPassMap[pCreateInfo->renderPass]->createInfo.ptr()));
+    auto const &render_pass_state = dev_data->renderPassMap[pCreateInfo->renderPass];
+    std::unique_ptr<FRAMEBUFFER_STATE> fb_state(new FRAMEBUFFER_STATE(fb, pCreateInfo, render_pass_state->createInfo.ptr()));
+    fb_state->render_pass_compatibility_class = render_pass_state->compatibility_class;
 
     for (uint32_t i = 0; i < pCreateInfo->attachmentCount; ++i) {
         VkImageView view = pCreateInfo->pAttachments[i];
@@ -8517,52 +8718,28 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(VkDevice device, const VkFrameb
     return result;
 }
 
-static bool FindDependency(const uint32_t index, const uint32_t dependent, const std::vector<DAGNode> &subpass_to_node,
-                           std::unordered_set<uint32_t> &processed_nodes) {
-    // If we have already checked this node we have not found a dependency path so return false.
-    if (processed_nodes.count(index)) return false;
-    processed_nodes.insert(index);
-    const DAGNode &node = subpass_to_node[index];
-    // Look for a dependency path. If one exists return true else recurse on the previous nodes.
-    if (std::find(node.prev.begin(), node.prev.end(), dependent) == node.prev.end()) {
-        for (auto elem : node.prev) {
-            if (FindDependency(elem, dependent, subpass_to_node, processed_nodes)) return true;
-        }
-    } else {
-        return true;
-    }
-    return false;
+// Returns true if a chain of subpass dependencies leads from subpass src to subpass dst
+static bool SubpassDependsOn(const RENDER_PASS_STATE *render_pass, const uint32_t dst, const uint32_t src) {
+    auto const &predecessors = render_pass->subpass_predecessors[dst];
+    return (predecessors[src / 64] >> (src % 64)) & 1;
 }
 
-static bool CheckDependencyExists(const layer_data *dev_data, const uint32_t subpass,
-                                  const std::vector<uint32_t> &dependent_subpasses, const std::vector<DAGNode> &subpass_to_node,
-                                  bool &skip) {
-    bool result = true;
-    // Loop through all subpasses that share the same attachment and make sure a dependency exists
-    for (uint32_t k = 0; k < dependent_subpasses.size(); ++k) {
-        if (static_cast<uint32_t>(subpass) == dependent_subpasses[k]) continue;
-        const DAGNode &node = subpass_to_node[subpass];
-        // Check for a specified dependency between the two nodes. If one exists we are done.
-        auto prev_elem = std::find(node.prev.begin(), node.prev.end(), dependent_subpasses[k]);
-        auto next_elem = std::find(node.next.begin(), node.next.end(), dependent_subpasses[k]);
-        if (prev_elem == node.prev.end() && next_elem == node.next.end()) {
-            // If no dependency exits an implicit dependency still might. If not, throw an error.
-            std::unordered_set<uint32_t> processed_nodes;
-            if (!(FindDependency(subpass, dependent_subpasses[k], subpass_to_node, processed_nodes) ||
-                  FindDependency(dependent_subpasses[k], subpass, subpass_to_node, processed_nodes))) {
-                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                                __LINE__, DRAWSTATE_INVALID_RENDERPASS, "DS",
-                                "A dependency between subpasses %d and %d must exist but one is not specified.", subpass,
-                                dependent_subpasses[k]);
-                result = false;
-            }
+// Record a missing dependency for each subpass that shares an attachment with subpass but is not ordered against it
+static void CheckDependencyExists(const RENDER_PASS_STATE *render_pass, const uint32_t subpass,
+                                  const std::vector<uint32_t> &dependent_subpasses,
+                                  std::vector<std::pair<uint32_t, uint32_t>> &missing_dependencies) {
+    for (auto dependent_subpass : dependent_subpasses) {
+        if (subpass == dependent_subpass) continue;
+        if (!SubpassDependsOn(render_pass, subpass, dependent_subpass) &&
+            !SubpassDependsOn(render_pass, dependent_subpass, subpass)) {
+            missing_dependencies.emplace_back(subpass, dependent_subpass);
         }
     }
-    return result;
 }
 
-static bool CheckPreserved(const layer_data *dev_data, const VkRenderPassCreateInfo *pCreateInfo, const int index,
-                           const uint32_t attachment, const std::vector<DAGNode> &subpass_to_node, int depth, bool &skip) {
+static bool CheckPreserved(const VkRenderPassCreateInfo *pCreateInfo, const int index, const uint32_t attachment,
+                           const std::vector<DAGNode> &subpass_to_node, int depth,
+                           std::vector<std::pair<uint32_t, uint32_t>> &missing_preserves) {
     const DAGNode &node = subpass_to_node[index];
     // If this node writes to the attachment return true as next nodes need to preserve the attachment.
     const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[index];
@@ -8578,7 +8755,7 @@ static bool CheckPreserved(const layer_data *dev_data, const VkRenderPassCreateI
     bool result = false;
     // Loop through previous nodes and see if any of them write to the attachment.
     for (auto elem : node.prev) {
-        result |= CheckPreserved(dev_data, pCreateInfo, elem, attachment, subpass_to_node, depth + 1, skip);
+        result |= CheckPreserved(pCreateInfo, elem, attachment, subpass_to_node, depth + 1, missing_preserves);
     }
     // If the attachment was written to by a previous node than this node needs to preserve it.
     if (result && depth > 0) {
@@ -8590,14 +8767,72 @@ static bool CheckPreserved(const layer_data *dev_data, const VkRenderPassCreateI
             }
         }
         if (!has_preserved) {
-            skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                            __LINE__, DRAWSTATE_INVALID_RENDERPASS, "DS",
-                            "Attachment %d is used by a later subpass and must be preserved in subpass %d.", attachment, index);
+            missing_preserves.emplace_back(attachment, index);
         }
     }
     return result;
 }
 
+// Find the pairs of subpasses that use the same attachment, or attachments that alias each other, without a dependency
+// chain ordering them. overlapping_attachments lists for each attachment the attachments it aliases.
+static std::vector<std::pair<uint32_t, uint32_t>> FindMissingDependencies(
+    const RENDER_PASS_STATE *render_pass, const std::vector<std::vector<uint32_t>> &overlapping_attachments) {
+    auto const pCreateInfo = render_pass->createInfo.ptr();
+    std::vector<std::vector<uint32_t>> output_attachment_to_subpass(pCreateInfo->attachmentCount);
+    std::vector<std::vector<uint32_t>> input_attachment_to_subpass(pCreateInfo->attachmentCount);
+    // Find for each attachment the subpasses that use them.
+    for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
+        const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[i];
+        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
+            uint32_t attachment = subpass.pInputAttachments[j].attachment;
+            if (attachment >= pCreateInfo->attachmentCount) continue;
+            input_attachment_to_subpass[attachment].push_back(i);
+            for (auto overlapping_attachment : overlapping_attachments[attachment]) {
+                input_attachment_to_subpass[overlapping_attachment].push_back(i);
+            }
+        }
+        for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
+            uint32_t attachment = subpass.pColorAttachments[j].attachment;
+            if (attachment >= pCreateInfo->attachmentCount) continue;
+            output_attachment_to_subpass[attachment].push_back(i);
+            for (auto overlapping_attachment : overlapping_attachments[attachment]) {
+                output_attachment_to_subpass[overlapping_attachment].push_back(i);
+            }
+        }
+        if (subpass.pDepthStencilAttachment && subpass.pDepthStencilAttachment->attachment < pCreateInfo->attachmentCount) {
+            uint32_t attachment = subpass.pDepthStencilAttachment->attachment;
+            output_attachment_to_subpass[attachment].push_back(i);
+            for (auto overlapping_attachment : overlapping_attachments[attachment]) {
+                output_attachment_to_subpass[overlapping_attachment].push_back(i);
+            }
+        }
+    }
+    // If there is a dependency needed make sure one exists
+    std::vector<std::pair<uint32_t, uint32_t>> missing_dependencies;
+    for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
+        const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[i];
+        // If the attachment is an input then all subpasses that output must have a dependency relationship
+        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
+            uint32_t attachment = subpass.pInputAttachments[j].attachment;
+            if (attachment >= pCreateInfo->attachmentCount) continue;
+            CheckDependencyExists(render_pass, i, output_attachment_to_subpass[attachment], missing_dependencies);
+        }
+        // If the attachment is an output then all subpasses that use the attachment must have a dependency relationship
+        for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
+            uint32_t attachment = subpass.pColorAttachments[j].attachment;
+            if (attachment >= pCreateInfo->attachmentCount) continue;
+            CheckDependencyExists(render_pass, i, output_attachment_to_subpass[attachment], missing_dependencies);
+            CheckDependencyExists(render_pass, i, input_attachment_to_subpass[attachment], missing_dependencies);
+        }
+        if (subpass.pDepthStencilAttachment && subpass.pDepthStencilAttachment->attachment < pCreateInfo->attachmentCount) {
+            const uint32_t &attachment = subpass.pDepthStencilAttachment->attachment;
+            CheckDependencyExists(render_pass, i, output_attachment_to_subpass[attachment], missing_dependencies);
+            CheckDependencyExists(render_pass, i, input_attachment_to_subpass[attachment], missing_dependencies);
+        }
+    }
+    return missing_dependencies;
+}
+
 template <class T>
 bool isRangeOverlapping(T offset1, T size1, T offset2, T size2) {
     return (((offset1 + size1) > offset2) && ((offset1 + size1) < (offset2 + size2))) ||
@@ -8614,9 +8849,7 @@ static bool ValidateDependencies(const layer_data *dev_data, FRAMEBUFFER_STATE c
     bool skip = false;
     auto const pFramebufferInfo = framebuffer->createInfo.ptr();
     auto const pCreateInfo = renderPass->createInfo.ptr();
-    auto const &subpass_to_node = renderPass->subpassToNode;
-    std::vector<std::vector<uint32_t>> output_attachment_to_subpass(pCreateInfo->attachmentCount);
-    std::vector<std::vector<uint32_t>> input_attachment_to_subpass(pCreateInfo->attachmentCount);
+    bool has_overlap = false;
     std::vector<std::vector<uint32_t>> overlapping_attachments(pCreateInfo->attachmentCount);
     // Find overlapping attachments
     for (uint32_t i = 0; i < pCreateInfo->attachmentCount; ++i) {
@@ -8655,6 +8888,7 @@ static bool ValidateDependencies(const layer_data *dev_data, FRAMEBUFFER_STATE c
     }
     for (uint32_t i = 0; i < overlapping_attachments.size(); ++i) {
         uint32_t attachment = i;
+        has_overlap |= !overlapping_attachments[i].empty();
         for (auto other_attachment : overlapping_attachments[i]) {
             if (!(pCreateInfo->pAttachments[attachment].flags & VK_ATTACHMENT_DESCRIPTION_MAY_ALIAS_BIT)) {
                 skip |=
@@ -8674,72 +8908,30 @@ static bool ValidateDependencies(const layer_data *dev_data, FRAMEBUFFER_STATE c
             }
         }
     }
-    // Find for each attachment the subpasses that use them.
-    unordered_set<uint32_t> attachmentIndices;
-    for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
-        const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[i];
-        attachmentIndices.clear();
-        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
-            uint32_t attachment = subpass.pInputAttachments[j].attachment;
-            if (attachment == VK_ATTACHMENT_UNUSED) continue;
-            input_attachment_to_subpass[attachment].push_back(i);
-            for (auto overlapping_attachment : overlapping_attachments[attachment]) {
-                input_attachment_to_subpass[overlapping_attachment].push_back(i);
-            }
-        }
-        for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
-            uint32_t attachment = subpass.pColorAttachments[j].attachment;
-            if (attachment == VK_ATTACHMENT_UNUSED) continue;
-            output_attachment_to_subpass[attachment].push_back(i);
-            for (auto overlapping_attachment : overlapping_attachments[attachment]) {
-                output_attachment_to_subpass[overlapping_attachment].push_back(i);
-            }
-            attachmentIndices.insert(attachment);
-        }
-        if (subpass.pDepthStencilAttachment && subpass.pDepthStencilAttachment->attachment != VK_ATTACHMENT_UNUSED) {
-            uint32_t attachment = subpass.pDepthStencilAttachment->attachment;
-            output_attachment_to_subpass[attachment].push_back(i);
-            for (auto overlapping_attachment : overlapping_attachments[attachment]) {
-                output_attachment_to_subpass[overlapping_attachment].push_back(i);
-            }
-
-            if (attachmentIndices.count(attachment)) {
-                skip |=
-                    log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                            __LINE__, DRAWSTATE_INVALID_RENDERPASS, "DS",
-                            "Cannot use same attachment (%u) as both color and depth output in same subpass (%u).", attachment, i);
-            }
-        }
+    for (auto const &conflict : renderPass->color_depth_conflicts) {
+        skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                        DRAWSTATE_INVALID_RENDERPASS, "DS",
+                        "Cannot use same attachment (%u) as both color and depth output in same subpass (%u).", conflict.first,
+                        conflict.second);
     }
-    // If there is a dependency needed make sure one exists
-    for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
-        const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[i];
-        // If the attachment is an input then all subpasses that output must have a dependency relationship
-        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
-            uint32_t attachment = subpass.pInputAttachments[j].attachment;
-            if (attachment == VK_ATTACHMENT_UNUSED) continue;
-            CheckDependencyExists(dev_data, i, output_attachment_to_subpass[attachment], subpass_to_node, skip);
-        }
-        // If the attachment is an output then all subpasses that use the attachment must have a dependency relationship
-        for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
-            uint32_t attachment = subpass.pColorAttachments[j].attachment;
-            if (attachment == VK_ATTACHMENT_UNUSED) continue;
-            CheckDependencyExists(dev_data, i, output_attachment_to_subpass[attachment], subpass_to_node, skip);
-            CheckDependencyExists(dev_data, i, input_attachment_to_subpass[attachment], subpass_to_node, skip);
-        }
-        if (subpass.pDepthStencilAttachment && subpass.pDepthStencilAttachment->attachment != VK_ATTACHMENT_UNUSED) {
-            const uint32_t &attachment = subpass.pDepthStencilAttachment->attachment;
-            CheckDependencyExists(dev_data, i, output_attachment_to_subpass[attachment], subpass_to_node, skip);
-            CheckDependencyExists(dev_data, i, input_attachment_to_subpass[attachment], subpass_to_node, skip);
-        }
+    // The dependencies between subpasses using the same attachment were checked when the render pass was created. Aliasing
+    // between the framebuffer's attachments adds more pairs to check.
+    std::vector<std::pair<uint32_t, uint32_t>> aliased_missing_dependencies;
+    if (has_overlap) {
+        aliased_missing_dependencies = FindMissingDependencies(renderPass, overlapping_attachments);
     }
-    // Loop through implicit dependencies, if this pass reads make sure the attachment is preserved for all passes after it was
-    // written.
-    for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
-        const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[i];
-        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
-            CheckPreserved(dev_data, pCreateInfo, i, subpass.pInputAttachments[j].attachment, subpass_to_node, 0, skip);
-        }
+    for (auto const &missing : has_overlap ? aliased_missing_dependencies : renderPass->missing_dependencies) {
+        skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                        DRAWSTATE_INVALID_RENDERPASS, "DS",
+                        "A dependency between subpasses %d and %d must exist but one is not specified.", missing.first,
+                        missing.second);
+    }
+    // Implicit dependencies: if a pass reads an attachment it must be preserved by all passes after the one that wrote it
+    for (auto const &missing : renderPass->missing_preserves) {
+        skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0, __LINE__,
+                        DRAWSTATE_INVALID_RENDERPASS, "DS",
+                        "Attachment %d is used by a later subpass and must be preserved in subpass %d.", missing.first,
+                        missing.second);
     }
     return skip;
 }
@@ -8910,14 +9102,85 @@ static bool ValidateRenderpassAttachmentUsage(layer_data *dev_data, const VkRend
     return skip;
 }
 
-static void MarkAttachmentFirstUse(RENDER_PASS_STATE *render_pass,
-                                   uint32_t index,
+static void MarkAttachmentFirstUse(RENDER_PASS_STATE *render_pass, std::vector<bool> &attachment_used, uint32_t index,
                                    bool is_read) {
-    if (index == VK_ATTACHMENT_UNUSED)
-        return;
+    if (index >= attachment_used.size() || attachment_used[index]) return;
+
+    attachment_used[index] = true;
+    render_pass->attachment_first_read[index] = is_read;
+}
+
+// Fill in the tables that beginning, advancing through and validating a render pass instance look up, from the create info
+// and the subpass DAG
+static void BuildRenderPassTables(RENDER_PASS_STATE *render_pass) {
+    auto const pCreateInfo = render_pass->createInfo.ptr();
+    const uint32_t subpass_count = pCreateInfo->subpassCount;
+    const uint32_t attachment_count = pCreateInfo->attachmentCount;
+
+    std::vector<bool> attachment_used(attachment_count, false);
+    render_pass->attachment_first_read.assign(attachment_count, false);
+    render_pass->subpass_layouts.resize(subpass_count);
+    for (uint32_t i = 0; i < subpass_count; ++i) {
+        const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[i];
+        for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
+            MarkAttachmentFirstUse(render_pass, attachment_used, subpass.pColorAttachments[j].attachment, false);
+
+            // resolve attachments are considered to be written
+            if (subpass.pResolveAttachments) {
+                MarkAttachmentFirstUse(render_pass, attachment_used, subpass.pResolveAttachments[j].attachment, false);
+            }
+        }
+        if (subpass.pDepthStencilAttachment) {
+            MarkAttachmentFirstUse(render_pass, attachment_used, subpass.pDepthStencilAttachment->attachment, false);
+        }
+        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
+            MarkAttachmentFirstUse(render_pass, attachment_used, subpass.pInputAttachments[j].attachment, true);
+        }
+
+        // Layouts the subpass moves its attachments to, in the order the references are applied
+        auto &layouts = render_pass->subpass_layouts[i];
+        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
+            if (subpass.pInputAttachments[j].attachment < attachment_count) layouts.push_back(subpass.pInputAttachments[j]);
+        }
+        for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
+            if (subpass.pColorAttachments[j].attachment < attachment_count) layouts.push_back(subpass.pColorAttachments[j]);
+        }
+        if (subpass.pDepthStencilAttachment && subpass.pDepthStencilAttachment->attachment < attachment_count) {
+            layouts.push_back(*subpass.pDepthStencilAttachment);
+        }
+
+        if (subpass.pDepthStencilAttachment && subpass.pDepthStencilAttachment->attachment != VK_ATTACHMENT_UNUSED) {
+            for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
+                if (subpass.pColorAttachments[j].attachment == subpass.pDepthStencilAttachment->attachment) {
+                    render_pass->color_depth_conflicts.emplace_back(subpass.pDepthStencilAttachment->attachment, i);
+                    break;
+                }
+            }
+        }
+    }
 
-    if (!render_pass->attachment_first_read.count(index))
-        render_pass->attachment_first_read[index] = is_read;
+    // Dependencies only point from earlier to later subpasses, so each subpass's predecessors are complete by the time a
+    // later subpass folds them in
+    const size_t words = (subpass_count + 63) / 64;
+    render_pass->subpass_predecessors.assign(subpass_count, std::vector<uint64_t>(words, 0));
+    for (uint32_t i = 0; i < subpass_count; ++i) {
+        auto &predecessors = render_pass->subpass_predecessors[i];
+        for (auto prev : render_pass->subpassToNode[i].prev) {
+            predecessors[prev / 64] |= 1ULL << (prev % 64);
+            auto const &transitive = render_pass->subpass_predecessors[prev];
+            for (size_t w = 0; w < words; ++w) predecessors[w] |= transitive[w];
+        }
+    }
+
+    render_pass->missing_dependencies =
+        FindMissingDependencies(render_pass, std::vector<std::vector<uint32_t>>(attachment_count));
+    for (uint32_t i = 0; i < subpass_count; ++i) {
+        const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[i];
+        for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
+            CheckPreserved(pCreateInfo, i, subpass.pInputAttachments[j].attachment, render_pass->subpassToNode, 0,
+                           render_pass->missing_preserves);
+        }
+    }
 }
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderPassCreateInfo *pCreateInfo,
@@ -8957,24 +9220,8 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(VkDevice device, const VkRenderP
         render_pass->renderPass = *pRenderPass;
         render_pass->hasSelfDependency = has_self_dependency;
         render_pass->subpassToNode = subpass_to_node;
-
-        for (uint32_t i = 0; i < pCreateInfo->subpassCount; ++i) {
-            const VkSubpassDescription &subpass = pCreateInfo->pSubpasses[i];
-            for (uint32_t j = 0; j < subpass.colorAttachmentCount; ++j) {
-                MarkAttachmentFirstUse(render_pass.get(), subpass.pColorAttachments[j].attachment, false);
-
-                // resolve attachments are considered to be written
-                if (subpass.pResolveAttachments) {
-                    MarkAttachmentFirstUse(render_pass.get(), subpass.pResolveAttachments[j].attachment, false);
-                }
-            }
-            if (subpass.pDepthStencilAttachment) {
-                MarkAttachmentFirstUse(render_pass.get(), subpass.pDepthStencilAttachment->attachment, false);
-            }
-            for (uint32_t j = 0; j < subpass.inputAttachmentCount; ++j) {
-                MarkAttachmentFirstUse(render_pass.get(), subpass.pInputAttachments[j].attachment, true);
-            }
-        }
+        BuildRenderPassTables(render_pass.get());
+        render_pass->compatibility_class = GetRenderPassCompatibilityClass(dev_data, pCreateInfo);
 
         dev_data->renderPassMap[*pRenderPass] = std::move(render_pass);
     }
@@ -9099,6 +9346,20 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(VkCommandBuffer commandBuffer, con
                     clear_op_size - 1);
             }
             skip |= VerifyRenderAreaBounds(dev_data, pRenderPassBegin);
+            string errorString;
+            if ((framebuffer->createInfo.renderPass != pRenderPassBegin->renderPass) &&
+                !VerifyRenderPassCompatibility(dev_data, framebuffer->render_pass_compatibility_class,
+                                               framebuffer->renderPassCreateInfo.ptr(), render_pass_state->compatibility_class,
+                                               render_pass_state->createInfo.ptr(), errorString)) {
+                skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_RENDER_PASS_EXT,
+                                reinterpret_cast<uint64_t &>(render_pass_state->renderPass), __LINE__, VALIDATION_ERROR_01702, "DS",
+                                "vkCmdBeginRenderPass(): renderPass (0x%" PRIx64 ") is incompatible w/ framebuffer (0x%" PRIx64
+                                ") w/ render pass (0x%" PRIx64 ") due to: %s. %s",
+                                reinterpret_cast<uint64_t &>(render_pass_state->renderPass),
+                                reinterpret_cast<const uint64_t &>(pRenderPassBegin->framebuffer),
+                                reinterpret_cast<uint64_t &>(framebuffer->createInfo.renderPass), errorString.c_str(),
+                                validation_error_map[VALIDATION_ERROR_01702]);
+            }
             skip |= VerifyFramebufferAndRenderPassLayouts(dev_data, cb_node, pRenderPassBegin,
                                                           GetFramebufferState(dev_data, pRenderPassBegin->framebuffer));
             skip |= insideRenderPass(dev_data, cb_node, "vkCmdBeginRenderPass()", VALIDATION_ERROR_00440);
@@ -9220,7 +9481,8 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass(VkCommandBuffer commandBuffer) {
 }
 
 static bool logInvalidAttachmentMessage(layer_data *dev_data, VkCommandBuffer secondaryBuffer, uint32_t primaryAttach,
-                                        uint32_t secondaryAttach, const char *msg) {
+                                        uint32_t secondaryAttach, const char *msg, bool &compatible) {
+    compatible = false;
     return log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                    reinterpret_cast<uint64_t>(secondaryBuffer), __LINE__, VALIDATION_ERROR_02059, "DS",
                    "vkCmdExecuteCommands() called w/ invalid Secondary Cmd Buffer 0x%" PRIx64
@@ -9234,7 +9496,7 @@ static bool logInvalidAttachmentMessage(layer_data *dev_data, VkCommandBuffer se
 static bool validateAttachmentCompatibility(layer_data *dev_data, VkCommandBuffer primaryBuffer,
                                             VkRenderPassCreateInfo const *primaryPassCI, uint32_t primaryAttach,
                                             VkCommandBuffer secondaryBuffer, VkRenderPassCreateInfo const *secondaryPassCI,
-                                            uint32_t secondaryAttach, bool is_multi) {
+                                            uint32_t secondaryAttach, bool is_multi, bool &compatible) {
     bool skip = false;
     if (primaryPassCI->attachmentCount <= primaryAttach) {
         primaryAttach = VK_ATTACHMENT_UNUSED;
@@ -9247,32 +9509,33 @@ static bool validateAttachmentCompatibility(layer_data *dev_data, VkCommandBuffe
     }
     if (primaryAttach == VK_ATTACHMENT_UNUSED) {
         skip |= logInvalidAttachmentMessage(dev_data, secondaryBuffer, primaryAttach, secondaryAttach,
-                                            "The first is unused while the second is not.");
+                                            "The first is unused while the second is not.", compatible);
         return skip;
     }
     if (secondaryAttach == VK_ATTACHMENT_UNUSED) {
         skip |= logInvalidAttachmentMessage(dev_data, secondaryBuffer, primaryAttach, secondaryAttach,
-                                            "The second is unused while the first is not.");
+                                            "The second is unused while the first is not.", compatible);
         return skip;
     }
     if (primaryPassCI->pAttachments[primaryAttach].format != secondaryPassCI->pAttachments[secondaryAttach].format) {
-        skip |=
-            logInvalidAttachmentMessage(dev_data, secondaryBuffer, primaryAttach, secondaryAttach, "They have different formats.");
+        skip |= logInvalidAttachmentMessage(dev_data, secondaryBuffer, primaryAttach, secondaryAttach,
+                                            "They have different formats.", compatible);
     }
     if (primaryPassCI->pAttachments[primaryAttach].samples != secondaryPassCI->pAttachments[secondaryAttach].samples) {
-        skip |=
-            logInvalidAttachmentMessage(dev_data, secondaryBuffer, primaryAttach, secondaryAttach, "They have different samples.");
+        skip |= logInvalidAttachmentMessage(dev_data, secondaryBuffer, primaryAttach, secondaryAttach,
+                                            "They have different samples.", compatible);
     }
     if (is_multi && primaryPassCI->pAttachments[primaryAttach].flags != secondaryPassCI->pAttachments[secondaryAttach].flags) {
-        skip |=
-            logInvalidAttachmentMessage(dev_data, secondaryBuffer, primaryAttach, secondaryAttach, "They have different flags.");
+        skip |= logInvalidAttachmentMessage(dev_data, secondaryBuffer, primaryAttach, secondaryAttach,
+                                            "They have different flags.", compatible);
     }
     return skip;
 }
 
 static bool validateSubpassCompatibility(layer_data *dev_data, VkCommandBuffer primaryBuffer,
                                          VkRenderPassCreateInfo const *primaryPassCI, VkCommandBuffer secondaryBuffer,
-                                         VkRenderPassCreateInfo const *secondaryPassCI, const int subpass, bool is_multi) {
+                                         VkRenderPassCreateInfo const *secondaryPassCI, const int subpass, bool is_multi,
+                                         bool &compatible) {
     bool skip = false;
     const VkSubpassDescription &primary_desc = primaryPassCI->pSubpasses[subpass];
     const VkSubpassDescription &secondary_desc = secondaryPassCI->pSubpasses[subpass];
@@ -9286,7 +9549,7 @@ static bool validateSubpassCompatibility(layer_data *dev_data, VkCommandBuffer p
             secondary_input_attach = secondary_desc.pInputAttachments[i].attachment;
         }
         skip |= validateAttachmentCompatibility(dev_data, primaryBuffer, primaryPassCI, primary_input_attach, secondaryBuffer,
-                                                secondaryPassCI, secondary_input_attach, is_multi);
+                                                secondaryPassCI, secondary_input_attach, is_multi, compatible);
     }
     uint32_t maxColorAttachmentCount = std::max(primary_desc.colorAttachmentCount, secondary_desc.colorAttachmentCount);
     for (uint32_t i = 0; i < maxColorAttachmentCount; ++i) {
@@ -9298,7 +9561,7 @@ static bool validateSubpassCompatibility(layer_data *dev_data, VkCommandBuffer p
             secondary_color_attach = secondary_desc.pColorAttachments[i].attachment;
         }
         skip |= validateAttachmentCompatibility(dev_data, primaryBuffer, primaryPassCI, primary_color_attach, secondaryBuffer,
-                                                secondaryPassCI, secondary_color_attach, is_multi);
+                                                secondaryPassCI, secondary_color_attach, is_multi, compatible);
         uint32_t primary_resolve_attach = VK_ATTACHMENT_UNUSED, secondary_resolve_attach = VK_ATTACHMENT_UNUSED;
         if (i < primary_desc.colorAttachmentCount && primary_desc.pResolveAttachments) {
             primary_resolve_attach = primary_desc.pResolveAttachments[i].attachment;
@@ -9307,7 +9570,7 @@ static bool validateSubpassCompatibility(layer_data *dev_data, VkCommandBuffer p
             secondary_resolve_attach = secondary_desc.pResolveAttachments[i].attachment;
         }
         skip |= validateAttachmentCompatibility(dev_data, primaryBuffer, primaryPassCI, primary_resolve_attach, secondaryBuffer,
-                                                secondaryPassCI, secondary_resolve_attach, is_multi);
+                                                secondaryPassCI, secondary_resolve_attach, is_multi, compatible);
     }
     uint32_t primary_depthstencil_attach = VK_ATTACHMENT_UNUSED, secondary_depthstencil_attach = VK_ATTACHMENT_UNUSED;
     if (primary_desc.pDepthStencilAttachment) {
@@ -9317,19 +9580,25 @@ static bool validateSubpassCompatibility(layer_data *dev_data, VkCommandBuffer p
         secondary_depthstencil_attach = secondary_desc.pDepthStencilAttachment[0].attachment;
     }
     skip |= validateAttachmentCompatibility(dev_data, primaryBuffer, primaryPassCI, primary_depthstencil_attach, secondaryBuffer,
-                                            secondaryPassCI, secondary_depthstencil_attach, is_multi);
+                                            secondaryPassCI, secondary_depthstencil_attach, is_multi, compatible);
     return skip;
 }
 
 // Verify that given renderPass CreateInfo for primary and secondary command buffers are compatible.
 //  This function deals directly with the CreateInfo, there are overloaded versions below that can take the renderPass handle and
-//  will then feed into this function
-static bool validateRenderPassCompatibility(layer_data *dev_data, VkCommandBuffer primaryBuffer,
+//  will then feed into this function. Once a pair of compatibility classes is found to have no mismatch, later checks of the
+//  same pair return right away.
+static bool validateRenderPassCompatibility(layer_data *dev_data, VkCommandBuffer primaryBuffer, uint32_t primary_class,
                                             VkRenderPassCreateInfo const *primaryPassCI, VkCommandBuffer secondaryBuffer,
-                                            VkRenderPassCreateInfo const *secondaryPassCI) {
+                                            uint32_t secondary_class, VkRenderPassCreateInfo const *secondaryPassCI) {
     bool skip = false;
+    if (primary_class && primary_class == secondary_class) return skip;
+    const uint64_t pair = RenderPassCompatibilityPair(primary_class, secondary_class);
+    if (pair && dev_data->renderPassAttachmentsCompatible.count(pair)) return skip;
 
+    bool compatible = true;
     if (primaryPassCI->subpassCount != secondaryPassCI->subpassCount) {
+        compatible = false;
         skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                         reinterpret_cast<uint64_t>(primaryBuffer), __LINE__, DRAWSTATE_INVALID_SECONDARY_COMMAND_BUFFER, "DS",
                         "vkCmdExecuteCommands() called w/ invalid secondary Cmd Buffer 0x%" PRIx64
@@ -9340,9 +9609,12 @@ static bool validateRenderPassCompatibility(layer_data *dev_data, VkCommandBuffe
     } else {
         for (uint32_t i = 0; i < primaryPassCI->subpassCount; ++i) {
             skip |= validateSubpassCompatibility(dev_data, primaryBuffer, primaryPassCI, secondaryBuffer, secondaryPassCI, i,
-                                                 primaryPassCI->subpassCount > 1);
+                                                 primaryPassCI->subpassCount > 1, compatible);
         }
     }
+    if (compatible && pair) {
+        dev_data->renderPassAttachmentsCompatible.insert(pair);
+    }
     return skip;
 }
 
@@ -9375,8 +9647,9 @@ static bool validateFramebuffer(layer_data *dev_data, VkCommandBuffer primaryBuf
         }
         auto cb_renderpass = GetRenderPassState(dev_data, pSubCB->beginInfo.pInheritanceInfo->renderPass);
         if (cb_renderpass->renderPass != fb->createInfo.renderPass) {
-            skip |= validateRenderPassCompatibility(dev_data, secondaryBuffer, fb->renderPassCreateInfo.ptr(), secondaryBuffer,
-                                                    cb_renderpass->createInfo.ptr());
+            skip |= validateRenderPassCompatibility(dev_data, secondaryBuffer, fb->render_pass_compatibility_class,
+                                                    fb->renderPassCreateInfo.ptr(), secondaryBuffer,
+                                                    cb_renderpass->compatibility_class, cb_renderpass->createInfo.ptr());
         }
     }
     return skip;
@@ -9466,8 +9739,10 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
                 } else {
                     // Make sure render pass is compatible with parent command buffer pass if has continue
                     if (pCB->activeRenderPass->renderPass != secondary_rp_state->renderPass) {
-                        skip |= validateRenderPassCompatibility(dev_data, commandBuffer, pCB->activeRenderPass->createInfo.ptr(),
-                                                                pCommandBuffers[i], secondary_rp_state->createInfo.ptr());
+                        skip |= validateRenderPassCompatibility(
+                            dev_data, commandBuffer, pCB->activeRenderPass->compatibility_class,
+                            pCB->activeRenderPass->createInfo.ptr(), pCommandBuffers[i], secondary_rp_state->compatibility_class,
+                            secondary_rp_state->createInfo.ptr());
                     }
                     //  If framebuffer for secondary CB is not NULL, then it must match active FB from primaryCB
                     skip |= validateFramebuffer(dev_data, commandBuffer, pCB, pCommandBuffers[i], pSubCB);
@@ -9475,8 +9750,9 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteCommands(VkCommandBuffer commandBuffer, uin
                 string errorString = "";
                 // secondaryCB must have been created w/ RP compatible w/ primaryCB active renderpass
                 if ((pCB->activeRenderPass->renderPass != secondary_rp_state->renderPass) &&
-                    !verify_renderpass_compatibility(dev_data, pCB->activeRenderPass->createInfo.ptr(),
-                                                     secondary_rp_state->createInfo.ptr(), errorString)) {
+                    !VerifyRenderPassCompatibility(dev_data, pCB->activeRenderPass->compatibility_class,
+                                                   pCB->activeRenderPass->createInfo.ptr(), secondary_rp_state->compatibility_class,
+                                                   secondary_rp_state->createInfo.ptr(), errorString)) {
                     skip |= log_msg(
                         dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT,
                         reinterpret_cast<uint64_t>(pCommandBuffers[i]), __LINE__, DRAWSTATE_RENDERPASS_INCOMPATIBLE, "DS",
@@ -9639,7 +9915,21 @@ static bool ValidateAndCopyNoncoherentMemoryToDriver(layer_data *dev_data, uint3
     for (uint32_t i = 0; i < mem_range_count; ++i) {
         auto mem_info = GetMemObjInfo(dev_data, mem_ranges[i].memory);
         if (mem_info) {
-            if (mem_info->shadow_copy) {
+            if (mem_info->guarded_mapping) {
+                if (mem_info->guarded_mapping->UnderflowDetected()) {
+                    skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                    VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mem_ranges[i].memory, __LINE__,
+                                    MEMTRACK_INVALID_MAP, "MEM", "Memory underflow was detected on mem obj 0x%" PRIxLEAST64,
+                                    (uint64_t)mem_ranges[i].memory);
+                }
+                if (mem_info->guarded_mapping->OverflowDetected()) {
+                    skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT,
+                                    VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mem_ranges[i].memory, __LINE__,
+                                    MEMTRACK_INVALID_MAP, "MEM", "Memory overflow was detected on mem obj 0x%" PRIxLEAST64,
+                                    (uint64_t)mem_ranges[i].memory);
+                }
+                mem_info->guarded_mapping->CopyDirtyPagesToDriver();
+            } else if (mem_info->shadow_copy) {
                 VkDeviceSize size = (mem_info->mem_range.size != VK_WHOLE_SIZE)
                                         ? mem_info->mem_range.size
                                         : (mem_info->alloc_info.allocationSize - mem_info->mem_range.offset);
@@ -9670,7 +9960,9 @@ static bool ValidateAndCopyNoncoherentMemoryToDriver(layer_data *dev_data, uint3
 static void CopyNoncoherentMemoryFromDriver(layer_data *dev_data, uint32_t mem_range_count, const VkMappedMemoryRange *mem_ranges) {
     for (uint32_t i = 0; i < mem_range_count; ++i) {
         auto mem_info = GetMemObjInfo(dev_data, mem_ranges[i].memory);
-        if (mem_info && mem_info->shadow_copy) {
+        if (mem_info && mem_info->guarded_mapping) {
+            mem_info->guarded_mapping->DiscardHostCopy();
+        } else if (mem_info && mem_info->shadow_copy) {
             VkDeviceSize size = (mem_info->mem_range.size != VK_WHOLE_SIZE)
                                     ? mem_info->mem_range.size
                                     : (mem_info->alloc_info.allocationSize - mem_ranges[i].offset);
@@ -10292,6 +10584,7 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR s
                 }
                 skip = ClearMemoryObjectBindings(dev_data, (uint64_t)swapchain_image, kVulkanObjectTypeSwapchainKHR);
                 dev_data->imageMap.erase(swapchain_image);
+                debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(swapchain_image));
             }
         }
 
@@ -10302,6 +10595,7 @@ VKAPI_ATTR void VKAPI_CALL DestroySwapchainKHR(VkDevice device, VkSwapchainKHR s
         }
 
         dev_data->swapchainMap.erase(swapchain);
+        debug_report_forget_object(dev_data->report_data, reinterpret_cast<uint64_t &>(swapchain));
     }
     lock.unlock();
     if (!skip) dev_data->dispatch_table.DestroySwapchainKHR(device, swapchain, pAllocator);
@@ -11351,11 +11645,10 @@ static PFN_vkVoidFunction intercept_core_instance_command(const char *name) {
         {"vkEnumerateDeviceExtensionProperties", reinterpret_cast<PFN_vkVoidFunction>(EnumerateDeviceExtensionProperties)},
     };
 
-    for (size_t i = 0; i < ARRAY_SIZE(core_instance_commands); i++) {
-        if (!strcmp(core_instance_commands[i].name, name)) return core_instance_commands[i].proc;
-    }
+    static const auto core_instance_table = MakeVkCommandTable(core_instance_commands);
 
-    return nullptr;
+    auto command = core_instance_table.Find(name);
+    return command ? command->proc : nullptr;
 }
 
 static PFN_vkVoidFunction intercept_core_device_command(const char *name) {
@@ -11482,70 +11775,65 @@ static PFN_vkVoidFunction intercept_core_device_command(const char *name) {
         {"vkCreateEvent", reinterpret_cast<PFN_vkVoidFunction>(CreateEvent)},
     };
 
-    for (size_t i = 0; i < ARRAY_SIZE(core_device_commands); i++) {
-        if (!strcmp(core_device_commands[i].name, name)) return core_device_commands[i].proc;
-    }
+    static const auto core_device_table = MakeVkCommandTable(core_device_commands);
 
-    return nullptr;
+    auto command = core_device_table.Find(name);
+    return command ? command->proc : nullptr;
 }
 
 static PFN_vkVoidFunction intercept_device_extension_command(const char *name, VkDevice device) {
-    layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-
-    const struct {
+    using E = DeviceExtensions;
+    static const struct {
         const char *name;
         PFN_vkVoidFunction proc;
-        bool enabled;
+        bool E::*enable;
     } device_extension_commands[] = {
         {"vkCreateDescriptorUpdateTemplateKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateDescriptorUpdateTemplateKHR),
-         device_data->device_extensions.khr_descriptor_update_template},
+         &E::khr_descriptor_update_template},
         {"vkDestroyDescriptorUpdateTemplateKHR", reinterpret_cast<PFN_vkVoidFunction>(DestroyDescriptorUpdateTemplateKHR),
-         device_data->device_extensions.khr_descriptor_update_template},
+         &E::khr_descriptor_update_template},
         {"vkUpdateDescriptorSetWithTemplateKHR", reinterpret_cast<PFN_vkVoidFunction>(UpdateDescriptorSetWithTemplateKHR),
-         device_data->device_extensions.khr_descriptor_update_template},
+         &E::khr_descriptor_update_template},
         {"vkCmdPushDescriptorSetWithTemplateKHR", reinterpret_cast<PFN_vkVoidFunction>(CmdPushDescriptorSetWithTemplateKHR),
-         device_data->device_extensions.khr_descriptor_update_template},
+         &E::khr_descriptor_update_template},
     };
+    static const auto device_extension_table = MakeVkCommandTable(device_extension_commands);
 
-    if (!device_data) return nullptr;
-
-    for (size_t i = 0; i < ARRAY_SIZE(device_extension_commands); i++) {
-        if (!strcmp(device_extension_commands[i].name, name) && device_extension_commands[i].enabled)
-            return device_extension_commands[i].proc;
-    }
+    auto command = device_extension_table.Find(name);
+    if (!command) return nullptr;
 
-    return nullptr;
+    layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    if (!device_data || !(device_data->device_extensions.*(command->enable))) return nullptr;
+    return command->proc;
 }
 
 static PFN_vkVoidFunction intercept_khr_swapchain_command(const char *name, VkDevice dev) {
+    using E = DeviceExtensions;
     static const struct {
         const char *name;
         PFN_vkVoidFunction proc;
+        bool E::*enable;
     } khr_swapchain_commands[] = {
-        {"vkCreateSwapchainKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateSwapchainKHR)},
-        {"vkDestroySwapchainKHR", reinterpret_cast<PFN_vkVoidFunction>(DestroySwapchainKHR)},
-        {"vkGetSwapchainImagesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetSwapchainImagesKHR)},
-        {"vkAcquireNextImageKHR", reinterpret_cast<PFN_vkVoidFunction>(AcquireNextImageKHR)},
-        {"vkQueuePresentKHR", reinterpret_cast<PFN_vkVoidFunction>(QueuePresentKHR)},
+        {"vkCreateSwapchainKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateSwapchainKHR), &E::khr_swapchain},
+        {"vkDestroySwapchainKHR", reinterpret_cast<PFN_vkVoidFunction>(DestroySwapchainKHR), &E::khr_swapchain},
+        {"vkGetSwapchainImagesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetSwapchainImagesKHR), &E::khr_swapchain},
+        {"vkAcquireNextImageKHR", reinterpret_cast<PFN_vkVoidFunction>(AcquireNextImageKHR), &E::khr_swapchain},
+        {"vkQueuePresentKHR", reinterpret_cast<PFN_vkVoidFunction>(QueuePresentKHR), &E::khr_swapchain},
+        {"vkCreateSharedSwapchainsKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateSharedSwapchainsKHR),
+         &E::khr_display_swapchain},
     };
-    layer_data *dev_data = nullptr;
+    static const auto khr_swapchain_table = MakeVkCommandTable(khr_swapchain_commands);
 
-    if (dev) {
-        dev_data = GetLayerDataPtr(get_dispatch_key(dev), layer_data_map);
-        if (!dev_data->device_extensions.khr_swapchain) return nullptr;
-    }
-
-    for (size_t i = 0; i < ARRAY_SIZE(khr_swapchain_commands); i++) {
-        if (!strcmp(khr_swapchain_commands[i].name, name)) return khr_swapchain_commands[i].proc;
-    }
+    auto command = khr_swapchain_table.Find(name);
+    if (!command) return nullptr;
 
-    if (dev_data) {
-        if (!dev_data->device_extensions.khr_display_swapchain) return nullptr;
+    if (dev) {
+        layer_data *dev_data = GetLayerDataPtr(get_dispatch_key(dev), layer_data_map);
+        // VK_KHR_display_swapchain requires VK_KHR_swapchain
+        if (!dev_data->device_extensions.khr_swapchain || !(dev_data->device_extensions.*(command->enable))) return nullptr;
     }
 
-    if (!strcmp("vkCreateSharedSwapchainsKHR", name)) return reinterpret_cast<PFN_vkVoidFunction>(CreateSharedSwapchainsKHR);
-
-    return nullptr;
+    return command->proc;
 }
 
 static PFN_vkVoidFunction intercept_khr_surface_command(const char *name, VkInstance instance) {
@@ -11593,19 +11881,17 @@ static PFN_vkVoidFunction intercept_khr_surface_command(const char *name, VkInst
          &E::khr_surface},
     };
 
-    instance_layer_data *instance_data = nullptr;
-    if (instance) {
-        instance_data = GetLayerDataPtr(get_dispatch_key(instance), instance_layer_data_map);
-    }
+    static const auto khr_surface_table = MakeVkCommandTable(khr_surface_commands);
 
-    for (size_t i = 0; i < ARRAY_SIZE(khr_surface_commands); i++) {
-        if (!strcmp(khr_surface_commands[i].name, name)) {
-            if (instance_data && !(instance_data->extensions.*(khr_surface_commands[i].enable))) return nullptr;
-            return khr_surface_commands[i].proc;
-        }
+    auto command = khr_surface_table.Find(name);
+    if (!command) return nullptr;
+
+    if (instance) {
+        instance_layer_data *instance_data = GetLayerDataPtr(get_dispatch_key(instance), instance_layer_data_map);
+        if (!(instance_data->extensions.*(command->enable))) return nullptr;
     }
 
-    return nullptr;
+    return command->proc;
 }
 
 static PFN_vkVoidFunction intercept_extension_instance_commands(const char *name, VkInstance instance) {
@@ -11621,12 +11907,10 @@ static PFN_vkVoidFunction intercept_extension_instance_commands(const char *name
          reinterpret_cast<PFN_vkVoidFunction>(EnumeratePhysicalDeviceGroupsKHX)},
     };
 
-    for (size_t i = 0; i < ARRAY_SIZE(instance_extension_commands); i++) {
-        if (!strcmp(instance_extension_commands[i].name, name)) {
-            return instance_extension_commands[i].proc;
-        }
-    }
-    return nullptr;
+    static const auto instance_extension_table = MakeVkCommandTable(instance_extension_commands);
+
+    auto command = instance_extension_table.Find(name);
+    return command ? command->proc : nullptr;
 }
 
 }  // namespace core_validation
@@ -129,7 +129,7 @@ class QUEUE_STATE {
     VkQueue queue;
     uint32_t queueFamilyIndex;
     std::unordered_map<VkEvent, VkPipelineStageFlags> eventToStageMap;
-    std::unordered_map<QueryObject, bool> queryToStateMap;  // 0 is unavailable, 1 is available
+    QueryStateMap queryToStateMap;
 
     uint64_t seq;
     std::deque<CB_SUBMISSION> submissions;
@@ -52,6 +52,8 @@
 #include "vk_layer_logging.h"
 #include "vk_object_types.h"
 #include "device_extensions.h"
+#include "mapped_memory_guard.h"
+#include <algorithm>
 #include <atomic>
 #include <functional>
 #include <map>
@@ -318,11 +320,14 @@ struct DEVICE_MEM_INFO : public BASE_NODE {
     std::unordered_set<uint64_t> bound_buffers;
 
     MemRange mem_range;
-    void *shadow_copy_base;    // Base of layer's allocation for guard band, data, and alignment space
-    void *shadow_copy;         // Pointer to start of guard-band data before mapped region
-    uint64_t shadow_pad_size;  // Size of the guard-band data before and after actual data. It MUST be a
-                               // multiple of limits.minMemoryMapAlignment
-    void *p_driver_data;       // Pointer to application's actual memory
+    void *shadow_copy_base;           // Base of layer's allocation for guard band, data, and alignment space
+    void *shadow_copy;                // Pointer to start of guard-band data before mapped region
+    uint64_t shadow_pad_size;         // Size of the guard-band data before and after actual data. It MUST be a
+                                      // multiple of limits.minMemoryMapAlignment
+    void *p_driver_data;              // Pointer to application's actual memory
+    // Used instead of shadow_copy when guard pages protect the mapped range; owned here so that memory still mapped when
+    // the device is destroyed releases its guard pages too
+    std::unique_ptr<GuardedMapping> guarded_mapping;
 
     DEVICE_MEM_INFO(void *disp_object, const VkDeviceMemory in_mem, const VkMemoryAllocateInfo *p_alloc_info)
         : object(disp_object),
@@ -368,9 +373,17 @@ struct RENDER_PASS_STATE : public BASE_NODE {
     safe_VkRenderPassCreateInfo createInfo;
     std::vector<bool> hasSelfDependency;
     std::vector<DAGNode> subpassToNode;
-    std::unordered_map<uint32_t, bool> attachment_first_read;
+    // Tables derived from createInfo at vkCreateRenderPass, so that recording a render pass instance only applies them
+    std::vector<bool> attachment_first_read;                           // Per attachment: its first use in the pass reads it
+    std::vector<std::vector<VkAttachmentReference>> subpass_layouts;   // Per subpass: the attachments it uses, in their layouts
+    std::vector<std::vector<uint64_t>> subpass_predecessors;           // Per subpass: bit j set if a dependency chain leads from j
+    std::vector<std::pair<uint32_t, uint32_t>> color_depth_conflicts;  // (attachment, subpass) used as both color and depth
+    std::vector<std::pair<uint32_t, uint32_t>> missing_dependencies;   // (subpass, subpass) sharing an attachment, unordered
+    std::vector<std::pair<uint32_t, uint32_t>> missing_preserves;      // (attachment, subpass) that must preserve it
+    // Render passes with the same class have the same structure, and so are compatible with each other. 0 if unknown.
+    uint32_t compatibility_class;
 
-    RENDER_PASS_STATE(VkRenderPassCreateInfo const *pCreateInfo) : createInfo(pCreateInfo) {}
+    RENDER_PASS_STATE(VkRenderPassCreateInfo const *pCreateInfo) : createInfo(pCreateInfo), compatibility_class(0) {}
 };
 
 // Cmd Buffer Tracking
@@ -478,6 +491,115 @@ struct hash<QueryObject> {
     }
 };
 }
+
+// Availability of the queries in each query pool, kept as two bits per query so that ranges of queries are written,
+// tested and merged a 64-bit word at a time
+class QueryStateMap {
+   public:
+    enum State { kUnknown, kUnavailable, kAvailable };
+
+    // pool_size is the pool's queryCount. Queries past it are ignored; the commands that name them report them.
+    void Set(VkQueryPool pool, uint32_t pool_size, uint32_t first, uint32_t count, bool available) {
+        const uint64_t end = std::min(static_cast<uint64_t>(first) + count, static_cast<uint64_t>(pool_size));
+        if (first >= end) return;
+        PoolBits &bits = pools_[pool];
+        bits.Resize(pool_size);
+        SetRange(&bits.known, first, static_cast<uint32_t>(end - first), true);
+        SetRange(&bits.available, first, static_cast<uint32_t>(end - first), available);
+    }
+
+    State Get(VkQueryPool pool, uint32_t index) const {
+        auto bits = pools_.find(pool);
+        if (bits == pools_.end() || (index >> 6) >= bits->second.known.size()) return kUnknown;
+        const uint64_t bit = 1ull << (index & 63);
+        if (!(bits->second.known[index >> 6] & bit)) return kUnknown;
+        return (bits->second.available[index >> 6] & bit) ? kAvailable : kUnavailable;
+    }
+
+    // Returns the first of count queries from first that is not available, or first + count if they all are. The state
+    // this map knows about takes precedence over that in fallback. Works a 64-query word at a time.
+    uint32_t FirstUnavailable(VkQueryPool pool, uint32_t first, uint32_t count, const QueryStateMap &fallback) const {
+        if (count == 0) return first;
+        auto own = pools_.find(pool);
+        auto other = fallback.pools_.find(pool);
+        const PoolBits *own_bits = own != pools_.end() ? &own->second : nullptr;
+        const PoolBits *other_bits = other != fallback.pools_.end() ? &other->second : nullptr;
+        const uint32_t last = first + count - 1;
+        for (uint32_t word = first >> 6; word <= (last >> 6); ++word) {
+            uint64_t known = 0, available = 0;
+            if (own_bits && word < own_bits->known.size()) {
+                known = own_bits->known[word];
+                available = own_bits->available[word] & known;
+            }
+            if (other_bits && word < other_bits->known.size()) {
+                available |= other_bits->available[word] & other_bits->known[word] & ~known;
+            }
+            uint64_t mask = ~0ull;
+            if (word == (first >> 6)) mask &= ~0ull << (first & 63);
+            if (word == (last >> 6)) mask &= ~0ull >> (63 - (last & 63));
+            const uint64_t missing = ~available & mask;
+            if (missing) {
+                uint32_t bit = 0;
+                while (!(missing & (1ull << bit))) ++bit;
+                return (word << 6) + bit;
+            }
+        }
+        return first + count;
+    }
+
+    // Takes the state of every query other knows about
+    void Merge(const QueryStateMap &other) {
+        for (const auto &other_pool : other.pools_) {
+            const PoolBits &from = other_pool.second;
+            PoolBits &to = pools_[other_pool.first];
+            if (to.known.size() < from.known.size()) to.Resize(static_cast<uint32_t>(from.known.size() * 64));
+            for (size_t i = 0; i < from.known.size(); ++i) {
+                to.available[i] = (to.available[i] & ~from.known[i]) | from.available[i];
+                to.known[i] |= from.known[i];
+            }
+        }
+    }
+
+    void ErasePool(VkQueryPool pool) { pools_.erase(pool); }
+    void clear() { pools_.clear(); }
+
+   private:
+    struct PoolBits {
+        std::vector<uint64_t> known;
+        std::vector<uint64_t> available;  // Only meaningful where known is set
+        void Resize(uint32_t query_count) {
+            const size_t words = (static_cast<size_t>(query_count) + 63) / 64;
+            if (known.size() < words) {
+                known.resize(words, 0);
+                available.resize(words, 0);
+            }
+        }
+    };
+
+    static void SetRange(std::vector<uint64_t> *words, uint32_t first, uint32_t count, bool value) {
+        const uint32_t last = first + count - 1;
+        for (uint32_t word = first >> 6; word <= (last >> 6); ++word) {
+            uint64_t mask = ~0ull;
+            if (word == (first >> 6)) mask &= ~0ull << (first & 63);
+            if (word == (last >> 6)) mask &= ~0ull >> (63 - (last & 63));
+            if (value) {
+                (*words)[word] |= mask;
+            } else {
+                (*words)[word] &= ~mask;
+            }
+        }
+    }
+
+    std::unordered_map<VkQueryPool, PoolBits> pools_;
+};
+
+// The events a command buffer had waited on when it reset a range of queries
+struct QueryResetEvents {
+    VkQueryPool pool;
+    uint32_t first;
+    uint32_t count;
+    std::unordered_set<VkEvent> events;
+};
 struct DRAW_DATA {
     std::vector<VkBuffer> buffers;
 };
@@ -542,6 +664,7 @@ class PIPELINE_STATE : public BASE_NODE {
     bool blendConstantsEnabled;  // Blend constants enabled for any attachments
     // Store RPCI b/c renderPass may be destroyed after Pipeline creation
     safe_VkRenderPassCreateInfo render_pass_ci;
+    uint32_t render_pass_compatibility_class;  // RENDER_PASS_STATE::compatibility_class of the renderPass
     PIPELINE_LAYOUT_NODE pipeline_layout;
 
     // Default constructor
@@ -556,6 +679,7 @@ class PIPELINE_STATE : public BASE_NODE {
           attachments(),
           blendConstantsEnabled(false),
           render_pass_ci(),
+          render_pass_compatibility_class(0),
           pipeline_layout() {}
 
     void initGraphicsPipeline(const VkGraphicsPipelineCreateInfo *pCreateInfo) {
@@ -650,8 +774,8 @@ struct GLOBAL_CB_NODE : public BASE_NODE {
     std::unordered_set<VkEvent> waitedEvents;
     std::vector<VkEvent> writeEventsBeforeWait;
     std::vector<VkEvent> events;
-    std::unordered_map<QueryObject, std::unordered_set<VkEvent>> waitedEventsBeforeQueryReset;
-    std::unordered_map<QueryObject, bool> queryToStateMap;  // 0 is unavailable, 1 is available
+    std::vector<QueryResetEvents> waitedEventsBeforeQueryReset;  // In recording order
+    QueryStateMap queryToStateMap;
     std::unordered_set<QueryObject> activeQueries;
     std::unordered_set<QueryObject> startedQueries;
     std::unordered_map<ImageSubresourcePair, IMAGE_CMD_BUF_LAYOUT_NODE> imageLayoutMap;
@@ -744,10 +868,11 @@ public:
     VkFramebuffer framebuffer;
     safe_VkFramebufferCreateInfo createInfo;
     safe_VkRenderPassCreateInfo renderPassCreateInfo;
+    uint32_t render_pass_compatibility_class;  // RENDER_PASS_STATE::compatibility_class of the renderPass
     std::unordered_set<VkCommandBuffer> referencingCmdBuffers;
     std::vector<MT_FB_ATTACHMENT_INFO> attachments;
     FRAMEBUFFER_STATE(VkFramebuffer fb, const VkFramebufferCreateInfo *pCreateInfo, const VkRenderPassCreateInfo *pRPCI)
-        : framebuffer(fb), createInfo(pCreateInfo), renderPassCreateInfo(pRPCI) {};
+        : framebuffer(fb), createInfo(pCreateInfo), renderPassCreateInfo(pRPCI), render_pass_compatibility_class(0) {};
 };
 
 // Fwd declarations of layer_data and helpers to look-up/validate state from layer_data maps
@@ -208,15 +208,15 @@ VkSampler const *cvdescriptorset::DescriptorSetLayout::GetImmutableSamplerPtrFro
     return bindings_[index].pImmutableSamplers;
 }
 // If our layout is compatible with rh_ds_layout, return true,
-//  else return false and fill in error_msg will description of what causes incompatibility
-bool cvdescriptorset::DescriptorSetLayout::IsCompatible(const DescriptorSetLayout *rh_ds_layout, std::string *error_msg) const {
+//  else return false and record what causes incompatibility in failure
+bool cvdescriptorset::DescriptorSetLayout::IsCompatible(const DescriptorSetLayout *rh_ds_layout,
+                                                        DescriptorSetFailure *failure) const {
     // Trivial case
     if (layout_ == rh_ds_layout->GetDescriptorSetLayout()) return true;
+    auto rh_layout = rh_ds_layout->GetDescriptorSetLayout();
     if (descriptor_count_ != rh_ds_layout->descriptor_count_) {
-        std::stringstream error_str;
-        error_str << "DescriptorSetLayout " << layout_ << " has " << descriptor_count_ << " descriptors, but DescriptorSetLayout "
-                  << rh_ds_layout->GetDescriptorSetLayout() << " has " << rh_ds_layout->descriptor_count_ << " descriptors.";
-        *error_msg = error_str.str();
+        failure->Set(DescriptorSetFailure::LayoutDescriptorCountMismatch, reinterpret_cast<const uint64_t &>(layout_),
+                     reinterpret_cast<const uint64_t &>(rh_layout), {descriptor_count_, rh_ds_layout->descriptor_count_});
         return false;  // trivial fail case
     }
     // Descriptor counts match so need to go through bindings one-by-one
@@ -225,28 +225,20 @@ bool cvdescriptorset::DescriptorSetLayout::IsCompatible(const DescriptorSetLayou
         // TODO : Do we also need to check immutable samplers?
         // VkDescriptorSetLayoutBinding *rh_binding;
         if (binding.descriptorCount != rh_ds_layout->GetDescriptorCountFromBinding(binding.binding)) {
-            std::stringstream error_str;
-            error_str << "Binding " << binding.binding << " for DescriptorSetLayout " << layout_ << " has a descriptorCount of "
-                      << binding.descriptorCount << " but binding " << binding.binding << " for DescriptorSetLayout "
-                      << rh_ds_layout->GetDescriptorSetLayout() << " has a descriptorCount of "
-                      << rh_ds_layout->GetDescriptorCountFromBinding(binding.binding);
-            *error_msg = error_str.str();
+            failure->Set(DescriptorSetFailure::BindingDescriptorCountMismatch, reinterpret_cast<const uint64_t &>(layout_),
+                         reinterpret_cast<const uint64_t &>(rh_layout),
+                         {binding.binding, binding.descriptorCount, rh_ds_layout->GetDescriptorCountFromBinding(binding.binding)});
             return false;
         } else if (binding.descriptorType != rh_ds_layout->GetTypeFromBinding(binding.binding)) {
-            std::stringstream error_str;
-            error_str << "Binding " << binding.binding << " for DescriptorSetLayout " << layout_ << " is type '"
-                      << string_VkDescriptorType(binding.descriptorType) << "' but binding " << binding.binding
-                      << " for DescriptorSetLayout " << rh_ds_layout->GetDescriptorSetLayout() << " is type '"
-                      << string_VkDescriptorType(rh_ds_layout->GetTypeFromBinding(binding.binding)) << "'";
-            *error_msg = error_str.str();
+            failure->Set(DescriptorSetFailure::BindingTypeMismatch, reinterpret_cast<const uint64_t &>(layout_),
+                         reinterpret_cast<const uint64_t &>(rh_layout),
+                         {binding.binding, static_cast<uint64_t>(binding.descriptorType),
+                          static_cast<uint64_t>(rh_ds_layout->GetTypeFromBinding(binding.binding))});
             return false;
         } else if (binding.stageFlags != rh_ds_layout->GetStageFlagsFromBinding(binding.binding)) {
-            std::stringstream error_str;
-            error_str << "Binding " << binding.binding << " for DescriptorSetLayout " << layout_ << " has stageFlags "
-                      << binding.stageFlags << " but binding " << binding.binding << " for DescriptorSetLayout "
-                      << rh_ds_layout->GetDescriptorSetLayout() << " has stageFlags "
-                      << rh_ds_layout->GetStageFlagsFromBinding(binding.binding);
-            *error_msg = error_str.str();
+            failure->Set(DescriptorSetFailure::BindingStageFlagsMismatch, reinterpret_cast<const uint64_t &>(layout_),
+                         reinterpret_cast<const uint64_t &>(rh_layout),
+                         {binding.binding, binding.stageFlags, rh_ds_layout->GetStageFlagsFromBinding(binding.binding)});
             return false;
         }
     }
@@ -388,25 +380,104 @@ static std::string string_descriptor_req_view_type(descriptor_req req) {
     return result;
 }
 
+std::string cvdescriptorset::DescriptorSetFailure::Format() const {
+    std::stringstream error_str;
+    error_str << std::showbase;
+    switch (code) {
+        case NoFailure:
+            break;
+        case LayoutDescriptorCountMismatch:
+            error_str << "DescriptorSetLayout " << std::hex << handles[0] << std::dec << " has " << values[0]
+                      << " descriptors, but DescriptorSetLayout " << std::hex << handles[1] << std::dec << " has " << values[1]
+                      << " descriptors.";
+            break;
+        case BindingDescriptorCountMismatch:
+            error_str << "Binding " << values[0] << " for DescriptorSetLayout " << std::hex << handles[0] << std::dec
+                      << " has a descriptorCount of " << values[1] << " but binding " << values[0] << " for DescriptorSetLayout "
+                      << std::hex << handles[1] << std::dec << " has a descriptorCount of " << values[2];
+            break;
+        case BindingTypeMismatch:
+            error_str << "Binding " << values[0] << " for DescriptorSetLayout " << std::hex << handles[0] << std::dec
+                      << " is type '" << string_VkDescriptorType(VkDescriptorType(values[1])) << "' but binding " << values[0]
+                      << " for DescriptorSetLayout " << std::hex << handles[1] << std::dec << " is type '"
+                      << string_VkDescriptorType(VkDescriptorType(values[2])) << "'";
+            break;
+        case BindingStageFlagsMismatch:
+            error_str << "Binding " << values[0] << " for DescriptorSetLayout " << std::hex << handles[0] << std::dec
+                      << " has stageFlags " << values[1] << " but binding " << values[0] << " for DescriptorSetLayout "
+                      << std::hex << handles[1] << std::dec << " has stageFlags " << values[2];
+            break;
+        case SetIndexOutOfRange:
+            error_str << "VkPipelineLayout (" << std::hex << handles[0] << std::dec << ") only contains " << values[0]
+                      << " setLayouts corresponding to sets 0-" << values[0] - 1
+                      << ", but you're attempting to bind set to index " << values[1];
+            break;
+        case InvalidBinding:
+            error_str << "Attempting to validate DrawState for binding #" << values[0]
+                      << " which is an invalid binding for this descriptor set.";
+            break;
+        case DescriptorNotUpdated:
+            error_str << "Descriptor in binding #" << values[0] << " at global descriptor index " << values[1]
+                      << " is being used in draw but has not been updated.";
+            break;
+        case InvalidBuffer:
+            error_str << "Descriptor in binding #" << values[0] << " at global descriptor index " << values[1]
+                      << " references invalid buffer " << std::hex << handles[0] << std::dec << ".";
+            break;
+        case InvalidBufferMemory:
+            error_str << "Descriptor in binding #" << values[0] << " at global descriptor index " << values[1] << " uses buffer "
+                      << std::hex << handles[0] << " that references invalid memory " << handles[1] << std::dec << ".";
+            break;
+        case DynamicOffsetExceedsWholeSize:
+            error_str << "Dynamic descriptor in binding #" << values[0] << " at global descriptor index " << values[1]
+                      << " uses buffer " << std::hex << handles[0] << std::dec
+                      << " with update range of VK_WHOLE_SIZE has dynamic offset " << values[2] << " combined with offset "
+                      << values[3] << " that oversteps the buffer size of " << values[4] << ".";
+            break;
+        case DynamicOffsetExceedsRange:
+            error_str << "Dynamic descriptor in binding #" << values[0] << " at global descriptor index " << values[1]
+                      << " uses buffer " << std::hex << handles[0] << std::dec << " with dynamic offset " << values[2]
+                      << " combined with offset " << values[3] << " and range " << values[5]
+                      << " that oversteps the buffer size of " << values[4] << ".";
+            break;
+        case ImageViewTypeMismatch:
+            error_str << "Descriptor in binding #" << values[0] << " at global descriptor index " << values[1]
+                      << " requires an image view of type " << string_descriptor_req_view_type(descriptor_req(values[2]))
+                      << " but got " << string_VkImageViewType(VkImageViewType(values[3])) << ".";
+            break;
+        case ImageLayoutMismatch:
+            error_str << "Image layout specified at vkUpdateDescriptorSets() time doesn't match actual image layout at "
+                         "time descriptor is used. See previous error callback for specific details.";
+            break;
+        case SingleSampleRequired:
+            error_str << "Descriptor in binding #" << values[0] << " at global descriptor index " << values[1]
+                      << " requires bound image to have VK_SAMPLE_COUNT_1_BIT but got "
+                      << string_VkSampleCountFlagBits(VkSampleCountFlagBits(values[2])) << ".";
+            break;
+        case MultiSampleRequired:
+            error_str << "Descriptor in binding #" << values[0] << " at global descriptor index " << values[1]
+                      << " requires bound image to have multiple samples, but got VK_SAMPLE_COUNT_1_BIT.";
+            break;
+    }
+    return error_str.str();
+}
+
 // Is this sets underlying layout compatible with passed in layout according to "Pipeline Layout Compatibility" in spec?
-bool cvdescriptorset::DescriptorSet::IsCompatible(const DescriptorSetLayout *layout, std::string *error) const {
-    return layout->IsCompatible(p_layout_, error);
+bool cvdescriptorset::DescriptorSet::IsCompatible(const DescriptorSetLayout *layout, DescriptorSetFailure *failure) const {
+    return layout->IsCompatible(p_layout_, failure);
 }
 
 // Validate that the state of this set is appropriate for the given bindings and dynamic_offsets at Draw time
 //  This includes validating that all descriptors in the given bindings are updated,
 //  that any update buffers are valid, and that any dynamic offsets are within the bounds of their buffers.
-// Return true if state is acceptable, or false and write an error message into error string
+// Return true if state is acceptable, or false and record the error details in failure
 bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t, descriptor_req> &bindings,
                                                        const std::vector<uint32_t> &dynamic_offsets, const GLOBAL_CB_NODE *cb_node,
-                                                       const char *caller, std::string *error) const {
+                                                       const char *caller, DescriptorSetFailure *failure) const {
     for (auto binding_pair : bindings) {
         auto binding = binding_pair.first;
         if (!p_layout_->HasBinding(binding)) {
-            std::stringstream error_str;
-            error_str << "Attempting to validate DrawState for binding #" << binding
-                      << " which is an invalid binding for this descriptor set.";
-            *error = error_str.str();
+            failure->Set(DescriptorSetFailure::InvalidBinding, 0, 0, {binding});
             return false;
         }
         auto start_idx = p_layout_->GetGlobalStartIndexFromBinding(binding);
@@ -414,10 +485,7 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
         auto array_idx = 0;  // Track array idx if we're dealing with array descriptors
         for (uint32_t i = start_idx; i <= end_idx; ++i, ++array_idx) {
             if (!descriptors_[i]->updated) {
-                std::stringstream error_str;
-                error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
-                          << " is being used in draw but has not been updated.";
-                *error = error_str.str();
+                failure->Set(DescriptorSetFailure::DescriptorNotUpdated, 0, 0, {binding, i});
                 return false;
             } else {
                 auto descriptor_class = descriptors_[i]->GetClass();
@@ -426,18 +494,14 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
                     auto buffer = static_cast<BufferDescriptor *>(descriptors_[i].get())->GetBuffer();
                     auto buffer_node = GetBufferState(device_data_, buffer);
                     if (!buffer_node) {
-                        std::stringstream error_str;
-                        error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
-                                  << " references invalid buffer " << buffer << ".";
-                        *error = error_str.str();
+                        failure->Set(DescriptorSetFailure::InvalidBuffer, reinterpret_cast<const uint64_t &>(buffer), 0,
+                                     {binding, i});
                         return false;
                     } else {
                         for (auto mem_binding : buffer_node->GetBoundMemory()) {
                             if (!GetMemObjInfo(device_data_, mem_binding)) {
-                                std::stringstream error_str;
-                                error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
-                                          << " uses buffer " << buffer << " that references invalid memory " << mem_binding << ".";
-                                *error = error_str.str();
+                                failure->Set(DescriptorSetFailure::InvalidBufferMemory, reinterpret_cast<const uint64_t &>(buffer),
+                                             reinterpret_cast<const uint64_t &>(mem_binding), {binding, i});
                                 return false;
                             }
                         }
@@ -450,22 +514,16 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
                         auto dyn_offset = dynamic_offsets[GetDynamicOffsetIndexFromBinding(binding) + array_idx];
                         if (VK_WHOLE_SIZE == range) {
                             if ((dyn_offset + desc_offset) > buffer_size) {
-                                std::stringstream error_str;
-                                error_str << "Dynamic descriptor in binding #" << binding << " at global descriptor index " << i
-                                          << " uses buffer " << buffer << " with update range of VK_WHOLE_SIZE has dynamic offset "
-                                          << dyn_offset << " combined with offset " << desc_offset
-                                          << " that oversteps the buffer size of " << buffer_size << ".";
-                                *error = error_str.str();
+                                failure->Set(DescriptorSetFailure::DynamicOffsetExceedsWholeSize,
+                                             reinterpret_cast<const uint64_t &>(buffer), 0,
+                                             {binding, i, dyn_offset, desc_offset, buffer_size});
                                 return false;
                             }
                         } else {
                             if ((dyn_offset + desc_offset + range) > buffer_size) {
-                                std::stringstream error_str;
-                                error_str << "Dynamic descriptor in binding #" << binding << " at global descriptor index " << i
-                                          << " uses buffer " << buffer << " with dynamic offset " << dyn_offset
-                                          << " combined with offset " << desc_offset << " and range " << range
-                                          << " that oversteps the buffer size of " << buffer_size << ".";
-                                *error = error_str.str();
+                                failure->Set(DescriptorSetFailure::DynamicOffsetExceedsRange,
+                                             reinterpret_cast<const uint64_t &>(buffer), 0,
+                                             {binding, i, dyn_offset, desc_offset, buffer_size, range});
                                 return false;
                             }
                         }
@@ -488,11 +546,8 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
 
                     if ((reqs & DESCRIPTOR_REQ_ALL_VIEW_TYPE_BITS) && (~reqs & (1 << image_view_ci.viewType))) {
                         // bad view type
-                        std::stringstream error_str;
-                        error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
-                                  << " requires an image view of type " << string_descriptor_req_view_type(reqs) << " but got "
-                                  << string_VkImageViewType(image_view_ci.viewType) << ".";
-                        *error = error_str.str();
+                        failure->Set(DescriptorSetFailure::ImageViewTypeMismatch, 0, 0,
+                                     {binding, i, reqs, static_cast<uint64_t>(image_view_ci.viewType)});
                         return false;
                     }
 
@@ -515,26 +570,18 @@ bool cvdescriptorset::DescriptorSet::ValidateDrawState(const std::map<uint32_t,
                         VerifyImageLayout(device_data_, cb_node, image_node, sub_layers, image_layout, VK_IMAGE_LAYOUT_UNDEFINED,
                                           caller, VALIDATION_ERROR_02981, &hit_error);
                         if (hit_error) {
-                            *error =
-                                "Image layout specified at vkUpdateDescriptorSets() time doesn't match actual image layout at "
-                                "time descriptor is used. See previous error callback for specific details.";
+                            failure->Set(DescriptorSetFailure::ImageLayoutMismatch, 0, 0, {});
                             return false;
                         }
                     }
                     // Verify Sample counts
                     if ((reqs & DESCRIPTOR_REQ_SINGLE_SAMPLE) && image_node->createInfo.samples != VK_SAMPLE_COUNT_1_BIT) {
-                        std::stringstream error_str;
-                        error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
-                                  << " requires bound image to have VK_SAMPLE_COUNT_1_BIT but got "
-                                  << string_VkSampleCountFlagBits(image_node->createInfo.samples) << ".";
-                        *error = error_str.str();
+                        failure->Set(DescriptorSetFailure::SingleSampleRequired, 0, 0,
+                                     {binding, i, static_cast<uint64_t>(image_node->createInfo.samples)});
                         return false;
                     }
                     if ((reqs & DESCRIPTOR_REQ_MULTI_SAMPLE) && image_node->createInfo.samples == VK_SAMPLE_COUNT_1_BIT) {
-                        std::stringstream error_str;
-                        error_str << "Descriptor in binding #" << binding << " at global descriptor index " << i
-                                  << " requires bound image to have multiple samples, but got VK_SAMPLE_COUNT_1_BIT.";
-                        *error = error_str.str();
+                        failure->Set(DescriptorSetFailure::MultiSampleRequired, 0, 0, {binding, i});
                         return false;
                     }
                 }
@@ -51,8 +51,11 @@
 #include "vk_safe_struct.h"
 #include "vulkan/vk_layer.h"
 #include "vk_object_types.h"
+#include <cassert>
+#include <initializer_list>
 #include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -92,6 +95,53 @@ using core_validation::layer_data;
  *  global indices for the lowest binding#.
  */
 namespace cvdescriptorset {
+/*
+ * DescriptorSetFailure struct
+ *
+ * Compact record of why a descriptor set check failed. Compatibility checks at bind time and state checks at draw time
+ *  record the failure code plus the raw handles and values involved instead of building message text. Bind-time callers
+ *  frequently discard the reason (e.g. when reporting disturbed sets), and others only need the text once log_msg_deferred()
+ *  has decided the message will be delivered, so formatting is deferred to Format().
+ */
+struct DescriptorSetFailure {
+    enum Code {
+        NoFailure,
+        LayoutDescriptorCountMismatch,
+        BindingDescriptorCountMismatch,
+        BindingTypeMismatch,
+        BindingStageFlagsMismatch,
+        SetIndexOutOfRange,
+        InvalidBinding,
+        DescriptorNotUpdated,
+        InvalidBuffer,
+        InvalidBufferMemory,
+        DynamicOffsetExceedsWholeSize,
+        DynamicOffsetExceedsRange,
+        ImageViewTypeMismatch,
+        ImageLayoutMismatch,
+        SingleSampleRequired,
+        MultiSampleRequired,
+    };
+
+    Code code;
+    uint64_t handles[2];
+    uint64_t values[6];
+
+    DescriptorSetFailure() : code(NoFailure), handles(), values() {}
+    void Set(Code failure_code, uint64_t handle0, uint64_t handle1, std::initializer_list<uint64_t> failure_values) {
+        code = failure_code;
+        handles[0] = handle0;
+        handles[1] = handle1;
+        size_t i = 0;
+        for (auto value : failure_values) {
+            assert(i < sizeof(values) / sizeof(values[0]));
+            values[i++] = value;
+        }
+    }
+    // Render the failure as message text
+    std::string Format() const;
+};
+
 class DescriptorSetLayout {
    public:
     // Constructors and destructor
@@ -109,8 +159,8 @@ class DescriptorSetLayout {
     // Return true if given binding is present in this layout
     bool HasBinding(const uint32_t binding) const { return binding_to_index_map_.count(binding) > 0; };
     // Return true if this layout is compatible with passed in layout,
-    //   else return false and update error_msg with description of incompatibility
-    bool IsCompatible(const DescriptorSetLayout *, std::string *) const;
+    //   else return false and record the cause of incompatibility in failure
+    bool IsCompatible(const DescriptorSetLayout *, DescriptorSetFailure *) const;
     // Return true if binding 1 beyond given exists and has same type, stageFlags & immutable sampler use
     bool IsNextBindingConsistent(const uint32_t) const;
     // Various Get functions that can either be passed a binding#, which will
@@ -349,10 +399,10 @@ class DescriptorSet : public BASE_NODE {
     // Return true if given binding is present in this set
     bool HasBinding(const uint32_t binding) const { return p_layout_->HasBinding(binding); };
     // Is this set compatible with the given layout?
-    bool IsCompatible(const DescriptorSetLayout *, std::string *) const;
-    // For given bindings validate state at time of draw is correct, returning false on error and writing error details into string*
+    bool IsCompatible(const DescriptorSetLayout *, DescriptorSetFailure *) const;
+    // For given bindings validate state at time of draw is correct, returning false on error and recording error details in failure
     bool ValidateDrawState(const std::map<uint32_t, descriptor_req> &, const std::vector<uint32_t> &, const GLOBAL_CB_NODE *,
-                           const char *caller, std::string *) const;
+                           const char *caller, DescriptorSetFailure *) const;
     // For given set of bindings, add any buffers and images that will be updated to their respective unordered_sets & return number
     // of objects inserted
     uint32_t GetStorageUpdates(const std::map<uint32_t, descriptor_req> &, std::unordered_set<VkBuffer> *,
@@ -0,0 +1,262 @@
+/* Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "mapped_memory_guard.h"
+
+#include <algorithm>
+#include <string.h>
+
+#if defined(__linux__)
+#include <mutex>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+
+namespace {
+
+// Mappings the fault handler searches. The handler only reads the slots, so it takes no locks.
+const size_t kMaxGuardedMappings = 256;
+std::atomic<GuardedMapping *> guarded_mappings[kMaxGuardedMappings];
+
+std::mutex registry_mutex;
+size_t registered_count = 0;
+struct sigaction previous_action;
+
+void GuardedMappingFaultHandler(int sig, siginfo_t *info, void *context) {
+    for (size_t i = 0; i < kMaxGuardedMappings; ++i) {
+        GuardedMapping *mapping = guarded_mappings[i].load(std::memory_order_acquire);
+        if (mapping && mapping->HandleFault(info->si_addr)) return;
+    }
+    // Not one of ours: hand it to whoever was installed before, or let the access fault again with the default action
+    if (previous_action.sa_flags & SA_SIGINFO) {
+        previous_action.sa_sigaction(sig, info, context);
+    } else if (previous_action.sa_handler != SIG_DFL && previous_action.sa_handler != SIG_IGN) {
+        previous_action.sa_handler(sig);
+    } else {
+        signal(SIGSEGV, SIG_DFL);
+    }
+}
+
+bool RegisterMapping(GuardedMapping *mapping) {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (size_t i = 0; i < kMaxGuardedMappings; ++i) {
+        if (guarded_mappings[i].load(std::memory_order_relaxed) == nullptr) {
+            if (registered_count++ == 0) {
+                struct sigaction action = {};
+                action.sa_sigaction = GuardedMappingFaultHandler;
+                action.sa_flags = SA_SIGINFO | SA_ONSTACK | SA_NODEFER;
+                sigemptyset(&action.sa_mask);
+                sigaction(SIGSEGV, &action, &previous_action);
+            }
+            guarded_mappings[i].store(mapping, std::memory_order_release);
+            return true;
+        }
+    }
+    return false;
+}
+
+void UnregisterMapping(GuardedMapping *mapping) {
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    for (size_t i = 0; i < kMaxGuardedMappings; ++i) {
+        if (guarded_mappings[i].load(std::memory_order_relaxed) == mapping) {
+            guarded_mappings[i].store(nullptr, std::memory_order_release);
+            if (--registered_count == 0) {
+                // Put the previous handler back unless someone has replaced ours in the meantime
+                struct sigaction current;
+                sigaction(SIGSEGV, nullptr, &current);
+                if ((current.sa_flags & SA_SIGINFO) && current.sa_sigaction == GuardedMappingFaultHandler) {
+                    sigaction(SIGSEGV, &previous_action, nullptr);
+                }
+            }
+            return;
+        }
+    }
+}
+
+}  // namespace
+
+GuardedMapping *GuardedMapping::Create(void *driver_data, size_t size, uint64_t offset, uint64_t map_alignment,
+                                       char fill_value) {
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (page_size <= 0 || size == 0 || map_alignment == 0 || (page_size % map_alignment) != 0) {
+        return nullptr;
+    }
+    std::unique_ptr<GuardedMapping> mapping(new GuardedMapping);
+    mapping->driver_data_ = driver_data;
+    mapping->size_ = size;
+    mapping->start_offset_ = static_cast<size_t>(offset % map_alignment);
+    mapping->page_size_ = static_cast<size_t>(page_size);
+    mapping->page_count_ = (mapping->start_offset_ + size + mapping->page_size_ - 1) / mapping->page_size_;
+    mapping->fill_value_ = fill_value;
+
+    const size_t data_bytes = mapping->page_count_ * mapping->page_size_;
+    mapping->fd_ = static_cast<int>(syscall(SYS_memfd_create, "vk_guarded_mapping", 1u /* MFD_CLOEXEC */));
+    if (mapping->fd_ < 0 || ftruncate(mapping->fd_, static_cast<off_t>(data_bytes)) != 0) {
+        return nullptr;
+    }
+    void *reservation = mmap(nullptr, data_bytes + 2 * mapping->page_size_, PROT_NONE,
+                             MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (reservation == MAP_FAILED) {
+        return nullptr;
+    }
+    mapping->reservation_ = static_cast<char *>(reservation);
+    if (mmap(mapping->reservation_ + mapping->page_size_, data_bytes, PROT_NONE, MAP_SHARED | MAP_FIXED, mapping->fd_, 0) ==
+        MAP_FAILED) {
+        return nullptr;
+    }
+    mapping->data_ = mapping->reservation_ + mapping->page_size_;
+    void *alias = mmap(nullptr, data_bytes, PROT_READ | PROT_WRITE, MAP_SHARED, mapping->fd_, 0);
+    if (alias == MAP_FAILED) {
+        return nullptr;
+    }
+    mapping->alias_ = static_cast<char *>(alias);
+
+    mapping->page_states_.reset(new std::atomic<uint8_t>[mapping->page_count_]);
+    for (size_t i = 0; i < mapping->page_count_; ++i) {
+        mapping->page_states_[i].store(kUntouched, std::memory_order_relaxed);
+    }
+    if (!RegisterMapping(mapping.get())) {
+        return nullptr;
+    }
+    return mapping.release();
+}
+
+GuardedMapping::~GuardedMapping() {
+    UnregisterMapping(this);
+    const size_t data_bytes = page_count_ * page_size_;
+    if (alias_) munmap(alias_, data_bytes);
+    if (reservation_) munmap(reservation_, data_bytes + 2 * page_size_);
+    if (fd_ >= 0) close(fd_);
+}
+
+// Fills a page of the host copy with the fill value, then with whatever part of the driver's data falls within it
+void GuardedMapping::PopulatePage(size_t page) {
+    const size_t page_begin = page * page_size_;
+    const size_t begin = std::max(page_begin, start_offset_);
+    const size_t end = std::min(page_begin + page_size_, start_offset_ + size_);
+    memset(alias_ + page_begin, fill_value_, page_size_);
+    memcpy(alias_ + begin, static_cast<char *>(driver_data_) + (begin - start_offset_), end - begin);
+}
+
+bool GuardedMapping::HandleFault(const void *address) {
+    const char *fault = static_cast<const char *>(address);
+    const size_t data_bytes = page_count_ * page_size_;
+    if (fault < reservation_ || fault >= data_ + data_bytes + page_size_) {
+        return false;
+    }
+    // Remember an access to a guard page and let it through, so it is reported at the next flush instead of crashing
+    if (fault < data_) {
+        underflow_.store(true);
+        mprotect(reservation_, page_size_, PROT_READ | PROT_WRITE);
+        return true;
+    }
+    if (fault >= data_ + data_bytes) {
+        overflow_.store(true);
+        mprotect(data_ + data_bytes, page_size_, PROT_READ | PROT_WRITE);
+        return true;
+    }
+
+    const size_t page = static_cast<size_t>(fault - data_) / page_size_;
+    std::atomic<uint8_t> &state = page_states_[page];
+    for (;;) {
+        uint8_t current = state.load();
+        if (current == kPopulating) {
+            // Another thread is filling this page; retry the access once it has made it accessible
+            continue;
+        }
+        if (current == kUntouched) {
+            if (!state.compare_exchange_weak(current, kPopulating)) continue;
+            PopulatePage(page);
+        }
+        // First access, or a write to a page that was clean since the last flush
+        state.store(kDirty);
+        mprotect(data_ + page * page_size_, page_size_, PROT_READ | PROT_WRITE);
+        return true;
+    }
+}
+
+void GuardedMapping::CopyDirtyPagesToDriver() {
+    size_t page = 0;
+    while (page < page_count_) {
+        if (page_states_[page].load() != kDirty) {
+            ++page;
+            continue;
+        }
+        // Write protect each run of dirty pages before copying it, so that writes racing with the copy dirty them again
+        const size_t first = page;
+        for (; page < page_count_ && page_states_[page].load() == kDirty; ++page) {
+            page_states_[page].store(kClean);
+        }
+        mprotect(data_ + first * page_size_, (page - first) * page_size_, PROT_READ);
+        const size_t begin = std::max(first * page_size_, start_offset_);
+        const size_t end = std::min(page * page_size_, start_offset_ + size_);
+        memcpy(static_cast<char *>(driver_data_) + (begin - start_offset_), alias_ + begin, end - begin);
+    }
+}
+
+void GuardedMapping::DiscardHostCopy() {
+    mprotect(data_, page_count_ * page_size_, PROT_NONE);
+    for (size_t i = 0; i < page_count_; ++i) {
+        page_states_[i].store(kUntouched);
+    }
+}
+
+bool GuardedMapping::SlackModified(size_t begin, size_t end) const {
+    for (size_t i = begin; i < end; ++i) {
+        if (alias_[i] != fill_value_) return true;
+    }
+    return false;
+}
+
+bool GuardedMapping::UnderflowDetected() const {
+    return underflow_.load() || (page_states_[0].load() >= kClean && SlackModified(0, start_offset_));
+}
+
+bool GuardedMapping::OverflowDetected() const {
+    return overflow_.load() ||
+           (page_states_[page_count_ - 1].load() >= kClean && SlackModified(start_offset_ + size_, page_count_ * page_size_));
+}
+
+#else
+
+GuardedMapping *GuardedMapping::Create(void *driver_data, size_t size, uint64_t offset, uint64_t map_alignment,
+                                       char fill_value) {
+    return nullptr;
+}
+
+GuardedMapping::~GuardedMapping() {}
+
+void GuardedMapping::PopulatePage(size_t page) {}
+
+bool GuardedMapping::HandleFault(const void *address) { return false; }
+
+void GuardedMapping::CopyDirtyPagesToDriver() {}
+
+void GuardedMapping::DiscardHostCopy() {}
+
+bool GuardedMapping::SlackModified(size_t begin, size_t end) const { return false; }
+
+bool GuardedMapping::UnderflowDetected() const { return false; }
+
+bool GuardedMapping::OverflowDetected() const { return false; }
+
+#endif
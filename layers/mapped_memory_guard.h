@@ -0,0 +1,85 @@
+/* Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+#ifndef CORE_VALIDATION_MAPPED_MEMORY_GUARD_H_
+#define CORE_VALIDATION_MAPPED_MEMORY_GUARD_H_
+
+#include <atomic>
+#include <memory>
+#include <stddef.h>
+#include <stdint.h>
+
+// Host copy of a mapped non-coherent memory range, surrounded by inaccessible guard pages.
+//
+// The application writes to pages the layer owns rather than to the driver's mapping. Every page starts out
+// inaccessible; the first access to a page faults, and the fault handler fills it from the driver's mapping and marks
+// it dirty. Flushing copies only the dirty pages to the driver and write protects them again, so the cost of a flush
+// follows the amount of data written instead of the size of the mapping. Accesses to the guard pages are remembered and
+// reported as an underflow or overflow at the next flush, as are writes to the unused bytes that share a page with the
+// start or end of the range.
+//
+// Only available where the layer can handle page faults (Linux); Create returns nullptr elsewhere, or when the mapping
+// cannot be guarded, and the caller falls back to a plain shadow copy.
+class GuardedMapping {
+   public:
+    // offset and map_alignment place the application's data within the first page so that it keeps the alignment the
+    // driver's pointer had; map_alignment must divide the page size.
+    static GuardedMapping *Create(void *driver_data, size_t size, uint64_t offset, uint64_t map_alignment, char fill_value);
+    ~GuardedMapping();
+
+    // Pointer handed to the application in place of the driver's
+    void *data() const { return data_ + start_offset_; }
+
+    // Copies the pages written since the last flush to the driver's mapping
+    void CopyDirtyPagesToDriver();
+    // Drops the host copy, so every page is read from the driver's mapping again on its next access
+    void DiscardHostCopy();
+
+    bool UnderflowDetected() const;
+    bool OverflowDetected() const;
+
+    // Called from the SIGSEGV handler; returns false if address is not in this mapping
+    bool HandleFault(const void *address);
+
+   private:
+    enum PageState : uint8_t { kUntouched, kPopulating, kClean, kDirty };
+
+    GuardedMapping() : underflow_(false), overflow_(false) {}
+    GuardedMapping(const GuardedMapping &) = delete;
+    GuardedMapping &operator=(const GuardedMapping &) = delete;
+
+    void PopulatePage(size_t page);
+    bool SlackModified(size_t begin, size_t end) const;
+
+    void *driver_data_ = nullptr;
+    size_t size_ = 0;
+    size_t start_offset_ = 0;
+    size_t page_size_ = 0;
+    size_t page_count_ = 0;
+    char fill_value_ = 0;
+    int fd_ = -1;
+    // Guard page, data pages and guard page, as the application sees them
+    char *reservation_ = nullptr;
+    char *data_ = nullptr;
+    // The same data pages mapped again, always writable, for the layer's own accesses
+    char *alias_ = nullptr;
+    std::unique_ptr<std::atomic<uint8_t>[]> page_states_;
+    std::atomic<bool> underflow_;
+    std::atomic<bool> overflow_;
+};
+
+#endif  // CORE_VALIDATION_MAPPED_MEMORY_GUARD_H_
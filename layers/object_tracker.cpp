@@ -39,6 +39,7 @@
 #include "vk_layer_logging.h"
 #include "vk_layer_table.h"
 #include "vk_object_types.h"
+#include "vk_command_ids.h"
 #include "vulkan/vk_layer.h"
 
 #include "object_tracker.h"
@@ -320,6 +321,7 @@ static void DestroyObject(T1 dispatchable_object, T2 object, VulkanObjectType ob
 
             delete pNode;
             device_data->object_map[object_type].erase(item);
+            debug_report_forget_object(device_data->report_data, object_handle);
         } else {
             log_msg(device_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, object_handle,
                     __LINE__, OBJTRACK_UNKNOWN_OBJECT, LayerName,
@@ -346,12 +348,12 @@ static bool ValidateObject(T1 dispatchable_object, T2 object, VulkanObjectType o
         if ((object_type != kVulkanObjectTypeImage) ||
             (device_data->swapchainImageMap.find(object_handle) == device_data->swapchainImageMap.end())) {
             // Object not found, look for it in other device object maps
-            for (auto other_device_data : layer_data_map) {
-                if (other_device_data.second != device_data) {
-                    if (other_device_data.second->object_map[object_type].find(object_handle) !=
-                            other_device_data.second->object_map[object_type].end() ||
-                        (object_type == kVulkanObjectTypeImage && other_device_data.second->swapchainImageMap.find(object_handle) !=
-                                                                      other_device_data.second->swapchainImageMap.end())) {
+            for (auto other_device_data : layer_data_map.values()) {
+                if (other_device_data != device_data) {
+                    if (other_device_data->object_map[object_type].find(object_handle) !=
+                            other_device_data->object_map[object_type].end() ||
+                        (object_type == kVulkanObjectTypeImage && other_device_data->swapchainImageMap.find(object_handle) !=
+                                                                      other_device_data->swapchainImageMap.end())) {
                         // Object found on other device, report an error if object has a device parent error code
                         if (wrong_device_code != VALIDATION_ERROR_UNDEFINED) {
                             return log_msg(device_data->report_data, VK_DEBUG_REPORT_ERROR_BIT_EXT, debug_object_type,
@@ -3201,57 +3203,59 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(VkInstance instance,
                                                             const VkAllocationCallbacks *pAllocator, VkSurfaceKHR *pSurface);
 
 static inline PFN_vkVoidFunction InterceptWsiEnabledCommand(const char *name, VkInstance instance) {
-    VkLayerInstanceDispatchTable *pTable = get_dispatch_table(ot_instance_table_map, instance);
-    if (instanceExtMap.size() == 0 || !instanceExtMap[pTable].wsi_enabled) return nullptr;
-
-    if (!strcmp("vkDestroySurfaceKHR", name)) return reinterpret_cast<PFN_vkVoidFunction>(DestroySurfaceKHR);
-    if (!strcmp("vkGetPhysicalDeviceSurfaceSupportKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSurfaceSupportKHR);
-    if (!strcmp("vkGetPhysicalDeviceSurfaceCapabilitiesKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSurfaceCapabilitiesKHR);
-    if (!strcmp("vkGetPhysicalDeviceSurfaceFormatsKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSurfaceFormatsKHR);
-    if (!strcmp("vkGetPhysicalDeviceSurfacePresentModesKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSurfacePresentModesKHR);
-    if ((instanceExtMap[pTable].display_enabled == true) && !strcmp("vkCreateDisplayPlaneSurfaceKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(CreateDisplayPlaneSurfaceKHR);
-
+    using E = instance_extension_enables;
+    static const struct {
+        const char *name;
+        PFN_vkVoidFunction proc;
+        bool E::*enable;
+    } wsi_instance_commands[] = {
+        {"vkDestroySurfaceKHR", reinterpret_cast<PFN_vkVoidFunction>(DestroySurfaceKHR), &E::wsi_enabled},
+        {"vkGetPhysicalDeviceSurfaceSupportKHR", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSurfaceSupportKHR),
+         &E::wsi_enabled},
+        {"vkGetPhysicalDeviceSurfaceCapabilitiesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSurfaceCapabilitiesKHR),
+         &E::wsi_enabled},
+        {"vkGetPhysicalDeviceSurfaceFormatsKHR", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSurfaceFormatsKHR),
+         &E::wsi_enabled},
+        {"vkGetPhysicalDeviceSurfacePresentModesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceSurfacePresentModesKHR),
+         &E::wsi_enabled},
+        {"vkCreateDisplayPlaneSurfaceKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateDisplayPlaneSurfaceKHR), &E::display_enabled},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if ((instanceExtMap[pTable].win32_enabled == true) && !strcmp("vkCreateWin32SurfaceKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(CreateWin32SurfaceKHR);
-    if ((instanceExtMap[pTable].win32_enabled == true) && !strcmp("vkGetPhysicalDeviceWin32PresentationSupportKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceWin32PresentationSupportKHR);
+        {"vkCreateWin32SurfaceKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateWin32SurfaceKHR), &E::win32_enabled},
+        {"vkGetPhysicalDeviceWin32PresentationSupportKHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceWin32PresentationSupportKHR), &E::win32_enabled},
 #endif  // VK_USE_PLATFORM_WIN32_KHR
 #ifdef VK_USE_PLATFORM_XCB_KHR
-    if ((instanceExtMap[pTable].xcb_enabled == true) && !strcmp("vkCreateXcbSurfaceKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(CreateXcbSurfaceKHR);
-    if ((instanceExtMap[pTable].xcb_enabled == true) && !strcmp("vkGetPhysicalDeviceXcbPresentationSupportKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceXcbPresentationSupportKHR);
+        {"vkCreateXcbSurfaceKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateXcbSurfaceKHR), &E::xcb_enabled},
+        {"vkGetPhysicalDeviceXcbPresentationSupportKHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceXcbPresentationSupportKHR), &E::xcb_enabled},
 #endif  // VK_USE_PLATFORM_XCB_KHR
 #ifdef VK_USE_PLATFORM_XLIB_KHR
-    if ((instanceExtMap[pTable].xlib_enabled == true) && !strcmp("vkCreateXlibSurfaceKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(CreateXlibSurfaceKHR);
-    if ((instanceExtMap[pTable].xlib_enabled == true) && !strcmp("vkGetPhysicalDeviceXlibPresentationSupportKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceXlibPresentationSupportKHR);
+        {"vkCreateXlibSurfaceKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateXlibSurfaceKHR), &E::xlib_enabled},
+        {"vkGetPhysicalDeviceXlibPresentationSupportKHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceXlibPresentationSupportKHR), &E::xlib_enabled},
 #endif  // VK_USE_PLATFORM_XLIB_KHR
 #ifdef VK_USE_PLATFORM_MIR_KHR
-    if ((instanceExtMap[pTable].mir_enabled == true) && !strcmp("vkCreateMirSurfaceKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(CreateMirSurfaceKHR);
-    if ((instanceExtMap[pTable].mir_enabled == true) && !strcmp("vkGetPhysicalDeviceMirPresentationSupportKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceMirPresentationSupportKHR);
+        {"vkCreateMirSurfaceKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateMirSurfaceKHR), &E::mir_enabled},
+        {"vkGetPhysicalDeviceMirPresentationSupportKHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceMirPresentationSupportKHR), &E::mir_enabled},
 #endif  // VK_USE_PLATFORM_MIR_KHR
 #ifdef VK_USE_PLATFORM_WAYLAND_KHR
-    if ((instanceExtMap[pTable].wayland_enabled == true) && !strcmp("vkCreateWaylandSurfaceKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(CreateWaylandSurfaceKHR);
-    if ((instanceExtMap[pTable].wayland_enabled == true) && !strcmp("vkGetPhysicalDeviceWaylandPresentationSupportKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceWaylandPresentationSupportKHR);
+        {"vkCreateWaylandSurfaceKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateWaylandSurfaceKHR), &E::wayland_enabled},
+        {"vkGetPhysicalDeviceWaylandPresentationSupportKHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceWaylandPresentationSupportKHR), &E::wayland_enabled},
 #endif  // VK_USE_PLATFORM_WAYLAND_KHR
 #ifdef VK_USE_PLATFORM_ANDROID_KHR
-    if ((instanceExtMap[pTable].android_enabled == true) && !strcmp("vkCreateAndroidSurfaceKHR", name))
-        return reinterpret_cast<PFN_vkVoidFunction>(CreateAndroidSurfaceKHR);
+        {"vkCreateAndroidSurfaceKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateAndroidSurfaceKHR), &E::android_enabled},
 #endif  // VK_USE_PLATFORM_ANDROID_KHR
+    };
+    static const auto wsi_instance_table = MakeVkCommandTable(wsi_instance_commands);
 
-    return nullptr;
+    auto command = wsi_instance_table.Find(name);
+    if (!command) return nullptr;
+
+    VkLayerInstanceDispatchTable *pTable = get_dispatch_table(ot_instance_table_map, instance);
+    if (instanceExtMap.size() == 0 || !instanceExtMap[pTable].wsi_enabled) return nullptr;
+    return (instanceExtMap[pTable].*(command->enable)) ? command->proc : nullptr;
 }
 
 static void CheckDeviceRegisterExtensions(const VkDeviceCreateInfo *pCreateInfo, VkDevice device) {
@@ -5042,333 +5046,319 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(VkDevice device, uint32_t swapchain
 }
 
 static inline PFN_vkVoidFunction InterceptCoreDeviceCommand(const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
-
-    name += 2;
-    if (!strcmp(name, "GetDeviceProcAddr")) return (PFN_vkVoidFunction)GetDeviceProcAddr;
-    if (!strcmp(name, "DestroyDevice")) return (PFN_vkVoidFunction)DestroyDevice;
-    if (!strcmp(name, "GetDeviceQueue")) return (PFN_vkVoidFunction)GetDeviceQueue;
-    if (!strcmp(name, "QueueSubmit")) return (PFN_vkVoidFunction)QueueSubmit;
-    if (!strcmp(name, "QueueWaitIdle")) return (PFN_vkVoidFunction)QueueWaitIdle;
-    if (!strcmp(name, "DeviceWaitIdle")) return (PFN_vkVoidFunction)DeviceWaitIdle;
-    if (!strcmp(name, "AllocateMemory")) return (PFN_vkVoidFunction)AllocateMemory;
-    if (!strcmp(name, "FreeMemory")) return (PFN_vkVoidFunction)FreeMemory;
-    if (!strcmp(name, "MapMemory")) return (PFN_vkVoidFunction)MapMemory;
-    if (!strcmp(name, "UnmapMemory")) return (PFN_vkVoidFunction)UnmapMemory;
-    if (!strcmp(name, "FlushMappedMemoryRanges")) return (PFN_vkVoidFunction)FlushMappedMemoryRanges;
-    if (!strcmp(name, "InvalidateMappedMemoryRanges")) return (PFN_vkVoidFunction)InvalidateMappedMemoryRanges;
-    if (!strcmp(name, "GetDeviceMemoryCommitment")) return (PFN_vkVoidFunction)GetDeviceMemoryCommitment;
-    if (!strcmp(name, "BindBufferMemory")) return (PFN_vkVoidFunction)BindBufferMemory;
-    if (!strcmp(name, "BindImageMemory")) return (PFN_vkVoidFunction)BindImageMemory;
-    if (!strcmp(name, "GetBufferMemoryRequirements")) return (PFN_vkVoidFunction)GetBufferMemoryRequirements;
-    if (!strcmp(name, "GetImageMemoryRequirements")) return (PFN_vkVoidFunction)GetImageMemoryRequirements;
-    if (!strcmp(name, "GetImageSparseMemoryRequirements")) return (PFN_vkVoidFunction)GetImageSparseMemoryRequirements;
-    if (!strcmp(name, "QueueBindSparse")) return (PFN_vkVoidFunction)QueueBindSparse;
-    if (!strcmp(name, "CreateFence")) return (PFN_vkVoidFunction)CreateFence;
-    if (!strcmp(name, "DestroyFence")) return (PFN_vkVoidFunction)DestroyFence;
-    if (!strcmp(name, "ResetFences")) return (PFN_vkVoidFunction)ResetFences;
-    if (!strcmp(name, "GetFenceStatus")) return (PFN_vkVoidFunction)GetFenceStatus;
-    if (!strcmp(name, "WaitForFences")) return (PFN_vkVoidFunction)WaitForFences;
-    if (!strcmp(name, "CreateSemaphore")) return (PFN_vkVoidFunction)CreateSemaphore;
-    if (!strcmp(name, "DestroySemaphore")) return (PFN_vkVoidFunction)DestroySemaphore;
-    if (!strcmp(name, "CreateEvent")) return (PFN_vkVoidFunction)CreateEvent;
-    if (!strcmp(name, "DestroyEvent")) return (PFN_vkVoidFunction)DestroyEvent;
-    if (!strcmp(name, "GetEventStatus")) return (PFN_vkVoidFunction)GetEventStatus;
-    if (!strcmp(name, "SetEvent")) return (PFN_vkVoidFunction)SetEvent;
-    if (!strcmp(name, "ResetEvent")) return (PFN_vkVoidFunction)ResetEvent;
-    if (!strcmp(name, "CreateQueryPool")) return (PFN_vkVoidFunction)CreateQueryPool;
-    if (!strcmp(name, "DestroyQueryPool")) return (PFN_vkVoidFunction)DestroyQueryPool;
-    if (!strcmp(name, "GetQueryPoolResults")) return (PFN_vkVoidFunction)GetQueryPoolResults;
-    if (!strcmp(name, "CreateBuffer")) return (PFN_vkVoidFunction)CreateBuffer;
-    if (!strcmp(name, "DestroyBuffer")) return (PFN_vkVoidFunction)DestroyBuffer;
-    if (!strcmp(name, "CreateBufferView")) return (PFN_vkVoidFunction)CreateBufferView;
-    if (!strcmp(name, "DestroyBufferView")) return (PFN_vkVoidFunction)DestroyBufferView;
-    if (!strcmp(name, "CreateImage")) return (PFN_vkVoidFunction)CreateImage;
-    if (!strcmp(name, "DestroyImage")) return (PFN_vkVoidFunction)DestroyImage;
-    if (!strcmp(name, "GetImageSubresourceLayout")) return (PFN_vkVoidFunction)GetImageSubresourceLayout;
-    if (!strcmp(name, "CreateImageView")) return (PFN_vkVoidFunction)CreateImageView;
-    if (!strcmp(name, "DestroyImageView")) return (PFN_vkVoidFunction)DestroyImageView;
-    if (!strcmp(name, "CreateShaderModule")) return (PFN_vkVoidFunction)CreateShaderModule;
-    if (!strcmp(name, "DestroyShaderModule")) return (PFN_vkVoidFunction)DestroyShaderModule;
-    if (!strcmp(name, "CreatePipelineCache")) return (PFN_vkVoidFunction)CreatePipelineCache;
-    if (!strcmp(name, "DestroyPipelineCache")) return (PFN_vkVoidFunction)DestroyPipelineCache;
-    if (!strcmp(name, "GetPipelineCacheData")) return (PFN_vkVoidFunction)GetPipelineCacheData;
-    if (!strcmp(name, "MergePipelineCaches")) return (PFN_vkVoidFunction)MergePipelineCaches;
-    if (!strcmp(name, "CreateGraphicsPipelines")) return (PFN_vkVoidFunction)CreateGraphicsPipelines;
-    if (!strcmp(name, "CreateComputePipelines")) return (PFN_vkVoidFunction)CreateComputePipelines;
-    if (!strcmp(name, "DestroyPipeline")) return (PFN_vkVoidFunction)DestroyPipeline;
-    if (!strcmp(name, "CreatePipelineLayout")) return (PFN_vkVoidFunction)CreatePipelineLayout;
-    if (!strcmp(name, "DestroyPipelineLayout")) return (PFN_vkVoidFunction)DestroyPipelineLayout;
-    if (!strcmp(name, "CreateSampler")) return (PFN_vkVoidFunction)CreateSampler;
-    if (!strcmp(name, "DestroySampler")) return (PFN_vkVoidFunction)DestroySampler;
-    if (!strcmp(name, "CreateDescriptorSetLayout")) return (PFN_vkVoidFunction)CreateDescriptorSetLayout;
-    if (!strcmp(name, "DestroyDescriptorSetLayout")) return (PFN_vkVoidFunction)DestroyDescriptorSetLayout;
-    if (!strcmp(name, "CreateDescriptorPool")) return (PFN_vkVoidFunction)CreateDescriptorPool;
-    if (!strcmp(name, "DestroyDescriptorPool")) return (PFN_vkVoidFunction)DestroyDescriptorPool;
-    if (!strcmp(name, "ResetDescriptorPool")) return (PFN_vkVoidFunction)ResetDescriptorPool;
-    if (!strcmp(name, "AllocateDescriptorSets")) return (PFN_vkVoidFunction)AllocateDescriptorSets;
-    if (!strcmp(name, "FreeDescriptorSets")) return (PFN_vkVoidFunction)FreeDescriptorSets;
-    if (!strcmp(name, "UpdateDescriptorSets")) return (PFN_vkVoidFunction)UpdateDescriptorSets;
-    if (!strcmp(name, "CreateFramebuffer")) return (PFN_vkVoidFunction)CreateFramebuffer;
-    if (!strcmp(name, "DestroyFramebuffer")) return (PFN_vkVoidFunction)DestroyFramebuffer;
-    if (!strcmp(name, "CreateRenderPass")) return (PFN_vkVoidFunction)CreateRenderPass;
-    if (!strcmp(name, "DestroyRenderPass")) return (PFN_vkVoidFunction)DestroyRenderPass;
-    if (!strcmp(name, "GetRenderAreaGranularity")) return (PFN_vkVoidFunction)GetRenderAreaGranularity;
-    if (!strcmp(name, "CreateCommandPool")) return (PFN_vkVoidFunction)CreateCommandPool;
-    if (!strcmp(name, "DestroyCommandPool")) return (PFN_vkVoidFunction)DestroyCommandPool;
-    if (!strcmp(name, "ResetCommandPool")) return (PFN_vkVoidFunction)ResetCommandPool;
-    if (!strcmp(name, "AllocateCommandBuffers")) return (PFN_vkVoidFunction)AllocateCommandBuffers;
-    if (!strcmp(name, "FreeCommandBuffers")) return (PFN_vkVoidFunction)FreeCommandBuffers;
-    if (!strcmp(name, "BeginCommandBuffer")) return (PFN_vkVoidFunction)BeginCommandBuffer;
-    if (!strcmp(name, "EndCommandBuffer")) return (PFN_vkVoidFunction)EndCommandBuffer;
-    if (!strcmp(name, "ResetCommandBuffer")) return (PFN_vkVoidFunction)ResetCommandBuffer;
-    if (!strcmp(name, "CmdBindPipeline")) return (PFN_vkVoidFunction)CmdBindPipeline;
-    if (!strcmp(name, "CmdSetViewport")) return (PFN_vkVoidFunction)CmdSetViewport;
-    if (!strcmp(name, "CmdSetScissor")) return (PFN_vkVoidFunction)CmdSetScissor;
-    if (!strcmp(name, "CmdSetLineWidth")) return (PFN_vkVoidFunction)CmdSetLineWidth;
-    if (!strcmp(name, "CmdSetDepthBias")) return (PFN_vkVoidFunction)CmdSetDepthBias;
-    if (!strcmp(name, "CmdSetBlendConstants")) return (PFN_vkVoidFunction)CmdSetBlendConstants;
-    if (!strcmp(name, "CmdSetDepthBounds")) return (PFN_vkVoidFunction)CmdSetDepthBounds;
-    if (!strcmp(name, "CmdSetStencilCompareMask")) return (PFN_vkVoidFunction)CmdSetStencilCompareMask;
-    if (!strcmp(name, "CmdSetStencilWriteMask")) return (PFN_vkVoidFunction)CmdSetStencilWriteMask;
-    if (!strcmp(name, "CmdSetStencilReference")) return (PFN_vkVoidFunction)CmdSetStencilReference;
-    if (!strcmp(name, "CmdBindDescriptorSets")) return (PFN_vkVoidFunction)CmdBindDescriptorSets;
-    if (!strcmp(name, "CmdBindIndexBuffer")) return (PFN_vkVoidFunction)CmdBindIndexBuffer;
-    if (!strcmp(name, "CmdBindVertexBuffers")) return (PFN_vkVoidFunction)CmdBindVertexBuffers;
-    if (!strcmp(name, "CmdDraw")) return (PFN_vkVoidFunction)CmdDraw;
-    if (!strcmp(name, "CmdDrawIndexed")) return (PFN_vkVoidFunction)CmdDrawIndexed;
-    if (!strcmp(name, "CmdDrawIndirect")) return (PFN_vkVoidFunction)CmdDrawIndirect;
-    if (!strcmp(name, "CmdDrawIndexedIndirect")) return (PFN_vkVoidFunction)CmdDrawIndexedIndirect;
-    if (!strcmp(name, "CmdDispatch")) return (PFN_vkVoidFunction)CmdDispatch;
-    if (!strcmp(name, "CmdDispatchIndirect")) return (PFN_vkVoidFunction)CmdDispatchIndirect;
-    if (!strcmp(name, "CmdCopyBuffer")) return (PFN_vkVoidFunction)CmdCopyBuffer;
-    if (!strcmp(name, "CmdCopyImage")) return (PFN_vkVoidFunction)CmdCopyImage;
-    if (!strcmp(name, "CmdBlitImage")) return (PFN_vkVoidFunction)CmdBlitImage;
-    if (!strcmp(name, "CmdCopyBufferToImage")) return (PFN_vkVoidFunction)CmdCopyBufferToImage;
-    if (!strcmp(name, "CmdCopyImageToBuffer")) return (PFN_vkVoidFunction)CmdCopyImageToBuffer;
-    if (!strcmp(name, "CmdUpdateBuffer")) return (PFN_vkVoidFunction)CmdUpdateBuffer;
-    if (!strcmp(name, "CmdFillBuffer")) return (PFN_vkVoidFunction)CmdFillBuffer;
-    if (!strcmp(name, "CmdClearColorImage")) return (PFN_vkVoidFunction)CmdClearColorImage;
-    if (!strcmp(name, "CmdClearDepthStencilImage")) return (PFN_vkVoidFunction)CmdClearDepthStencilImage;
-    if (!strcmp(name, "CmdClearAttachments")) return (PFN_vkVoidFunction)CmdClearAttachments;
-    if (!strcmp(name, "CmdResolveImage")) return (PFN_vkVoidFunction)CmdResolveImage;
-    if (!strcmp(name, "CmdSetEvent")) return (PFN_vkVoidFunction)CmdSetEvent;
-    if (!strcmp(name, "CmdResetEvent")) return (PFN_vkVoidFunction)CmdResetEvent;
-    if (!strcmp(name, "CmdWaitEvents")) return (PFN_vkVoidFunction)CmdWaitEvents;
-    if (!strcmp(name, "CmdPipelineBarrier")) return (PFN_vkVoidFunction)CmdPipelineBarrier;
-    if (!strcmp(name, "CmdBeginQuery")) return (PFN_vkVoidFunction)CmdBeginQuery;
-    if (!strcmp(name, "CmdEndQuery")) return (PFN_vkVoidFunction)CmdEndQuery;
-    if (!strcmp(name, "CmdResetQueryPool")) return (PFN_vkVoidFunction)CmdResetQueryPool;
-    if (!strcmp(name, "CmdWriteTimestamp")) return (PFN_vkVoidFunction)CmdWriteTimestamp;
-    if (!strcmp(name, "CmdCopyQueryPoolResults")) return (PFN_vkVoidFunction)CmdCopyQueryPoolResults;
-    if (!strcmp(name, "CmdPushConstants")) return (PFN_vkVoidFunction)CmdPushConstants;
-    if (!strcmp(name, "CmdBeginRenderPass")) return (PFN_vkVoidFunction)CmdBeginRenderPass;
-    if (!strcmp(name, "CmdNextSubpass")) return (PFN_vkVoidFunction)CmdNextSubpass;
-    if (!strcmp(name, "CmdEndRenderPass")) return (PFN_vkVoidFunction)CmdEndRenderPass;
-    if (!strcmp(name, "CmdExecuteCommands")) return (PFN_vkVoidFunction)CmdExecuteCommands;
-    if (!strcmp(name, "DebugMarkerSetObjectTagEXT")) return (PFN_vkVoidFunction)DebugMarkerSetObjectTagEXT;
-    if (!strcmp(name, "DebugMarkerSetObjectNameEXT")) return (PFN_vkVoidFunction)DebugMarkerSetObjectNameEXT;
-    if (!strcmp(name, "CmdDebugMarkerBeginEXT")) return (PFN_vkVoidFunction)CmdDebugMarkerBeginEXT;
-    if (!strcmp(name, "CmdDebugMarkerEndEXT")) return (PFN_vkVoidFunction)CmdDebugMarkerEndEXT;
-    if (!strcmp(name, "CmdDebugMarkerInsertEXT")) return (PFN_vkVoidFunction)CmdDebugMarkerInsertEXT;
+    static const struct {
+        const char *name;
+        PFN_vkVoidFunction proc;
+    } core_device_commands[] = {
+        {"vkGetDeviceProcAddr", (PFN_vkVoidFunction)GetDeviceProcAddr},
+        {"vkDestroyDevice", (PFN_vkVoidFunction)DestroyDevice},
+        {"vkGetDeviceQueue", (PFN_vkVoidFunction)GetDeviceQueue},
+        {"vkQueueSubmit", (PFN_vkVoidFunction)QueueSubmit},
+        {"vkQueueWaitIdle", (PFN_vkVoidFunction)QueueWaitIdle},
+        {"vkDeviceWaitIdle", (PFN_vkVoidFunction)DeviceWaitIdle},
+        {"vkAllocateMemory", (PFN_vkVoidFunction)AllocateMemory},
+        {"vkFreeMemory", (PFN_vkVoidFunction)FreeMemory},
+        {"vkMapMemory", (PFN_vkVoidFunction)MapMemory},
+        {"vkUnmapMemory", (PFN_vkVoidFunction)UnmapMemory},
+        {"vkFlushMappedMemoryRanges", (PFN_vkVoidFunction)FlushMappedMemoryRanges},
+        {"vkInvalidateMappedMemoryRanges", (PFN_vkVoidFunction)InvalidateMappedMemoryRanges},
+        {"vkGetDeviceMemoryCommitment", (PFN_vkVoidFunction)GetDeviceMemoryCommitment},
+        {"vkBindBufferMemory", (PFN_vkVoidFunction)BindBufferMemory},
+        {"vkBindImageMemory", (PFN_vkVoidFunction)BindImageMemory},
+        {"vkGetBufferMemoryRequirements", (PFN_vkVoidFunction)GetBufferMemoryRequirements},
+        {"vkGetImageMemoryRequirements", (PFN_vkVoidFunction)GetImageMemoryRequirements},
+        {"vkGetImageSparseMemoryRequirements", (PFN_vkVoidFunction)GetImageSparseMemoryRequirements},
+        {"vkQueueBindSparse", (PFN_vkVoidFunction)QueueBindSparse},
+        {"vkCreateFence", (PFN_vkVoidFunction)CreateFence},
+        {"vkDestroyFence", (PFN_vkVoidFunction)DestroyFence},
+        {"vkResetFences", (PFN_vkVoidFunction)ResetFences},
+        {"vkGetFenceStatus", (PFN_vkVoidFunction)GetFenceStatus},
+        {"vkWaitForFences", (PFN_vkVoidFunction)WaitForFences},
+        {"vkCreateSemaphore", (PFN_vkVoidFunction)CreateSemaphore},
+        {"vkDestroySemaphore", (PFN_vkVoidFunction)DestroySemaphore},
+        {"vkCreateEvent", (PFN_vkVoidFunction)CreateEvent},
+        {"vkDestroyEvent", (PFN_vkVoidFunction)DestroyEvent},
+        {"vkGetEventStatus", (PFN_vkVoidFunction)GetEventStatus},
+        {"vkSetEvent", (PFN_vkVoidFunction)SetEvent},
+        {"vkResetEvent", (PFN_vkVoidFunction)ResetEvent},
+        {"vkCreateQueryPool", (PFN_vkVoidFunction)CreateQueryPool},
+        {"vkDestroyQueryPool", (PFN_vkVoidFunction)DestroyQueryPool},
+        {"vkGetQueryPoolResults", (PFN_vkVoidFunction)GetQueryPoolResults},
+        {"vkCreateBuffer", (PFN_vkVoidFunction)CreateBuffer},
+        {"vkDestroyBuffer", (PFN_vkVoidFunction)DestroyBuffer},
+        {"vkCreateBufferView", (PFN_vkVoidFunction)CreateBufferView},
+        {"vkDestroyBufferView", (PFN_vkVoidFunction)DestroyBufferView},
+        {"vkCreateImage", (PFN_vkVoidFunction)CreateImage},
+        {"vkDestroyImage", (PFN_vkVoidFunction)DestroyImage},
+        {"vkGetImageSubresourceLayout", (PFN_vkVoidFunction)GetImageSubresourceLayout},
+        {"vkCreateImageView", (PFN_vkVoidFunction)CreateImageView},
+        {"vkDestroyImageView", (PFN_vkVoidFunction)DestroyImageView},
+        {"vkCreateShaderModule", (PFN_vkVoidFunction)CreateShaderModule},
+        {"vkDestroyShaderModule", (PFN_vkVoidFunction)DestroyShaderModule},
+        {"vkCreatePipelineCache", (PFN_vkVoidFunction)CreatePipelineCache},
+        {"vkDestroyPipelineCache", (PFN_vkVoidFunction)DestroyPipelineCache},
+        {"vkGetPipelineCacheData", (PFN_vkVoidFunction)GetPipelineCacheData},
+        {"vkMergePipelineCaches", (PFN_vkVoidFunction)MergePipelineCaches},
+        {"vkCreateGraphicsPipelines", (PFN_vkVoidFunction)CreateGraphicsPipelines},
+        {"vkCreateComputePipelines", (PFN_vkVoidFunction)CreateComputePipelines},
+        {"vkDestroyPipeline", (PFN_vkVoidFunction)DestroyPipeline},
+        {"vkCreatePipelineLayout", (PFN_vkVoidFunction)CreatePipelineLayout},
+        {"vkDestroyPipelineLayout", (PFN_vkVoidFunction)DestroyPipelineLayout},
+        {"vkCreateSampler", (PFN_vkVoidFunction)CreateSampler},
+        {"vkDestroySampler", (PFN_vkVoidFunction)DestroySampler},
+        {"vkCreateDescriptorSetLayout", (PFN_vkVoidFunction)CreateDescriptorSetLayout},
+        {"vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction)DestroyDescriptorSetLayout},
+        {"vkCreateDescriptorPool", (PFN_vkVoidFunction)CreateDescriptorPool},
+        {"vkDestroyDescriptorPool", (PFN_vkVoidFunction)DestroyDescriptorPool},
+        {"vkResetDescriptorPool", (PFN_vkVoidFunction)ResetDescriptorPool},
+        {"vkAllocateDescriptorSets", (PFN_vkVoidFunction)AllocateDescriptorSets},
+        {"vkFreeDescriptorSets", (PFN_vkVoidFunction)FreeDescriptorSets},
+        {"vkUpdateDescriptorSets", (PFN_vkVoidFunction)UpdateDescriptorSets},
+        {"vkCreateFramebuffer", (PFN_vkVoidFunction)CreateFramebuffer},
+        {"vkDestroyFramebuffer", (PFN_vkVoidFunction)DestroyFramebuffer},
+        {"vkCreateRenderPass", (PFN_vkVoidFunction)CreateRenderPass},
+        {"vkDestroyRenderPass", (PFN_vkVoidFunction)DestroyRenderPass},
+        {"vkGetRenderAreaGranularity", (PFN_vkVoidFunction)GetRenderAreaGranularity},
+        {"vkCreateCommandPool", (PFN_vkVoidFunction)CreateCommandPool},
+        {"vkDestroyCommandPool", (PFN_vkVoidFunction)DestroyCommandPool},
+        {"vkResetCommandPool", (PFN_vkVoidFunction)ResetCommandPool},
+        {"vkAllocateCommandBuffers", (PFN_vkVoidFunction)AllocateCommandBuffers},
+        {"vkFreeCommandBuffers", (PFN_vkVoidFunction)FreeCommandBuffers},
+        {"vkBeginCommandBuffer", (PFN_vkVoidFunction)BeginCommandBuffer},
+        {"vkEndCommandBuffer", (PFN_vkVoidFunction)EndCommandBuffer},
+        {"vkResetCommandBuffer", (PFN_vkVoidFunction)ResetCommandBuffer},
+        {"vkCmdBindPipeline", (PFN_vkVoidFunction)CmdBindPipeline},
+        {"vkCmdSetViewport", (PFN_vkVoidFunction)CmdSetViewport},
+        {"vkCmdSetScissor", (PFN_vkVoidFunction)CmdSetScissor},
+        {"vkCmdSetLineWidth", (PFN_vkVoidFunction)CmdSetLineWidth},
+        {"vkCmdSetDepthBias", (PFN_vkVoidFunction)CmdSetDepthBias},
+        {"vkCmdSetBlendConstants", (PFN_vkVoidFunction)CmdSetBlendConstants},
+        {"vkCmdSetDepthBounds", (PFN_vkVoidFunction)CmdSetDepthBounds},
+        {"vkCmdSetStencilCompareMask", (PFN_vkVoidFunction)CmdSetStencilCompareMask},
+        {"vkCmdSetStencilWriteMask", (PFN_vkVoidFunction)CmdSetStencilWriteMask},
+        {"vkCmdSetStencilReference", (PFN_vkVoidFunction)CmdSetStencilReference},
+        {"vkCmdBindDescriptorSets", (PFN_vkVoidFunction)CmdBindDescriptorSets},
+        {"vkCmdBindIndexBuffer", (PFN_vkVoidFunction)CmdBindIndexBuffer},
+        {"vkCmdBindVertexBuffers", (PFN_vkVoidFunction)CmdBindVertexBuffers},
+        {"vkCmdDraw", (PFN_vkVoidFunction)CmdDraw},
+        {"vkCmdDrawIndexed", (PFN_vkVoidFunction)CmdDrawIndexed},
+        {"vkCmdDrawIndirect", (PFN_vkVoidFunction)CmdDrawIndirect},
+        {"vkCmdDrawIndexedIndirect", (PFN_vkVoidFunction)CmdDrawIndexedIndirect},
+        {"vkCmdDispatch", (PFN_vkVoidFunction)CmdDispatch},
+        {"vkCmdDispatchIndirect", (PFN_vkVoidFunction)CmdDispatchIndirect},
+        {"vkCmdCopyBuffer", (PFN_vkVoidFunction)CmdCopyBuffer},
+        {"vkCmdCopyImage", (PFN_vkVoidFunction)CmdCopyImage},
+        {"vkCmdBlitImage", (PFN_vkVoidFunction)CmdBlitImage},
+        {"vkCmdCopyBufferToImage", (PFN_vkVoidFunction)CmdCopyBufferToImage},
+        {"vkCmdCopyImageToBuffer", (PFN_vkVoidFunction)CmdCopyImageToBuffer},
+        {"vkCmdUpdateBuffer", (PFN_vkVoidFunction)CmdUpdateBuffer},
+        {"vkCmdFillBuffer", (PFN_vkVoidFunction)CmdFillBuffer},
+        {"vkCmdClearColorImage", (PFN_vkVoidFunction)CmdClearColorImage},
+        {"vkCmdClearDepthStencilImage", (PFN_vkVoidFunction)CmdClearDepthStencilImage},
+        {"vkCmdClearAttachments", (PFN_vkVoidFunction)CmdClearAttachments},
+        {"vkCmdResolveImage", (PFN_vkVoidFunction)CmdResolveImage},
+        {"vkCmdSetEvent", (PFN_vkVoidFunction)CmdSetEvent},
+        {"vkCmdResetEvent", (PFN_vkVoidFunction)CmdResetEvent},
+        {"vkCmdWaitEvents", (PFN_vkVoidFunction)CmdWaitEvents},
+        {"vkCmdPipelineBarrier", (PFN_vkVoidFunction)CmdPipelineBarrier},
+        {"vkCmdBeginQuery", (PFN_vkVoidFunction)CmdBeginQuery},
+        {"vkCmdEndQuery", (PFN_vkVoidFunction)CmdEndQuery},
+        {"vkCmdResetQueryPool", (PFN_vkVoidFunction)CmdResetQueryPool},
+        {"vkCmdWriteTimestamp", (PFN_vkVoidFunction)CmdWriteTimestamp},
+        {"vkCmdCopyQueryPoolResults", (PFN_vkVoidFunction)CmdCopyQueryPoolResults},
+        {"vkCmdPushConstants", (PFN_vkVoidFunction)CmdPushConstants},
+        {"vkCmdBeginRenderPass", (PFN_vkVoidFunction)CmdBeginRenderPass},
+        {"vkCmdNextSubpass", (PFN_vkVoidFunction)CmdNextSubpass},
+        {"vkCmdEndRenderPass", (PFN_vkVoidFunction)CmdEndRenderPass},
+        {"vkCmdExecuteCommands", (PFN_vkVoidFunction)CmdExecuteCommands},
+        {"vkDebugMarkerSetObjectTagEXT", (PFN_vkVoidFunction)DebugMarkerSetObjectTagEXT},
+        {"vkDebugMarkerSetObjectNameEXT", (PFN_vkVoidFunction)DebugMarkerSetObjectNameEXT},
+        {"vkCmdDebugMarkerBeginEXT", (PFN_vkVoidFunction)CmdDebugMarkerBeginEXT},
+        {"vkCmdDebugMarkerEndEXT", (PFN_vkVoidFunction)CmdDebugMarkerEndEXT},
+        {"vkCmdDebugMarkerInsertEXT", (PFN_vkVoidFunction)CmdDebugMarkerInsertEXT},
 #ifdef VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "GetMemoryWin32HandleNV")) return (PFN_vkVoidFunction)GetMemoryWin32HandleNV;
+        {"vkGetMemoryWin32HandleNV", (PFN_vkVoidFunction)GetMemoryWin32HandleNV},
 #endif  // VK_USE_PLATFORM_WIN32_KHR
-    if (!strcmp(name, "CmdDrawIndirectCountAMD")) return (PFN_vkVoidFunction)CmdDrawIndirectCountAMD;
-    if (!strcmp(name, "CmdDrawIndexedIndirectCountAMD")) return (PFN_vkVoidFunction)CmdDrawIndexedIndirectCountAMD;
-    if (!strcmp(name, "SetHdrMetadataEXT")) return (PFN_vkVoidFunction)SetHdrMetadataEXT;
+        {"vkCmdDrawIndirectCountAMD", (PFN_vkVoidFunction)CmdDrawIndirectCountAMD},
+        {"vkCmdDrawIndexedIndirectCountAMD", (PFN_vkVoidFunction)CmdDrawIndexedIndirectCountAMD},
+        {"vkSetHdrMetadataEXT", (PFN_vkVoidFunction)SetHdrMetadataEXT},
+    };
+    static const auto core_device_table = MakeVkCommandTable(core_device_commands);
 
-    return NULL;
+    auto command = core_device_table.Find(name);
+    return command ? command->proc : NULL;
 }
 
 static inline PFN_vkVoidFunction InterceptCoreInstanceCommand(const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
-
-    name += 2;
-    if (!strcmp(name, "CreateInstance")) return (PFN_vkVoidFunction)CreateInstance;
-    if (!strcmp(name, "DestroyInstance")) return (PFN_vkVoidFunction)DestroyInstance;
-    if (!strcmp(name, "EnumeratePhysicalDevices")) return (PFN_vkVoidFunction)EnumeratePhysicalDevices;
-    if (!strcmp(name, "_layerGetPhysicalDeviceProcAddr")) return (PFN_vkVoidFunction)GetPhysicalDeviceProcAddr;
-    if (!strcmp(name, "GetPhysicalDeviceFeatures")) return (PFN_vkVoidFunction)GetPhysicalDeviceFeatures;
-    if (!strcmp(name, "GetPhysicalDeviceFormatProperties")) return (PFN_vkVoidFunction)GetPhysicalDeviceFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceImageFormatProperties")) return (PFN_vkVoidFunction)GetPhysicalDeviceImageFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceProperties")) return (PFN_vkVoidFunction)GetPhysicalDeviceProperties;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyProperties")) return (PFN_vkVoidFunction)GetPhysicalDeviceQueueFamilyProperties;
-    if (!strcmp(name, "GetPhysicalDeviceMemoryProperties")) return (PFN_vkVoidFunction)GetPhysicalDeviceMemoryProperties;
-    if (!strcmp(name, "GetInstanceProcAddr")) return (PFN_vkVoidFunction)GetInstanceProcAddr;
-    if (!strcmp(name, "CreateDevice")) return (PFN_vkVoidFunction)CreateDevice;
-    if (!strcmp(name, "EnumerateInstanceExtensionProperties")) return (PFN_vkVoidFunction)EnumerateInstanceExtensionProperties;
-    if (!strcmp(name, "EnumerateInstanceLayerProperties")) return (PFN_vkVoidFunction)EnumerateInstanceLayerProperties;
-    if (!strcmp(name, "EnumerateDeviceLayerProperties")) return (PFN_vkVoidFunction)EnumerateDeviceLayerProperties;
-    if (!strcmp(name, "GetPhysicalDeviceSparseImageFormatProperties"))
-        return (PFN_vkVoidFunction)GetPhysicalDeviceSparseImageFormatProperties;
-    if (!strcmp(name, "GetPhysicalDeviceExternalImageFormatPropertiesNV"))
-        return (PFN_vkVoidFunction)GetPhysicalDeviceExternalImageFormatPropertiesNV;
-
-    return NULL;
+    static const struct {
+        const char *name;
+        PFN_vkVoidFunction proc;
+    } core_instance_commands[] = {
+        {"vkCreateInstance", (PFN_vkVoidFunction)CreateInstance},
+        {"vkDestroyInstance", (PFN_vkVoidFunction)DestroyInstance},
+        {"vkEnumeratePhysicalDevices", (PFN_vkVoidFunction)EnumeratePhysicalDevices},
+        {"vk_layerGetPhysicalDeviceProcAddr", (PFN_vkVoidFunction)GetPhysicalDeviceProcAddr},
+        {"vkGetPhysicalDeviceFeatures", (PFN_vkVoidFunction)GetPhysicalDeviceFeatures},
+        {"vkGetPhysicalDeviceFormatProperties", (PFN_vkVoidFunction)GetPhysicalDeviceFormatProperties},
+        {"vkGetPhysicalDeviceImageFormatProperties", (PFN_vkVoidFunction)GetPhysicalDeviceImageFormatProperties},
+        {"vkGetPhysicalDeviceProperties", (PFN_vkVoidFunction)GetPhysicalDeviceProperties},
+        {"vkGetPhysicalDeviceQueueFamilyProperties", (PFN_vkVoidFunction)GetPhysicalDeviceQueueFamilyProperties},
+        {"vkGetPhysicalDeviceMemoryProperties", (PFN_vkVoidFunction)GetPhysicalDeviceMemoryProperties},
+        {"vkGetInstanceProcAddr", (PFN_vkVoidFunction)GetInstanceProcAddr},
+        {"vkCreateDevice", (PFN_vkVoidFunction)CreateDevice},
+        {"vkEnumerateInstanceExtensionProperties", (PFN_vkVoidFunction)EnumerateInstanceExtensionProperties},
+        {"vkEnumerateInstanceLayerProperties", (PFN_vkVoidFunction)EnumerateInstanceLayerProperties},
+        {"vkEnumerateDeviceLayerProperties", (PFN_vkVoidFunction)EnumerateDeviceLayerProperties},
+        {"vkGetPhysicalDeviceSparseImageFormatProperties", (PFN_vkVoidFunction)GetPhysicalDeviceSparseImageFormatProperties},
+        {"vkGetPhysicalDeviceExternalImageFormatPropertiesNV",
+         (PFN_vkVoidFunction)GetPhysicalDeviceExternalImageFormatPropertiesNV},
+    };
+    static const auto core_instance_table = MakeVkCommandTable(core_instance_commands);
+
+    auto command = core_instance_table.Find(name);
+    return command ? command->proc : NULL;
 }
 
 static inline PFN_vkVoidFunction InterceptInstanceExtensionCommand(const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
-
-    name += 2;
-
-    // VK_KHR_get_physical_device_properties2 Extension
-    if (!strcmp(name, "GetPhysicalDeviceFeatures2KHR")) return (PFN_vkVoidFunction)GetPhysicalDeviceFeatures2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceProperties2KHR")) return (PFN_vkVoidFunction)GetPhysicalDeviceProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceFormatProperties2KHR")) return (PFN_vkVoidFunction)GetPhysicalDeviceFormatProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceImageFormatProperties2KHR"))
-        return (PFN_vkVoidFunction)GetPhysicalDeviceImageFormatProperties2KHR;
-    if (!strcmp(name, "GetPhysicalDeviceQueueFamilyProperties2KHR"))
-        return (PFN_vkVoidFunction)GetPhysicalDeviceQueueFamilyProperties2KHR;
-    // VK_KHX_device_group Extension
-    if (!strcmp(name, "GetPhysicalDevicePresentRectanglesKHX")) return (PFN_vkVoidFunction)GetPhysicalDevicePresentRectanglesKHX;
-    // VK_KHX_device_group_creation Extension
-    if (!strcmp(name, "EnumeratePhysicalDeviceGroupsKHX")) return (PFN_vkVoidFunction)EnumeratePhysicalDeviceGroupsKHX;
-    // VK_KHX_external_memory_capabilities Extension
-    if (!strcmp(name, "GetPhysicalDeviceExternalBufferPropertiesKHX"))
-        return (PFN_vkVoidFunction)GetPhysicalDeviceExternalBufferPropertiesKHX;
-    // VK_KHX_external_semaphore_capabilities Extension
-    if (!strcmp(name, "GetPhysicalDeviceExternalSemaphorePropertiesKHX"))
-        return (PFN_vkVoidFunction)GetPhysicalDeviceExternalSemaphorePropertiesKHX;
+    static const struct {
+        const char *name;
+        PFN_vkVoidFunction proc;
+    } instance_extension_commands[] = {
+        // VK_KHR_get_physical_device_properties2 Extension
+        {"vkGetPhysicalDeviceFeatures2KHR", (PFN_vkVoidFunction)GetPhysicalDeviceFeatures2KHR},
+        {"vkGetPhysicalDeviceProperties2KHR", (PFN_vkVoidFunction)GetPhysicalDeviceProperties2KHR},
+        {"vkGetPhysicalDeviceFormatProperties2KHR", (PFN_vkVoidFunction)GetPhysicalDeviceFormatProperties2KHR},
+        {"vkGetPhysicalDeviceImageFormatProperties2KHR", (PFN_vkVoidFunction)GetPhysicalDeviceImageFormatProperties2KHR},
+        {"vkGetPhysicalDeviceQueueFamilyProperties2KHR", (PFN_vkVoidFunction)GetPhysicalDeviceQueueFamilyProperties2KHR},
+        // VK_KHX_device_group Extension
+        {"vkGetPhysicalDevicePresentRectanglesKHX", (PFN_vkVoidFunction)GetPhysicalDevicePresentRectanglesKHX},
+        // VK_KHX_device_group_creation Extension
+        {"vkEnumeratePhysicalDeviceGroupsKHX", (PFN_vkVoidFunction)EnumeratePhysicalDeviceGroupsKHX},
+        // VK_KHX_external_memory_capabilities Extension
+        {"vkGetPhysicalDeviceExternalBufferPropertiesKHX", (PFN_vkVoidFunction)GetPhysicalDeviceExternalBufferPropertiesKHX},
+        // VK_KHX_external_semaphore_capabilities Extension
+        {"vkGetPhysicalDeviceExternalSemaphorePropertiesKHX", (PFN_vkVoidFunction)GetPhysicalDeviceExternalSemaphorePropertiesKHX},
 #ifdef VK_USE_PLATFORM_XLIB_XRANDR_EXT
-    // VK_EXT_acquire_xlib_display Extension
-    if (!strcmp(name, "AcquireXlibDisplayEXT")) return (PFN_vkVoidFunction)AcquireXlibDisplayEXT;
-    if (!strcmp(name, "GetRandROutputDisplayEXT")) return (PFN_vkVoidFunction)GetRandROutputDisplayEXT;
+        // VK_EXT_acquire_xlib_display Extension
+        {"vkAcquireXlibDisplayEXT", (PFN_vkVoidFunction)AcquireXlibDisplayEXT},
+        {"vkGetRandROutputDisplayEXT", (PFN_vkVoidFunction)GetRandROutputDisplayEXT},
 #endif  // VK_USE_PLATFORM_XLIB_XRANDR_EXT
-    // VK_EXT_direct_mode_display Extension
-    if (!strcmp(name, "ReleaseDisplayEXT")) return (PFN_vkVoidFunction)ReleaseDisplayEXT;
-    // VK_EXT_display_surface_counter Extension
-    if (!strcmp(name, "GetPhysicalDeviceSurfaceCapabilities2EXT"))
-        return (PFN_vkVoidFunction)GetPhysicalDeviceSurfaceCapabilities2EXT;
-    // VK_NV_clip_space_w_scaling Extension
-    if (!strcmp(name, "CmdSetViewportWScalingNV")) return (PFN_vkVoidFunction)CmdSetViewportWScalingNV;
-    // VK_NVX_device_generated_commands Extension
-    if (!strcmp(name, "GetPhysicalDeviceGeneratedCommandsPropertiesNVX"))
-        return (PFN_vkVoidFunction)GetPhysicalDeviceGeneratedCommandsPropertiesNVX;
+        // VK_EXT_direct_mode_display Extension
+        {"vkReleaseDisplayEXT", (PFN_vkVoidFunction)ReleaseDisplayEXT},
+        // VK_EXT_display_surface_counter Extension
+        {"vkGetPhysicalDeviceSurfaceCapabilities2EXT", (PFN_vkVoidFunction)GetPhysicalDeviceSurfaceCapabilities2EXT},
+        // VK_NV_clip_space_w_scaling Extension
+        {"vkCmdSetViewportWScalingNV", (PFN_vkVoidFunction)CmdSetViewportWScalingNV},
+        // VK_NVX_device_generated_commands Extension
+        {"vkGetPhysicalDeviceGeneratedCommandsPropertiesNVX", (PFN_vkVoidFunction)GetPhysicalDeviceGeneratedCommandsPropertiesNVX},
+    };
+    static const auto instance_extension_table = MakeVkCommandTable(instance_extension_commands);
 
-    return NULL;
+    auto command = instance_extension_table.Find(name);
+    return command ? command->proc : NULL;
 }
 
 static inline PFN_vkVoidFunction InterceptDeviceExtensionCommand(const char *name, VkDevice device) {
-    if (device) {
-        layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-
-        if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
-
-        name += 2;
-
-        if (device_data->enables.khr_descriptor_update_template) {
-            if (!strcmp(name, "CreateDescriptorUpdateTemplateKHR")) return (PFN_vkVoidFunction)CreateDescriptorUpdateTemplateKHR;
-            if (!strcmp(name, "DestroyDescriptorUpdateTemplateKHR")) return (PFN_vkVoidFunction)DestroyDescriptorUpdateTemplateKHR;
-            if (!strcmp(name, "UpdateDescriptorSetWithTemplateKHR")) return (PFN_vkVoidFunction)UpdateDescriptorSetWithTemplateKHR;
-            if (!strcmp(name, "CmdPushDescriptorSetWithTemplateKHR"))
-                return (PFN_vkVoidFunction)CmdPushDescriptorSetWithTemplateKHR;
-        }
-        if (device_data->enables.khr_maintenance1) {
-            if (!strcmp(name, "TrimCommandPoolKHR")) return (PFN_vkVoidFunction)TrimCommandPoolKHR;
-        }
-        if (device_data->enables.khr_push_descriptor) {
-            if (!strcmp(name, "CmdPushDescriptorSetKHR")) return (PFN_vkVoidFunction)CmdPushDescriptorSetKHR;
-        }
-        if (device_data->enables.khx_device_group) {
-            // VK_KHX_device_group Extension
-            if (!strcmp(name, "GetDeviceGroupPeerMemoryFeaturesKHX"))
-                return (PFN_vkVoidFunction)GetDeviceGroupPeerMemoryFeaturesKHX;
-            if (!strcmp(name, "BindBufferMemory2KHX")) return (PFN_vkVoidFunction)BindBufferMemory2KHX;
-            if (!strcmp(name, "BindImageMemory2KHX")) return (PFN_vkVoidFunction)BindImageMemory2KHX;
-            if (!strcmp(name, "CmdSetDeviceMaskKHX")) return (PFN_vkVoidFunction)CmdSetDeviceMaskKHX;
-            if (!strcmp(name, "GetDeviceGroupPresentCapabilitiesKHX"))
-                return (PFN_vkVoidFunction)GetDeviceGroupPresentCapabilitiesKHX;
-            if (!strcmp(name, "GetDeviceGroupSurfacePresentModesKHX"))
-                return (PFN_vkVoidFunction)GetDeviceGroupSurfacePresentModesKHX;
-            if (!strcmp(name, "AcquireNextImage2KHX")) return (PFN_vkVoidFunction)AcquireNextImage2KHX;
-            if (!strcmp(name, "CmdDispatchBaseKHX")) return (PFN_vkVoidFunction)CmdDispatchBaseKHX;
-        }
+    using E = device_extension_enables;
+    static const struct {
+        const char *name;
+        PFN_vkVoidFunction proc;
+        bool E::*enable;
+    } device_extension_commands[] = {
+        {"vkCreateDescriptorUpdateTemplateKHR",
+         (PFN_vkVoidFunction)CreateDescriptorUpdateTemplateKHR, &E::khr_descriptor_update_template},
+        {"vkDestroyDescriptorUpdateTemplateKHR",
+         (PFN_vkVoidFunction)DestroyDescriptorUpdateTemplateKHR, &E::khr_descriptor_update_template},
+        {"vkUpdateDescriptorSetWithTemplateKHR",
+         (PFN_vkVoidFunction)UpdateDescriptorSetWithTemplateKHR, &E::khr_descriptor_update_template},
+        {"vkCmdPushDescriptorSetWithTemplateKHR",
+         (PFN_vkVoidFunction)CmdPushDescriptorSetWithTemplateKHR, &E::khr_descriptor_update_template},
+        {"vkTrimCommandPoolKHR", (PFN_vkVoidFunction)TrimCommandPoolKHR, &E::khr_maintenance1},
+        {"vkCmdPushDescriptorSetKHR", (PFN_vkVoidFunction)CmdPushDescriptorSetKHR, &E::khr_push_descriptor},
+        // VK_KHX_device_group Extension
+        {"vkGetDeviceGroupPeerMemoryFeaturesKHX", (PFN_vkVoidFunction)GetDeviceGroupPeerMemoryFeaturesKHX, &E::khx_device_group},
+        {"vkBindBufferMemory2KHX", (PFN_vkVoidFunction)BindBufferMemory2KHX, &E::khx_device_group},
+        {"vkBindImageMemory2KHX", (PFN_vkVoidFunction)BindImageMemory2KHX, &E::khx_device_group},
+        {"vkCmdSetDeviceMaskKHX", (PFN_vkVoidFunction)CmdSetDeviceMaskKHX, &E::khx_device_group},
+        {"vkGetDeviceGroupPresentCapabilitiesKHX", (PFN_vkVoidFunction)GetDeviceGroupPresentCapabilitiesKHX, &E::khx_device_group},
+        {"vkGetDeviceGroupSurfacePresentModesKHX", (PFN_vkVoidFunction)GetDeviceGroupSurfacePresentModesKHX, &E::khx_device_group},
+        {"vkAcquireNextImage2KHX", (PFN_vkVoidFunction)AcquireNextImage2KHX, &E::khx_device_group},
+        {"vkCmdDispatchBaseKHX", (PFN_vkVoidFunction)CmdDispatchBaseKHX, &E::khx_device_group},
 #ifdef VK_USE_PLATFORM_WIN32_KHX
-        if (device_data->enables.khx_external_memory_win32) {
-            if (!strcmp(name, "GetMemoryWin32HandleKHX")) return (PFN_vkVoidFunction)GetMemoryWin32HandleKHX;
-            if (!strcmp(name, "GetMemoryWin32HandlePropertiesKHX")) return (PFN_vkVoidFunction)GetMemoryWin32HandlePropertiesKHX;
-        }
+        {"vkGetMemoryWin32HandleKHX", (PFN_vkVoidFunction)GetMemoryWin32HandleKHX, &E::khx_external_memory_win32},
+        {"vkGetMemoryWin32HandlePropertiesKHX",
+         (PFN_vkVoidFunction)GetMemoryWin32HandlePropertiesKHX, &E::khx_external_memory_win32},
 #endif  // VK_USE_PLATFORM_WIN32_KHX
-        if (device_data->enables.khx_external_memory_fd) {
-            if (!strcmp(name, "GetMemoryFdKHX")) return (PFN_vkVoidFunction)GetMemoryFdKHX;
-            if (!strcmp(name, "GetMemoryFdPropertiesKHX")) return (PFN_vkVoidFunction)GetMemoryFdPropertiesKHX;
-        }
+        {"vkGetMemoryFdKHX", (PFN_vkVoidFunction)GetMemoryFdKHX, &E::khx_external_memory_fd},
+        {"vkGetMemoryFdPropertiesKHX", (PFN_vkVoidFunction)GetMemoryFdPropertiesKHX, &E::khx_external_memory_fd},
 #ifdef VK_USE_PLATFORM_WIN32_KHX
-        if (device_data->enables.khx_external_semaphore_win32) {
-            if (!strcmp(name, "ImportSemaphoreWin32HandleKHX")) return (PFN_vkVoidFunction)ImportSemaphoreWin32HandleKHX;
-            if (!strcmp(name, "GetSemaphoreWin32HandleKHX")) return (PFN_vkVoidFunction)GetSemaphoreWin32HandleKHX;
-        }
+        {"vkImportSemaphoreWin32HandleKHX", (PFN_vkVoidFunction)ImportSemaphoreWin32HandleKHX, &E::khx_external_semaphore_win32},
+        {"vkGetSemaphoreWin32HandleKHX", (PFN_vkVoidFunction)GetSemaphoreWin32HandleKHX, &E::khx_external_semaphore_win32},
 #endif  // VK_USE_PLATFORM_WIN32_KHX
-        if (device_data->enables.khx_external_semaphore_fd) {
-            if (!strcmp(name, "ImportSemaphoreFdKHX")) return (PFN_vkVoidFunction)ImportSemaphoreFdKHX;
-            if (!strcmp(name, "GetSemaphoreFdKHX")) return (PFN_vkVoidFunction)GetSemaphoreFdKHX;
-        }
-        if (device_data->enables.ext_discard_rectangles) {
-            if (!strcmp(name, "CmdSetDiscardRectangleEXT")) return (PFN_vkVoidFunction)CmdSetDiscardRectangleEXT;
-        }
-        if (device_data->enables.ext_display_control) {
-            if (!strcmp(name, "DisplayPowerControlEXT")) return (PFN_vkVoidFunction)DisplayPowerControlEXT;
-            if (!strcmp(name, "RegisterDeviceEventEXT")) return (PFN_vkVoidFunction)RegisterDeviceEventEXT;
-            if (!strcmp(name, "RegisterDisplayEventEXT")) return (PFN_vkVoidFunction)RegisterDisplayEventEXT;
-            if (!strcmp(name, "GetSwapchainCounterEXT")) return (PFN_vkVoidFunction)GetSwapchainCounterEXT;
-        }
-        if (device_data->enables.nvx_device_generated_commands) {
-            if (!strcmp(name, "CmdProcessCommandsNVX")) return (PFN_vkVoidFunction)CmdProcessCommandsNVX;
-            if (!strcmp(name, "CmdReserveSpaceForCommandsNVX")) return (PFN_vkVoidFunction)CmdReserveSpaceForCommandsNVX;
-            if (!strcmp(name, "CreateIndirectCommandsLayoutNVX")) return (PFN_vkVoidFunction)CreateIndirectCommandsLayoutNVX;
-            if (!strcmp(name, "DestroyIndirectCommandsLayoutNVX")) return (PFN_vkVoidFunction)DestroyIndirectCommandsLayoutNVX;
-            if (!strcmp(name, "CreateObjectTableNVX")) return (PFN_vkVoidFunction)CreateObjectTableNVX;
-            if (!strcmp(name, "DestroyObjectTableNVX")) return (PFN_vkVoidFunction)DestroyObjectTableNVX;
-            if (!strcmp(name, "RegisterObjectsNVX")) return (PFN_vkVoidFunction)RegisterObjectsNVX;
-            if (!strcmp(name, "UnregisterObjectsNVX")) return (PFN_vkVoidFunction)UnregisterObjectsNVX;
-        }
-        if (device_data->enables.google_display_timing) {
-            if (!strcmp(name, "GetPastPresentationTimingGOOGLE")) return (PFN_vkVoidFunction)GetPastPresentationTimingGOOGLE;
-            if (!strcmp(name, "GetRefreshCycleDurationGOOGLE")) return (PFN_vkVoidFunction)GetRefreshCycleDurationGOOGLE;
-        }
-    }
+        {"vkImportSemaphoreFdKHX", (PFN_vkVoidFunction)ImportSemaphoreFdKHX, &E::khx_external_semaphore_fd},
+        {"vkGetSemaphoreFdKHX", (PFN_vkVoidFunction)GetSemaphoreFdKHX, &E::khx_external_semaphore_fd},
+        {"vkCmdSetDiscardRectangleEXT", (PFN_vkVoidFunction)CmdSetDiscardRectangleEXT, &E::ext_discard_rectangles},
+        {"vkDisplayPowerControlEXT", (PFN_vkVoidFunction)DisplayPowerControlEXT, &E::ext_display_control},
+        {"vkRegisterDeviceEventEXT", (PFN_vkVoidFunction)RegisterDeviceEventEXT, &E::ext_display_control},
+        {"vkRegisterDisplayEventEXT", (PFN_vkVoidFunction)RegisterDisplayEventEXT, &E::ext_display_control},
+        {"vkGetSwapchainCounterEXT", (PFN_vkVoidFunction)GetSwapchainCounterEXT, &E::ext_display_control},
+        {"vkCmdProcessCommandsNVX", (PFN_vkVoidFunction)CmdProcessCommandsNVX, &E::nvx_device_generated_commands},
+        {"vkCmdReserveSpaceForCommandsNVX", (PFN_vkVoidFunction)CmdReserveSpaceForCommandsNVX, &E::nvx_device_generated_commands},
+        {"vkCreateIndirectCommandsLayoutNVX",
+         (PFN_vkVoidFunction)CreateIndirectCommandsLayoutNVX, &E::nvx_device_generated_commands},
+        {"vkDestroyIndirectCommandsLayoutNVX",
+         (PFN_vkVoidFunction)DestroyIndirectCommandsLayoutNVX, &E::nvx_device_generated_commands},
+        {"vkCreateObjectTableNVX", (PFN_vkVoidFunction)CreateObjectTableNVX, &E::nvx_device_generated_commands},
+        {"vkDestroyObjectTableNVX", (PFN_vkVoidFunction)DestroyObjectTableNVX, &E::nvx_device_generated_commands},
+        {"vkRegisterObjectsNVX", (PFN_vkVoidFunction)RegisterObjectsNVX, &E::nvx_device_generated_commands},
+        {"vkUnregisterObjectsNVX", (PFN_vkVoidFunction)UnregisterObjectsNVX, &E::nvx_device_generated_commands},
+        {"vkGetPastPresentationTimingGOOGLE", (PFN_vkVoidFunction)GetPastPresentationTimingGOOGLE, &E::google_display_timing},
+        {"vkGetRefreshCycleDurationGOOGLE", (PFN_vkVoidFunction)GetRefreshCycleDurationGOOGLE, &E::google_display_timing},
+    };
+    static const auto device_extension_table = MakeVkCommandTable(device_extension_commands);
+
+    auto command = device_extension_table.Find(name);
+    if (!command || !device) return NULL;
 
-    return NULL;
+    layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    return (device_data->enables.*(command->enable)) ? command->proc : NULL;
 }
 
 static inline PFN_vkVoidFunction InterceptWsiEnabledCommand(const char *name, VkDevice device) {
-    if (device) {
-        layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
-
-        if (device_data->enables.wsi) {
-            if (!strcmp("vkCreateSwapchainKHR", name)) return reinterpret_cast<PFN_vkVoidFunction>(CreateSwapchainKHR);
-            if (!strcmp("vkDestroySwapchainKHR", name)) return reinterpret_cast<PFN_vkVoidFunction>(DestroySwapchainKHR);
-            if (!strcmp("vkGetSwapchainImagesKHR", name)) return reinterpret_cast<PFN_vkVoidFunction>(GetSwapchainImagesKHR);
-            if (!strcmp("vkAcquireNextImageKHR", name)) return reinterpret_cast<PFN_vkVoidFunction>(AcquireNextImageKHR);
-            if (!strcmp("vkQueuePresentKHR", name)) return reinterpret_cast<PFN_vkVoidFunction>(QueuePresentKHR);
-        }
-
-        if (device_data->enables.wsi_display_swapchain) {
-            if (!strcmp("vkCreateSharedSwapchainsKHR", name)) {
-                return reinterpret_cast<PFN_vkVoidFunction>(CreateSharedSwapchainsKHR);
-            }
-        }
+    using E = device_extension_enables;
+    static const struct {
+        const char *name;
+        PFN_vkVoidFunction proc;
+        bool E::*enable;
+    } wsi_device_commands[] = {
+        {"vkCreateSwapchainKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateSwapchainKHR), &E::wsi},
+        {"vkDestroySwapchainKHR", reinterpret_cast<PFN_vkVoidFunction>(DestroySwapchainKHR), &E::wsi},
+        {"vkGetSwapchainImagesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetSwapchainImagesKHR), &E::wsi},
+        {"vkAcquireNextImageKHR", reinterpret_cast<PFN_vkVoidFunction>(AcquireNextImageKHR), &E::wsi},
+        {"vkQueuePresentKHR", reinterpret_cast<PFN_vkVoidFunction>(QueuePresentKHR), &E::wsi},
+        {"vkCreateSharedSwapchainsKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateSharedSwapchainsKHR),
+         &E::wsi_display_swapchain},
+        {"vkGetPhysicalDeviceDisplayPropertiesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceDisplayPropertiesKHR),
+         &E::wsi_display_extension},
+        {"vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+         reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceDisplayPlanePropertiesKHR), &E::wsi_display_extension},
+        {"vkGetDisplayPlaneSupportedDisplaysKHR", reinterpret_cast<PFN_vkVoidFunction>(GetDisplayPlaneSupportedDisplaysKHR),
+         &E::wsi_display_extension},
+        {"vkGetDisplayModePropertiesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetDisplayModePropertiesKHR),
+         &E::wsi_display_extension},
+        {"vkCreateDisplayModeKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateDisplayModeKHR), &E::wsi_display_extension},
+        {"vkGetDisplayPlaneCapabilitiesKHR", reinterpret_cast<PFN_vkVoidFunction>(GetDisplayPlaneCapabilitiesKHR),
+         &E::wsi_display_extension},
+        {"vkCreateDisplayPlaneSurfaceKHR", reinterpret_cast<PFN_vkVoidFunction>(CreateDisplayPlaneSurfaceKHR),
+         &E::wsi_display_extension},
+    };
+    static const auto wsi_device_table = MakeVkCommandTable(wsi_device_commands);
+
+    auto command = wsi_device_table.Find(name);
+    if (!command || !device) return nullptr;
 
-        if (device_data->enables.wsi_display_extension) {
-            if (!strcmp("vkGetPhysicalDeviceDisplayPropertiesKHR", name))
-                return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceDisplayPropertiesKHR);
-            if (!strcmp("vkGetPhysicalDeviceDisplayPlanePropertiesKHR", name))
-                return reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceDisplayPlanePropertiesKHR);
-            if (!strcmp("vkGetDisplayPlaneSupportedDisplaysKHR", name))
-                return reinterpret_cast<PFN_vkVoidFunction>(GetDisplayPlaneSupportedDisplaysKHR);
-            if (!strcmp("vkGetDisplayModePropertiesKHR", name))
-                return reinterpret_cast<PFN_vkVoidFunction>(GetDisplayModePropertiesKHR);
-            if (!strcmp("vkCreateDisplayModeKHR", name)) return reinterpret_cast<PFN_vkVoidFunction>(CreateDisplayModeKHR);
-            if (!strcmp("vkGetDisplayPlaneCapabilitiesKHR", name))
-                return reinterpret_cast<PFN_vkVoidFunction>(GetDisplayPlaneCapabilitiesKHR);
-            if (!strcmp("vkCreateDisplayPlaneSurfaceKHR", name))
-                return reinterpret_cast<PFN_vkVoidFunction>(CreateDisplayPlaneSurfaceKHR);
-        }
-    }
-
-    return nullptr;
+    layer_data *device_data = GetLayerDataPtr(get_dispatch_key(device), layer_data_map);
+    return (device_data->enables.*(command->enable)) ? command->proc : nullptr;
 }
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *funcName) {
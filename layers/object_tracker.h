@@ -155,7 +155,7 @@ struct layer_data {
 };
 
 static std::unordered_map<void *, struct instance_extension_enables> instanceExtMap;
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataRegistry<layer_data> layer_data_map;
 static device_table_map ot_device_table_map;
 static instance_table_map ot_instance_table_map;
 static std::mutex global_lock;
@@ -19,9 +19,10 @@
 #define PARAMETER_NAME_H
 
 #include <cassert>
+#include <cstddef>
+#include <cstring>
 #include <sstream>
 #include <string>
-#include <vector>
 
 /**
  * Parameter name string supporting deferred formatting for array subscripts.
@@ -40,15 +41,49 @@
  * provided to the validation function.  String formatting is then performed only when the validation function retrieves the
  * name string from the ParameterName object:
  *         validate_stype(ParameterName("pCreateInfo[%i].sType", IndexVector{ i }), pCreateInfo[i].sType);
+ *
+ * The format string is referenced, not copied, and the index values are stored inline, so constructing a ParameterName never
+ * allocates memory.  The format string must therefore be a string literal, or otherwise outlive the ParameterName object.
  */
 class ParameterName {
    public:
-    /// Container for index values to be used with parameter name string formatting.
-    typedef std::vector<size_t> IndexVector;
+    /// Maximum number of index values that may be used with a single parameter name string.
+    static const size_t MaxIndexCount = 4;
+
+    /// Fixed capacity container for index values to be used with parameter name string formatting.
+    class IndexVector {
+       public:
+        IndexVector() : size_(0) {}
+
+        // One constructor per index count up to MaxIndexCount, so that a name with more indices fails to compile
+        // instead of being truncated.
+        IndexVector(size_t v0) : size_(1) { values_[0] = v0; }
+        IndexVector(size_t v0, size_t v1) : size_(2) {
+            values_[0] = v0;
+            values_[1] = v1;
+        }
+        IndexVector(size_t v0, size_t v1, size_t v2) : size_(3) {
+            values_[0] = v0;
+            values_[1] = v1;
+            values_[2] = v2;
+        }
+        IndexVector(size_t v0, size_t v1, size_t v2, size_t v3) : size_(4) {
+            values_[0] = v0;
+            values_[1] = v1;
+            values_[2] = v2;
+            values_[3] = v3;
+        }
+        static_assert(MaxIndexCount == 4, "IndexVector needs one constructor per index count");
 
-    /// Format specifier for the parameter name string, to be replaced by an index value.  The parameter name string must contain
-    /// one format specifier for each index value specified.
-    const std::string IndexFormatSpecifier = "%i";
+        bool empty() const { return size_ == 0; }
+        size_t size() const { return size_; }
+        const size_t *begin() const { return values_; }
+        const size_t *end() const { return values_ + size_; }
+
+       private:
+        size_t values_[MaxIndexCount];
+        size_t size_;
+    };
 
    public:
     /**
@@ -61,36 +96,7 @@ class ParameterName {
     ParameterName(const char *source) : source_(source) { assert(IsValid()); }
 
     /**
-    * Construct a ParameterName object from a std::string object, without formatting.
-    *
-    * @param source Paramater name string without format specifiers.
-    *
-    * @pre The source string must not contain the %i format specifier.
-    */
-    ParameterName(const std::string &source) : source_(source) { assert(IsValid()); }
-
-    /**
-    * Construct a ParameterName object from a std::string object, without formatting.
-    *
-    * @param source Paramater name string without format specifiers.
-    *
-    * @pre The source string must not contain the %i format specifier.
-    */
-    ParameterName(const std::string &&source) : source_(std::move(source)) { assert(IsValid()); }
-
-    /**
-    * Construct a ParameterName object from a std::string object, with formatting.
-    *
-    * @param source Paramater name string with format specifiers.
-    * @param args Array index values to be used for formatting.
-    *
-    * @pre The number of %i format specifiers contained by the source string must match the number of elements contained
-    *      by the index vector.
-    */
-    ParameterName(const std::string &source, const IndexVector &args) : source_(source), args_(args) { assert(IsValid()); }
-
-    /**
-    * Construct a ParameterName object from a std::string object, with formatting.
+    * Construct a ParameterName object from a string literal, with formatting.
     *
     * @param source Paramater name string with format specifiers.
     * @param args Array index values to be used for formatting.
@@ -98,50 +104,57 @@ class ParameterName {
     * @pre The number of %i format specifiers contained by the source string must match the number of elements contained
     *      by the index vector.
     */
-    ParameterName(const std::string &&source, const IndexVector &&args) : source_(std::move(source)), args_(std::move(args)) {
-        assert(IsValid());
-    }
+    ParameterName(const char *source, const IndexVector &args) : source_(source), args_(args) { assert(IsValid()); }
 
     /// Retrive the formatted name string.
-    std::string get_name() const { return (args_.empty()) ? source_ : Format(); }
+    std::string get_name() const { return (args_.empty()) ? std::string(source_) : Format(); }
 
    private:
+    /// Format specifier for the parameter name string, to be replaced by an index value.  The parameter name string must contain
+    /// one format specifier for each index value specified.
+    static const char *IndexFormatSpecifier() { return "%i"; }
+
     /// Replace the %i format specifiers in the source string with the values from the index vector.
     std::string Format() const {
-        std::string::size_type current = 0;
-        std::string::size_type last = 0;
+        const size_t specifier_length = strlen(IndexFormatSpecifier());
+        const char *last = source_;
         std::stringstream format;
 
         for (size_t index : args_) {
-            current = source_.find(IndexFormatSpecifier, last);
-            if (current == std::string::npos) {
+            const char *current = strstr(last, IndexFormatSpecifier());
+            if (current == nullptr) {
                 break;
             }
-            format << source_.substr(last, (current - last)) << index;
-            last = current + IndexFormatSpecifier.length();
+            format.write(last, current - last);
+            format << index;
+            last = current + specifier_length;
         }
 
-        format << source_.substr(last, std::string::npos);
+        format << last;
 
         return format.str();
     }
 
     /// Check that the number of %i format specifiers in the source string matches the number of elements in the index vector.
-    bool IsValid() {
+    bool IsValid() const {
+        if (source_ == nullptr) {
+            return false;
+        }
+
         // Count the number of occurances of the format specifier
-        uint32_t count = 0;
-        std::string::size_type pos = source_.find(IndexFormatSpecifier);
+        size_t count = 0;
+        const char *pos = strstr(source_, IndexFormatSpecifier());
 
-        while (pos != std::string::npos) {
+        while (pos != nullptr) {
             ++count;
-            pos = source_.find(IndexFormatSpecifier, pos + 1);
+            pos = strstr(pos + 1, IndexFormatSpecifier());
         }
 
         return (count == args_.size());
     }
 
    private:
-    std::string source_;  ///< Format string.
+    const char *source_;  ///< Format string.
     IndexVector args_;    ///< Array index values for formatting.
 };
 
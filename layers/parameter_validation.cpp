@@ -51,6 +51,7 @@
 #include "parameter_name.h"
 #include "parameter_validation.h"
 #include "device_extensions.h"
+#include "vk_command_ids.h"
 
 namespace parameter_validation {
 
@@ -83,8 +84,8 @@ struct layer_data {
 };
 
 static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
-static std::unordered_map<void *, layer_data *> layer_data_map;
-static std::unordered_map<void *, instance_layer_data *> instance_layer_data_map;
+static LayerDataRegistry<layer_data> layer_data_map;
+static LayerDataRegistry<instance_layer_data> instance_layer_data_map;
 
 static void init_parameter_validation(instance_layer_data *my_data, const VkAllocationCallbacks *pAllocator) {
     layer_debug_actions(my_data->report_data, my_data->logging_callback, pAllocator, "lunarg_parameter_validation");
@@ -3893,11 +3894,10 @@ static bool PreCreateRenderPass(layer_data *dev_data, const VkRenderPassCreateIn
 
     for (uint32_t i = 0; i < pCreateInfo->attachmentCount; ++i) {
         if (pCreateInfo->pAttachments[i].format == VK_FORMAT_UNDEFINED) {
-            std::stringstream ss;
-            ss << "vkCreateRenderPass: pCreateInfo->pAttachments[" << i << "].format is VK_FORMAT_UNDEFINED. "
-               << validation_error_map[VALIDATION_ERROR_00336];
             skip |= log_msg(dev_data->report_data, VK_DEBUG_REPORT_WARNING_BIT_EXT, VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT, 0,
-                            __LINE__, VALIDATION_ERROR_00336, "IMAGE", "%s", ss.str().c_str());
+                            __LINE__, VALIDATION_ERROR_00336, "IMAGE",
+                            "vkCreateRenderPass: pCreateInfo->pAttachments[%u].format is VK_FORMAT_UNDEFINED. %s", i,
+                            validation_error_map[VALIDATION_ERROR_00336]);
         }
     }
 
@@ -6942,9 +6942,9 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(VkDevice device, uint32_t swapchain
 }
 
 static inline PFN_vkVoidFunction layer_intercept_proc(const char *name) {
-    for (unsigned int i = 0; i < sizeof(procmap) / sizeof(procmap[0]); i++) {
-        if (!strcmp(name, procmap[i].name)) return procmap[i].pFunc;
-    }
+    static const auto procmap_table = MakeVkCommandTable(procmap);
+    auto entry = procmap_table.Find(name);
+    if (entry) return entry->pFunc;
     return NULL;
 }
 
@@ -471,8 +471,6 @@ static bool validate_struct_pnext(debug_report_data *report_data, const char *ap
                                   const char *allowed_struct_names, const void *next, size_t allowed_type_count,
                                   const VkStructureType *allowed_types, uint32_t header_version) {
     bool skip_call = false;
-    std::unordered_set<const void *> cycle_check;
-    std::unordered_set<VkStructureType, std::hash<int>> unique_stype_check;
 
     const char disclaimer[] =
         "This warning is based on the Valid Usage documentation for version %d of the Vulkan header.  It "
@@ -490,6 +488,8 @@ static bool validate_struct_pnext(debug_report_data *report_data, const char *ap
                                  INVALID_STRUCT_PNEXT, LayerName, message.c_str(), api_name, parameter_name.get_name().c_str(),
                                  header_version, parameter_name.get_name().c_str());
         } else {
+            std::unordered_set<const void *> cycle_check;
+            std::unordered_set<VkStructureType, std::hash<int>> unique_stype_check;
             const VkStructureType *start = allowed_types;
             const VkStructureType *end = allowed_types + allowed_type_count;
             const GenericHeader *current = reinterpret_cast<const GenericHeader *>(next);
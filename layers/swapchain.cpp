@@ -26,6 +26,7 @@
 #include "vk_enum_string_helper.h"
 #include "vk_layer_extension_utils.h"
 #include "vk_layer_utils.h"
+#include "vk_command_ids.h"
 #include "vk_validation_error_messages.h"
 #include <mutex>
 #include <stdio.h>
@@ -37,7 +38,7 @@ namespace swapchain {
 static std::mutex global_lock;
 
 // The following is for logging error messages:
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataRegistry<layer_data> layer_data_map;
 
 static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
 
@@ -1342,11 +1343,10 @@ static PFN_vkVoidFunction intercept_core_instance_command(const char *name) {
         {"vkGetPhysicalDeviceQueueFamilyProperties", reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceQueueFamilyProperties)},
     };
 
-    for (size_t i = 0; i < ARRAY_SIZE(core_instance_commands); i++) {
-        if (!strcmp(core_instance_commands[i].name, name)) return core_instance_commands[i].proc;
-    }
+    static const auto core_instance_table = MakeVkCommandTable(core_instance_commands);
 
-    return nullptr;
+    auto command = core_instance_table.Find(name);
+    return command ? command->proc : nullptr;
 }
 
 static PFN_vkVoidFunction intercept_khr_surface_command(const char *name, VkInstance instance) {
@@ -1393,11 +1393,10 @@ static PFN_vkVoidFunction intercept_khr_surface_command(const char *name, VkInst
 
     // do not check if VK_KHR_*_surface is enabled (why?)
 
-    for (size_t i = 0; i < ARRAY_SIZE(khr_surface_commands); i++) {
-        if (!strcmp(khr_surface_commands[i].name, name)) return khr_surface_commands[i].proc;
-    }
+    static const auto khr_surface_table = MakeVkCommandTable(khr_surface_commands);
 
-    return nullptr;
+    auto command = khr_surface_table.Find(name);
+    return command ? command->proc : nullptr;
 }
 
 static PFN_vkVoidFunction intercept_extension_instance_commands(const char *name) {
@@ -1409,12 +1408,10 @@ static PFN_vkVoidFunction intercept_extension_instance_commands(const char *name
          reinterpret_cast<PFN_vkVoidFunction>(GetPhysicalDeviceQueueFamilyProperties2KHR)},
     };
 
-    for (size_t i = 0; i < ARRAY_SIZE(instance_extension_commands); i++) {
-        if (!strcmp(instance_extension_commands[i].name, name)) {
-            return instance_extension_commands[i].proc;
-        }
-    }
-    return nullptr;
+    static const auto instance_extension_table = MakeVkCommandTable(instance_extension_commands);
+
+    auto command = instance_extension_table.Find(name);
+    return command ? command->proc : nullptr;
 }
 
 static PFN_vkVoidFunction intercept_core_device_command(const char *name) {
@@ -1427,11 +1424,10 @@ static PFN_vkVoidFunction intercept_core_device_command(const char *name) {
         {"vkGetDeviceQueue", reinterpret_cast<PFN_vkVoidFunction>(GetDeviceQueue)},
     };
 
-    for (size_t i = 0; i < ARRAY_SIZE(core_device_commands); i++) {
-        if (!strcmp(core_device_commands[i].name, name)) return core_device_commands[i].proc;
-    }
+    static const auto core_device_table = MakeVkCommandTable(core_device_commands);
 
-    return nullptr;
+    auto command = core_device_table.Find(name);
+    return command ? command->proc : nullptr;
 }
 
 static PFN_vkVoidFunction intercept_khr_swapchain_command(const char *name, VkDevice dev) {
@@ -1446,11 +1442,10 @@ static PFN_vkVoidFunction intercept_khr_swapchain_command(const char *name, VkDe
 
     // do not check if VK_KHR_swapchain is enabled (why?)
 
-    for (size_t i = 0; i < ARRAY_SIZE(khr_swapchain_commands); i++) {
-        if (!strcmp(khr_swapchain_commands[i].name, name)) return khr_swapchain_commands[i].proc;
-    }
+    static const auto khr_swapchain_table = MakeVkCommandTable(khr_swapchain_commands);
 
-    return nullptr;
+    auto command = khr_swapchain_table.Find(name);
+    return command ? command->proc : nullptr;
 }
 
 }  // namespace swapchain
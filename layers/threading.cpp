@@ -36,6 +36,7 @@
 #include "vk_layer_utils.h"
 
 #include "thread_check.h"
+#include "vk_command_ids.h"
 
 namespace threading {
 
@@ -202,9 +203,9 @@ static const VkLayerProperties layerProps = {
 };
 
 static inline PFN_vkVoidFunction layer_intercept_proc(const char *name) {
-    for (unsigned int i = 0; i < sizeof(procmap) / sizeof(procmap[0]); i++) {
-        if (!strcmp(name, procmap[i].name)) return procmap[i].pFunc;
-    }
+    static const auto procmap_table = MakeVkCommandTable(procmap);
+    auto entry = procmap_table.Find(name);
+    if (entry) return entry->pFunc;
     return NULL;
 }
 
@@ -242,20 +243,24 @@ VKAPI_ATTR VkResult VKAPI_CALL EnumerateDeviceExtensionProperties(VkPhysicalDevi
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char *funcName);
 
 static inline PFN_vkVoidFunction layer_intercept_instance_proc(const char *name) {
-    if (!name || name[0] != 'v' || name[1] != 'k') return NULL;
-
-    name += 2;
-    if (!strcmp(name, "CreateInstance")) return (PFN_vkVoidFunction)CreateInstance;
-    if (!strcmp(name, "DestroyInstance")) return (PFN_vkVoidFunction)DestroyInstance;
-    if (!strcmp(name, "EnumerateInstanceLayerProperties")) return (PFN_vkVoidFunction)EnumerateInstanceLayerProperties;
-    if (!strcmp(name, "EnumerateInstanceExtensionProperties")) return (PFN_vkVoidFunction)EnumerateInstanceExtensionProperties;
-    if (!strcmp(name, "EnumerateDeviceLayerProperties")) return (PFN_vkVoidFunction)EnumerateDeviceLayerProperties;
-    if (!strcmp(name, "EnumerateDeviceExtensionProperties")) return (PFN_vkVoidFunction)EnumerateDeviceExtensionProperties;
-    if (!strcmp(name, "CreateDevice")) return (PFN_vkVoidFunction)CreateDevice;
-    if (!strcmp(name, "GetInstanceProcAddr")) return (PFN_vkVoidFunction)GetInstanceProcAddr;
-    if (!strcmp(name, "GetPhysicalDeviceProcAddr")) return (PFN_vkVoidFunction)GetPhysicalDeviceProcAddr;
-
-    return NULL;
+    static const struct {
+        const char *name;
+        PFN_vkVoidFunction pFunc;
+    } instance_procmap[] = {
+        {"vkCreateInstance", (PFN_vkVoidFunction)CreateInstance},
+        {"vkDestroyInstance", (PFN_vkVoidFunction)DestroyInstance},
+        {"vkEnumerateInstanceLayerProperties", (PFN_vkVoidFunction)EnumerateInstanceLayerProperties},
+        {"vkEnumerateInstanceExtensionProperties", (PFN_vkVoidFunction)EnumerateInstanceExtensionProperties},
+        {"vkEnumerateDeviceLayerProperties", (PFN_vkVoidFunction)EnumerateDeviceLayerProperties},
+        {"vkEnumerateDeviceExtensionProperties", (PFN_vkVoidFunction)EnumerateDeviceExtensionProperties},
+        {"vkCreateDevice", (PFN_vkVoidFunction)CreateDevice},
+        {"vkGetInstanceProcAddr", (PFN_vkVoidFunction)GetInstanceProcAddr},
+        {"vk_layerGetPhysicalDeviceProcAddr", (PFN_vkVoidFunction)GetPhysicalDeviceProcAddr},
+    };
+    static const auto instance_procmap_table = MakeVkCommandTable(instance_procmap);
+
+    auto entry = instance_procmap_table.Find(name);
+    return entry ? entry->pFunc : NULL;
 }
 
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetDeviceProcAddr(VkDevice device, const char *funcName) {
@@ -360,7 +360,7 @@ WRAPPER(VkDescriptorUpdateTemplateKHR)
 WRAPPER(uint64_t)
 #endif  // DISTINCT_NONDISPATCHABLE_HANDLES
 
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataRegistry<layer_data> layer_data_map;
 static std::mutex command_pool_lock;
 static std::unordered_map<VkCommandBuffer, VkCommandPool> command_pool_map;
 
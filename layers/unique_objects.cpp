@@ -52,6 +52,7 @@
 #include "vk_safe_struct.cpp"
 
 #include "unique_objects_wrappers.h"
+#include "vk_command_ids.h"
 
 namespace unique_objects {
 
@@ -229,9 +230,9 @@ static const VkLayerProperties globalLayerProps = {"VK_LAYER_GOOGLE_unique_objec
 VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL GetPhysicalDeviceProcAddr(VkInstance instance, const char *funcName);
 
 static inline PFN_vkVoidFunction layer_intercept_proc(const char *name) {
-    for (unsigned int i = 0; i < sizeof(procmap) / sizeof(procmap[0]); i++) {
-        if (!strcmp(name, procmap[i].name)) return procmap[i].pFunc;
-    }
+    static const auto procmap_table = MakeVkCommandTable(procmap);
+    auto entry = procmap_table.Find(name);
+    if (entry) return entry->pFunc;
     if (0 == strcmp(name, "vk_layerGetPhysicalDeviceProcAddr")) {
         return (PFN_vkVoidFunction)GetPhysicalDeviceProcAddr;
     }
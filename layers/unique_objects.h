@@ -75,8 +75,8 @@ struct layer_data {
     layer_data() : wsi_enabled(false), gpu(VK_NULL_HANDLE){};
 };
 
-static std::unordered_map<void *, instance_layer_data *> instance_layer_data_map;
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataRegistry<instance_layer_data> instance_layer_data_map;
+static LayerDataRegistry<layer_data> layer_data_map;
 
 static std::mutex global_lock;  // Protect map accesses and unique_id increments
 
@@ -0,0 +1,295 @@
+/* Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// API capture stream.
+//
+// VK_LAYER_LUNARG_api_capture writes every call the application makes, with its parameters, to a file that vk_api_replay
+// plays back through any layer stack. The per-command encoding is generated by api_capture_generator.py from vk.xml;
+// this header holds the file layout and the primitives both sides are built from.
+//
+// File layout: an ApiCaptureFileHeader, followed by one record per call, in the order the calls returned. Each record is
+// an ApiCaptureRecordHeader followed by size bytes of parameters, in declaration order:
+//   - scalars, enums, flags, and structs without pointers, handles or size_t are written as their bytes; size_t as 64 bits
+//   - handles are written as the 64-bit value the application saw; the replayer maps them to the objects it created
+//   - pointers are written as an element count, or kApiCaptureNull, followed by the elements
+//   - strings are written as a length, or kApiCaptureNull, followed by the characters without the terminator
+//   - pNext chains are written as the structures the replayer knows, each starting with its sType, and end with
+//     kApiCaptureEndOfChain; structures it does not know are left out
+//   - memory the implementation writes is not recorded, only its size, so the replayer can provide as much
+// A command that returns a VkResult has it written after the parameters, followed by the handles the call created.
+// Callbacks, window system objects and the contents of mapped memory are not captured.
+// All values are written in the byte order of the machine that made the capture.
+
+#ifndef VK_API_CAPTURE_H
+#define VK_API_CAPTURE_H
+
+#include "vulkan/vulkan.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <memory>
+#include <vector>
+
+static const char kApiCaptureMagic[4] = {'V', 'K', 'A', 'C'};
+static const uint32_t kApiCaptureVersion = 1;
+
+// Element count recorded for a null pointer
+static const uint32_t kApiCaptureNull = 0xFFFFFFFF;
+// sType that ends a pNext chain
+static const VkStructureType kApiCaptureEndOfChain = VK_STRUCTURE_TYPE_MAX_ENUM;
+
+struct ApiCaptureFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t header_version;  // VK_HEADER_VERSION of the capture layer
+    uint32_t command_count;   // kVkCommandIdCount of the capture layer; record command ids are VkCommandIds
+};
+
+struct ApiCaptureRecordHeader {
+    uint32_t command_id;
+    uint32_t size;
+};
+
+// The members every structure with an sType starts with
+struct ApiCaptureStructHeader {
+    VkStructureType sType;
+    const void *pNext;
+};
+
+template <typename T>
+static inline uint64_t ApiCaptureHandleValue(T *handle) {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(handle));
+}
+
+static inline uint64_t ApiCaptureHandleValue(uint64_t handle) { return handle; }
+
+template <typename T>
+static inline T ApiCaptureHandleFromValue(uint64_t value) {
+    return reinterpret_cast<T>(static_cast<uintptr_t>(value));
+}
+
+template <>
+inline uint64_t ApiCaptureHandleFromValue<uint64_t>(uint64_t value) {
+    return value;
+}
+
+// Builds one record. The header is filled in by End(), once the size is known.
+class ApiCaptureEncoder {
+   public:
+    void Begin(uint32_t command_id) {
+        command_id_ = command_id;
+        data_.resize(sizeof(ApiCaptureRecordHeader));
+    }
+
+    void End() {
+        ApiCaptureRecordHeader header;
+        header.command_id = command_id_;
+        header.size = static_cast<uint32_t>(data_.size() - sizeof(header));
+        memcpy(data_.data(), &header, sizeof(header));
+    }
+
+    uint32_t command_id() const { return command_id_; }
+    const uint8_t *data() const { return data_.data(); }
+    size_t size() const { return data_.size(); }
+
+    void Bytes(const void *data, size_t size) {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        data_.insert(data_.end(), bytes, bytes + size);
+    }
+
+    template <typename T>
+    void Value(const T &value) {
+        Bytes(&value, sizeof(T));
+    }
+
+    void Size(size_t value) { Value(static_cast<uint64_t>(value)); }
+
+    template <typename T>
+    void Handle(T handle) {
+        Value(ApiCaptureHandleValue(handle));
+    }
+
+    // Writes the element count of a pointer, or kApiCaptureNull for a null one. Returns whether elements follow.
+    bool Pointer(const void *pointer, uint64_t count) {
+        uint32_t value = pointer ? static_cast<uint32_t>(count) : kApiCaptureNull;
+        Value(value);
+        return pointer && value;
+    }
+
+    template <typename T>
+    void Array(const T *values, uint64_t count) {
+        if (Pointer(values, count)) Bytes(values, sizeof(T) * static_cast<size_t>(count));
+    }
+
+    void Blob(const void *data, uint64_t size) {
+        if (Pointer(data, size)) Bytes(data, static_cast<size_t>(size));
+    }
+
+    template <typename T>
+    void Handles(const T *handles, uint64_t count) {
+        if (!Pointer(handles, count)) return;
+        for (uint64_t i = 0; i < count; i++) Handle(handles[i]);
+    }
+
+    void String(const char *str) {
+        uint32_t length = str ? static_cast<uint32_t>(strlen(str)) : kApiCaptureNull;
+        Value(length);
+        if (str) Bytes(str, length);
+    }
+
+    void Strings(const char *const *strings, uint64_t count) {
+        if (!Pointer(strings, count)) return;
+        for (uint64_t i = 0; i < count; i++) String(strings[i]);
+    }
+
+   private:
+    uint32_t command_id_ = 0;
+    std::vector<uint8_t> data_;
+};
+
+// Zeroed storage for the values decoded from one record, released all at once before the next
+class ApiCaptureArena {
+   public:
+    static const size_t kBlockSize = 64 * 1024;
+
+    void *Allocate(size_t size) {
+        size = (size + 15) & ~static_cast<size_t>(15);
+        if (blocks_.empty() || used_ + size > block_size_) {
+            block_size_ = size > kBlockSize ? size : kBlockSize;
+            blocks_.emplace_back(new uint8_t[block_size_]);
+            used_ = 0;
+        }
+        void *result = blocks_.back().get() + used_;
+        used_ += size;
+        memset(result, 0, size);
+        return result;
+    }
+
+    // Keeps the most recent block, which is the largest after a record that needed more than one
+    void Reset() {
+        if (blocks_.size() > 1) blocks_.erase(blocks_.begin(), blocks_.end() - 1);
+        used_ = 0;
+    }
+
+   private:
+    std::vector<std::unique_ptr<uint8_t[]>> blocks_;
+    size_t block_size_ = 0;
+    size_t used_ = 0;
+};
+
+// Reads one record. Reads past its end return zeros and set Failed(), so a truncated or mismatched record is skipped
+// rather than replayed with garbage.
+class ApiCaptureDecoder {
+   public:
+    ApiCaptureDecoder(const uint8_t *data, size_t size, ApiCaptureArena *arena)
+        : next_(data), end_(data + size), arena_(arena) {}
+
+    bool Failed() const { return failed_; }
+
+    void Bytes(void *data, size_t size) {
+        if (size > Remaining()) {
+            Fail();
+            memset(data, 0, size);
+            return;
+        }
+        memcpy(data, next_, size);
+        next_ += size;
+    }
+
+    template <typename T>
+    T Value() {
+        T value;
+        Bytes(&value, sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    T Peek() {
+        T value = {};
+        if (sizeof(T) <= Remaining()) memcpy(&value, next_, sizeof(T));
+        return value;
+    }
+
+    uint64_t Size() { return Value<uint64_t>(); }
+    uint64_t Handle() { return Value<uint64_t>(); }
+    uint32_t Count() { return Value<uint32_t>(); }
+
+    // Consumes the end of a pNext chain
+    void EndOfChain() {
+        if (Value<VkStructureType>() != kApiCaptureEndOfChain) Fail();
+    }
+
+    // Storage for count elements that are decoded from the record, or nullptr for kApiCaptureNull. Each element takes
+    // at least a byte of the record, which bounds count.
+    template <typename T>
+    T *Array(uint32_t count) {
+        if (count == kApiCaptureNull) return nullptr;
+        if (count > Remaining()) {
+            Fail();
+            return nullptr;
+        }
+        return static_cast<T *>(arena_->Allocate(sizeof(T) * count));
+    }
+
+    // Storage for count elements the implementation writes, or nullptr for kApiCaptureNull
+    template <typename T>
+    T *Scratch(uint32_t count) {
+        if (count == kApiCaptureNull) return nullptr;
+        return static_cast<T *>(arena_->Allocate(sizeof(T) * count));
+    }
+
+    template <typename T>
+    const T *Values() {
+        uint32_t count = Count();
+        T *values = Array<T>(count);
+        if (values) Bytes(values, sizeof(T) * count);
+        return values;
+    }
+
+    const void *Blob() { return Values<uint8_t>(); }
+
+    const char *String() {
+        uint32_t length = Count();
+        if (length == kApiCaptureNull) return nullptr;
+        char *str = Array<char>(length + 1);
+        if (str) Bytes(str, length);
+        return str;
+    }
+
+    const char *const *Strings() {
+        uint32_t count = Count();
+        const char **strings = Array<const char *>(count);
+        for (uint32_t i = 0; strings && i < count; i++) strings[i] = String();
+        return strings;
+    }
+
+   private:
+    size_t Remaining() const { return static_cast<size_t>(end_ - next_); }
+
+    void Fail() {
+        failed_ = true;
+        next_ = end_;
+    }
+
+    const uint8_t *next_;
+    const uint8_t *end_;
+    ApiCaptureArena *arena_;
+    bool failed_ = false;
+};
+
+#endif  // VK_API_CAPTURE_H
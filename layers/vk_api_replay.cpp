@@ -0,0 +1,466 @@
+/* Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Plays back the files written by VK_LAYER_LUNARG_api_capture (see vk_api_capture.h), one call at a time and in the
+// captured order, so the same workload can be run through different layer stacks and timed.
+//
+//   vk_api_replay [options] <capture>
+//     --layers <a,b,...>         Instance layers to replay through, instead of the ones the application enabled
+//     --frame-delimiter <name>   Command that ends a frame, vkQueuePresentKHR by default
+//     --frame-times <file>       Writes the time of each frame, in milliseconds, to a CSV file
+//
+// Messages from the layers are printed as they are reported, and counted in the summary.
+
+#include "vulkan/vulkan.h"
+#include "vk_api_capture.h"
+#include "vk_command_ids.h"
+#include "vk_dispatch_table_helper.h"
+#include "vk_enum_string_helper.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static const char kCaptureLayerName[] = "VK_LAYER_LUNARG_api_capture";
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL CountMessage(VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType,
+                                                   uint64_t object, size_t location, int32_t messageCode,
+                                                   const char *pLayerPrefix, const char *pMessage, void *pUserData);
+
+// Maps the captured handles to the ones created by the replay, and keeps the dispatch tables the calls go through
+class ApiReplayer {
+   public:
+    explicit ApiReplayer(const std::vector<std::string> *layers) : layers_(layers) {}
+
+    template <typename T>
+    T Map(uint64_t captured) {
+        if (captured == 0) return ApiCaptureHandleFromValue<T>(0);
+        auto it = handles_.find(captured);
+        if (it == handles_.end()) {
+            unmapped_handles_++;
+            return ApiCaptureHandleFromValue<T>(0);
+        }
+        return ApiCaptureHandleFromValue<T>(it->second);
+    }
+
+    // Decodes an array of captured handles into the replayed ones
+    template <typename T>
+    const T *Handles(ApiCaptureDecoder *decoder) {
+        uint32_t count = decoder->Count();
+        T *handles = decoder->Array<T>(count);
+        for (uint32_t i = 0; handles && i < count; i++) handles[i] = Map<T>(decoder->Handle());
+        return handles;
+    }
+
+    // Reads the handles a call created in the capture, and maps them to the ones it created in the replay
+    template <typename T>
+    void MapHandles(ApiCaptureDecoder *decoder, const T *replayed, uint32_t capacity) {
+        uint32_t count = decoder->Count();
+        if (count == kApiCaptureNull) return;
+        for (uint32_t i = 0; i < count && !decoder->Failed(); i++) {
+            uint64_t captured = decoder->Handle();
+            if (replayed && i < capacity && captured) handles_[captured] = ApiCaptureHandleValue(replayed[i]);
+        }
+    }
+
+    // Instance and device level objects are dispatched through the table of the instance or device they belong to
+    template <typename T>
+    const VkLayerInstanceDispatchTable *InstanceTable(T handle) {
+        if (!handle) return nullptr;
+        auto it = instance_tables_.find(*reinterpret_cast<void **>(handle));
+        return it == instance_tables_.end() ? nullptr : it->second.get();
+    }
+
+    template <typename T>
+    const VkLayerDispatchTable *DeviceTable(T handle) {
+        if (!handle) return nullptr;
+        auto it = device_tables_.find(*reinterpret_cast<void **>(handle));
+        return it == device_tables_.end() ? nullptr : it->second.get();
+    }
+
+    void CheckResult(VkCommandId command_id, VkResult captured, VkResult replayed) {
+        if (captured == replayed) return;
+        if (result_mismatches_++ < kMaxReportedMismatches) {
+            fprintf(stderr, "%s returned %s, but %s when captured\n", vk_command_names[command_id], string_VkResult(replayed),
+                    string_VkResult(captured));
+        }
+    }
+
+    VkResult CreateInstance(const VkInstanceCreateInfo *pCreateInfo, VkInstance *pInstance);
+    void DestroyInstance(VkInstance instance);
+    VkResult CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo, VkDevice *pDevice);
+
+    void CountMessage(VkDebugReportFlagsEXT flags) {
+        if (flags & VK_DEBUG_REPORT_ERROR_BIT_EXT) {
+            error_messages_++;
+        } else {
+            warning_messages_++;
+        }
+    }
+
+    uint64_t unmapped_handles() const { return unmapped_handles_; }
+    uint64_t result_mismatches() const { return result_mismatches_; }
+    uint64_t error_messages() const { return error_messages_; }
+    uint64_t warning_messages() const { return warning_messages_; }
+
+   private:
+    static const uint64_t kMaxReportedMismatches = 10;
+
+    const std::vector<std::string> *layers_;
+    std::unordered_map<uint64_t, uint64_t> handles_;
+    std::unordered_map<void *, std::unique_ptr<VkLayerInstanceDispatchTable>> instance_tables_;
+    std::unordered_map<void *, std::unique_ptr<VkLayerDispatchTable>> device_tables_;
+    std::unordered_map<VkInstance, VkDebugReportCallbackEXT> callbacks_;
+    uint64_t unmapped_handles_ = 0;
+    uint64_t result_mismatches_ = 0;
+    uint64_t error_messages_ = 0;
+    uint64_t warning_messages_ = 0;
+};
+
+static VKAPI_ATTR VkBool32 VKAPI_CALL CountMessage(VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType,
+                                                   uint64_t object, size_t location, int32_t messageCode,
+                                                   const char *pLayerPrefix, const char *pMessage, void *pUserData) {
+    static_cast<ApiReplayer *>(pUserData)->CountMessage(flags);
+    fprintf(stderr, "%s: %s\n", pLayerPrefix, pMessage);
+    return VK_FALSE;
+}
+
+// The requested extensions the replay can provide; the others are reported and left out
+static std::vector<const char *> SupportedExtensions(uint32_t count, const char *const *names,
+                                                     const std::vector<VkExtensionProperties> &supported) {
+    std::vector<const char *> result;
+    for (uint32_t i = 0; i < count; i++) {
+        bool found = std::any_of(supported.begin(), supported.end(), [&](const VkExtensionProperties &properties) {
+            return !strcmp(properties.extensionName, names[i]);
+        });
+        if (found) {
+            result.push_back(names[i]);
+        } else {
+            fprintf(stderr, "Extension %s is not supported by the replay and was left out\n", names[i]);
+        }
+    }
+    return result;
+}
+
+static void AppendInstanceExtensions(const char *layer, std::vector<VkExtensionProperties> *extensions) {
+    uint32_t count = 0;
+    if (vkEnumerateInstanceExtensionProperties(layer, &count, nullptr) != VK_SUCCESS) return;
+    size_t first = extensions->size();
+    extensions->resize(first + count);
+    vkEnumerateInstanceExtensionProperties(layer, &count, extensions->data() + first);
+    extensions->resize(first + count);
+}
+
+static void AppendDeviceExtensions(VkPhysicalDevice physicalDevice, std::vector<VkExtensionProperties> *extensions) {
+    uint32_t count = 0;
+    if (vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &count, nullptr) != VK_SUCCESS) return;
+    size_t first = extensions->size();
+    extensions->resize(first + count);
+    vkEnumerateDeviceExtensionProperties(physicalDevice, nullptr, &count, extensions->data() + first);
+    extensions->resize(first + count);
+}
+
+// The instance is created with the replay's layers, and with VK_EXT_debug_report so their messages can be counted
+VkResult ApiReplayer::CreateInstance(const VkInstanceCreateInfo *pCreateInfo, VkInstance *pInstance) {
+    std::vector<const char *> layers;
+    if (layers_) {
+        for (const auto &layer : *layers_) layers.push_back(layer.c_str());
+    } else {
+        for (uint32_t i = 0; i < pCreateInfo->enabledLayerCount; i++) {
+            const char *layer = pCreateInfo->ppEnabledLayerNames[i];
+            if (strcmp(layer, kCaptureLayerName)) layers.push_back(layer);
+        }
+    }
+
+    std::vector<VkExtensionProperties> supported;
+    AppendInstanceExtensions(nullptr, &supported);
+    for (auto layer : layers) AppendInstanceExtensions(layer, &supported);
+    std::vector<const char *> extensions =
+        SupportedExtensions(pCreateInfo->enabledExtensionCount, pCreateInfo->ppEnabledExtensionNames, supported);
+    bool debug_report = std::any_of(supported.begin(), supported.end(), [](const VkExtensionProperties &properties) {
+        return !strcmp(properties.extensionName, VK_EXT_DEBUG_REPORT_EXTENSION_NAME);
+    });
+    if (debug_report && std::none_of(extensions.begin(), extensions.end(), [](const char *name) {
+            return !strcmp(name, VK_EXT_DEBUG_REPORT_EXTENSION_NAME);
+        })) {
+        extensions.push_back(VK_EXT_DEBUG_REPORT_EXTENSION_NAME);
+    }
+
+    VkInstanceCreateInfo create_info = *pCreateInfo;
+    create_info.enabledLayerCount = static_cast<uint32_t>(layers.size());
+    create_info.ppEnabledLayerNames = layers.data();
+    create_info.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    create_info.ppEnabledExtensionNames = extensions.data();
+
+    VkResult result = vkCreateInstance(&create_info, nullptr, pInstance);
+    if (result != VK_SUCCESS) return result;
+
+    std::unique_ptr<VkLayerInstanceDispatchTable> table(new VkLayerInstanceDispatchTable);
+    layer_init_instance_dispatch_table(*pInstance, table.get(), vkGetInstanceProcAddr);
+    if (debug_report && table->CreateDebugReportCallbackEXT) {
+        VkDebugReportCallbackCreateInfoEXT callback_info = {};
+        callback_info.sType = VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT;
+        callback_info.flags =
+            VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT | VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT;
+        callback_info.pfnCallback = ::CountMessage;
+        callback_info.pUserData = this;
+        VkDebugReportCallbackEXT callback = VK_NULL_HANDLE;
+        if (table->CreateDebugReportCallbackEXT(*pInstance, &callback_info, nullptr, &callback) == VK_SUCCESS) {
+            callbacks_[*pInstance] = callback;
+        }
+    }
+    instance_tables_[*reinterpret_cast<void **>(*pInstance)] = std::move(table);
+    return result;
+}
+
+void ApiReplayer::DestroyInstance(VkInstance instance) {
+    auto table = InstanceTable(instance);
+    if (!table) return;
+    auto callback = callbacks_.find(instance);
+    if (callback != callbacks_.end()) {
+        table->DestroyDebugReportCallbackEXT(instance, callback->second, nullptr);
+        callbacks_.erase(callback);
+    }
+    void *key = *reinterpret_cast<void **>(instance);
+    table->DestroyInstance(instance, nullptr);
+    instance_tables_.erase(key);
+}
+
+// Device layers are deprecated, so only the extensions are carried over. The device is created through the loader's
+// entry point, which builds the device's layer chain.
+VkResult ApiReplayer::CreateDevice(VkPhysicalDevice physicalDevice, const VkDeviceCreateInfo *pCreateInfo, VkDevice *pDevice) {
+    std::vector<VkExtensionProperties> supported;
+    AppendDeviceExtensions(physicalDevice, &supported);
+    std::vector<const char *> extensions =
+        SupportedExtensions(pCreateInfo->enabledExtensionCount, pCreateInfo->ppEnabledExtensionNames, supported);
+
+    VkDeviceCreateInfo create_info = *pCreateInfo;
+    create_info.enabledLayerCount = 0;
+    create_info.ppEnabledLayerNames = nullptr;
+    create_info.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    create_info.ppEnabledExtensionNames = extensions.data();
+
+    VkResult result = vkCreateDevice(physicalDevice, &create_info, nullptr, pDevice);
+    if (result != VK_SUCCESS) return result;
+
+    std::unique_ptr<VkLayerDispatchTable> table(new VkLayerDispatchTable);
+    layer_init_device_dispatch_table(*pDevice, table.get(), vkGetDeviceProcAddr);
+    device_tables_[*reinterpret_cast<void **>(*pDevice)] = std::move(table);
+    return result;
+}
+
+// Decodes an array of structures, or a single one, for the generated replay functions
+template <typename T>
+static const T *DecodeStructs(ApiReplayer *replayer, ApiCaptureDecoder *decoder,
+                              void (*decode)(ApiReplayer *, ApiCaptureDecoder *, T *)) {
+    uint32_t count = decoder->Count();
+    T *values = decoder->Array<T>(count);
+    for (uint32_t i = 0; values && i < count; i++) decode(replayer, decoder, &values[i]);
+    return values;
+}
+
+// Storage for structures the implementation fills in, with the sType it expects
+template <typename T>
+static T *ScratchStructs(ApiCaptureDecoder *decoder, VkStructureType sType) {
+    uint32_t count = decoder->Count();
+    T *values = decoder->Scratch<T>(count);
+    for (uint32_t i = 0; values && i < count; i++) values[i].sType = sType;
+    return values;
+}
+
+#include "api_replay_wrappers.h"
+
+static bool ReplayCreateInstance(ApiReplayer *replayer, ApiCaptureDecoder *decoder) {
+    const VkInstanceCreateInfo *pCreateInfo = DecodeStructs(replayer, decoder, DecodeVkInstanceCreateInfo);
+    uint32_t pInstance_capacity = decoder->Count();
+    VkInstance *pInstance = decoder->Scratch<VkInstance>(pInstance_capacity);
+    if (!pCreateInfo || !pInstance || decoder->Failed()) return false;
+    VkResult result = replayer->CreateInstance(pCreateInfo, pInstance);
+    replayer->CheckResult(kVkCommandCreateInstance, decoder->Value<VkResult>(), result);
+    replayer->MapHandles(decoder, pInstance, pInstance_capacity);
+    return true;
+}
+
+static bool ReplayDestroyInstance(ApiReplayer *replayer, ApiCaptureDecoder *decoder) {
+    VkInstance instance = replayer->Map<VkInstance>(decoder->Handle());
+    if (!instance || decoder->Failed()) return false;
+    replayer->DestroyInstance(instance);
+    return true;
+}
+
+static bool ReplayCreateDevice(ApiReplayer *replayer, ApiCaptureDecoder *decoder) {
+    VkPhysicalDevice physicalDevice = replayer->Map<VkPhysicalDevice>(decoder->Handle());
+    const VkDeviceCreateInfo *pCreateInfo = DecodeStructs(replayer, decoder, DecodeVkDeviceCreateInfo);
+    uint32_t pDevice_capacity = decoder->Count();
+    VkDevice *pDevice = decoder->Scratch<VkDevice>(pDevice_capacity);
+    if (!physicalDevice || !pCreateInfo || !pDevice || decoder->Failed()) return false;
+    VkResult result = replayer->CreateDevice(physicalDevice, pCreateInfo, pDevice);
+    replayer->CheckResult(kVkCommandCreateDevice, decoder->Value<VkResult>(), result);
+    replayer->MapHandles(decoder, pDevice, pDevice_capacity);
+    return true;
+}
+
+static bool ReadFile(const char *filename, std::vector<uint8_t> *data) {
+    FILE *input = fopen(filename, "rb");
+    if (!input) return false;
+    uint8_t buffer[64 * 1024];
+    size_t count;
+    while ((count = fread(buffer, 1, sizeof(buffer), input)) > 0) data->insert(data->end(), buffer, buffer + count);
+    bool ok = !ferror(input);
+    fclose(input);
+    return ok;
+}
+
+static std::vector<std::string> SplitList(const char *list) {
+    std::vector<std::string> result;
+    std::string item;
+    for (const char *c = list;; c++) {
+        if (*c == ',' || *c == '\0') {
+            if (!item.empty()) result.push_back(item);
+            item.clear();
+            if (*c == '\0') break;
+        } else {
+            item.push_back(*c);
+        }
+    }
+    return result;
+}
+
+static int Usage() {
+    fprintf(stderr,
+            "usage: vk_api_replay [--layers <a,b,...>] [--frame-delimiter <command>] [--frame-times <file.csv>] <capture>\n");
+    return 2;
+}
+
+int main(int argc, char **argv) {
+    std::unique_ptr<std::vector<std::string>> layers;
+    const char *frame_delimiter = "vkQueuePresentKHR";
+    const char *frame_times_file = nullptr;
+    const char *capture_file = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--layers") && i + 1 < argc) {
+            layers.reset(new std::vector<std::string>(SplitList(argv[++i])));
+        } else if (!strcmp(argv[i], "--frame-delimiter") && i + 1 < argc) {
+            frame_delimiter = argv[++i];
+        } else if (!strcmp(argv[i], "--frame-times") && i + 1 < argc) {
+            frame_times_file = argv[++i];
+        } else if (argv[i][0] != '-' && !capture_file) {
+            capture_file = argv[i];
+        } else {
+            return Usage();
+        }
+    }
+    if (!capture_file) return Usage();
+
+    VkCommandId delimiter_id = GetVkCommandId(frame_delimiter);
+    if (delimiter_id == kVkCommandIdInvalid) {
+        fprintf(stderr, "Unknown frame delimiter %s\n", frame_delimiter);
+        return 2;
+    }
+
+    std::vector<uint8_t> data;
+    if (!ReadFile(capture_file, &data)) {
+        fprintf(stderr, "Could not read %s\n", capture_file);
+        return 1;
+    }
+    ApiCaptureFileHeader header;
+    if (data.size() < sizeof(header)) {
+        fprintf(stderr, "%s is not a capture file\n", capture_file);
+        return 1;
+    }
+    memcpy(&header, data.data(), sizeof(header));
+    if (memcmp(header.magic, kApiCaptureMagic, sizeof(header.magic)) || header.version != kApiCaptureVersion) {
+        fprintf(stderr, "%s is not a version %u capture file\n", capture_file, kApiCaptureVersion);
+        return 1;
+    }
+    // Command ids are indices into the commands of the vk.xml the layer was built from
+    if (header.header_version != VK_HEADER_VERSION || header.command_count != kVkCommandIdCount) {
+        fprintf(stderr, "%s was captured with header version %u (%u commands); this replayer uses %u (%u commands)\n",
+                capture_file, header.header_version, header.command_count, VK_HEADER_VERSION, kVkCommandIdCount);
+        return 1;
+    }
+
+    ApiReplayFunction functions[kVkCommandIdCount] = {};
+    for (const auto &entry : replay_functions) functions[entry.id] = entry.function;
+
+    ApiReplayer replayer(layers.get());
+    ApiCaptureArena arena;
+    uint64_t records = 0;
+    uint64_t skipped_records = 0;
+    std::vector<double> frame_times;
+    typedef std::chrono::steady_clock clock;
+    clock::time_point frame_start = clock::now();
+    clock::time_point replay_start = frame_start;
+
+    size_t offset = sizeof(header);
+    while (offset + sizeof(ApiCaptureRecordHeader) <= data.size()) {
+        ApiCaptureRecordHeader record;
+        memcpy(&record, data.data() + offset, sizeof(record));
+        offset += sizeof(record);
+        if (record.size > data.size() - offset) {
+            fprintf(stderr, "The capture ends in the middle of a record\n");
+            break;
+        }
+
+        ApiCaptureDecoder decoder(data.data() + offset, record.size, &arena);
+        ApiReplayFunction function = record.command_id < kVkCommandIdCount ? functions[record.command_id] : nullptr;
+        if (!function || !function(&replayer, &decoder)) skipped_records++;
+        arena.Reset();
+        offset += record.size;
+        records++;
+
+        if (record.command_id == delimiter_id) {
+            clock::time_point now = clock::now();
+            frame_times.push_back(std::chrono::duration<double, std::milli>(now - frame_start).count());
+            frame_start = now;
+        }
+    }
+    double total_ms = std::chrono::duration<double, std::milli>(clock::now() - replay_start).count();
+
+    printf("Replayed %llu records in %.3f ms\n", static_cast<unsigned long long>(records), total_ms);
+    if (!frame_times.empty()) {
+        std::vector<double> sorted = frame_times;
+        std::sort(sorted.begin(), sorted.end());
+        double sum = 0;
+        for (double time : sorted) sum += time;
+        printf("Frames (%s): %zu, mean %.3f ms, median %.3f ms, min %.3f ms, max %.3f ms\n", frame_delimiter, sorted.size(),
+               sum / sorted.size(), sorted[sorted.size() / 2], sorted.front(), sorted.back());
+    }
+    printf("Validation messages: %llu errors, %llu warnings\n", static_cast<unsigned long long>(replayer.error_messages()),
+           static_cast<unsigned long long>(replayer.warning_messages()));
+    printf("Skipped records: %llu, unmapped handles: %llu, result mismatches: %llu\n",
+           static_cast<unsigned long long>(skipped_records), static_cast<unsigned long long>(replayer.unmapped_handles()),
+           static_cast<unsigned long long>(replayer.result_mismatches()));
+
+    if (frame_times_file) {
+        FILE *output = fopen(frame_times_file, "w");
+        if (!output) {
+            fprintf(stderr, "Could not write %s\n", frame_times_file);
+            return 1;
+        }
+        fprintf(output, "frame,ms\n");
+        for (size_t i = 0; i < frame_times.size(); i++) fprintf(output, "%zu,%.6f\n", i, frame_times[i]);
+        fclose(output);
+    }
+    return 0;
+}
@@ -0,0 +1,260 @@
+/* Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Decodes the files written by VK_DBG_LAYER_ACTION_LOG_BINARY (see vk_layer_binary_log.h).
+//
+//   vk_binary_log_decoder <file>            Prints every message in the same format as the text log
+//   vk_binary_log_decoder --summary <file>  Prints one line per layer and message code, most frequent first
+
+#include "vk_layer_binary_log.h"
+#include <algorithm>
+#include <cinttypes>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static void PrintMsgFlags(VkFlags msgFlags, std::string *out) {
+    static const struct {
+        VkFlags bit;
+        const char *name;
+    } names[] = {{VK_DEBUG_REPORT_DEBUG_BIT_EXT, "DEBUG"},
+                 {VK_DEBUG_REPORT_INFORMATION_BIT_EXT, "INFO"},
+                 {VK_DEBUG_REPORT_WARNING_BIT_EXT, "WARN"},
+                 {VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT, "PERF"},
+                 {VK_DEBUG_REPORT_ERROR_BIT_EXT, "ERROR"}};
+    for (const auto &name : names) {
+        if (msgFlags & name.bit) {
+            if (!out->empty()) out->append(",");
+            out->append(name.name);
+        }
+    }
+}
+
+// Formats one conversion specification with its recorded '*' arguments and value
+template <typename T>
+static void AppendConversion(std::string *out, const std::string &spec, const int *stars, uint32_t star_count, T value) {
+    char buf[512];
+    int length;
+    if (star_count == 0) {
+        length = snprintf(buf, sizeof(buf), spec.c_str(), value);
+    } else if (star_count == 1) {
+        length = snprintf(buf, sizeof(buf), spec.c_str(), stars[0], value);
+    } else {
+        length = snprintf(buf, sizeof(buf), spec.c_str(), stars[0], stars[1], value);
+    }
+    if (length < 0) return;
+    if (static_cast<size_t>(length) < sizeof(buf)) {
+        out->append(buf, length);
+    } else {
+        std::vector<char> long_buf(length + 1);
+        if (star_count == 0) {
+            snprintf(long_buf.data(), long_buf.size(), spec.c_str(), value);
+        } else if (star_count == 1) {
+            snprintf(long_buf.data(), long_buf.size(), spec.c_str(), stars[0], value);
+        } else {
+            snprintf(long_buf.data(), long_buf.size(), spec.c_str(), stars[0], stars[1], value);
+        }
+        out->append(long_buf.data(), length);
+    }
+}
+
+class BinaryLogReader {
+   public:
+    explicit BinaryLogReader(FILE *input) : input_(input) {}
+
+    // Returns false if the file is not a binary log; *version is set to the version of the log if it is one
+    bool ReadHeader(uint32_t *version) {
+        BinaryLogFileHeader header;
+        if (fread(&header, sizeof(header), 1, input_) != 1) return false;
+        *version = header.version;
+        return memcmp(header.magic, kBinaryLogMagic, sizeof(header.magic)) == 0;
+    }
+
+    // Reads records up to and including the next message. Returns false at the end of the file.
+    bool NextMessage(BinaryLogMessageRecord *record, std::vector<uint64_t> *args) {
+        uint8_t record_type;
+        while (fread(&record_type, 1, 1, input_) == 1) {
+            if (record_type == kBinaryLogRecordString) {
+                BinaryLogStringRecord string_record;
+                string_record.record_type = record_type;
+                if (fread(reinterpret_cast<char *>(&string_record) + 1, sizeof(string_record) - 1, 1, input_) != 1) return false;
+                std::string str(string_record.length, '\0');
+                if (string_record.length && fread(&str[0], string_record.length, 1, input_) != 1) return false;
+                if (strings_.size() <= string_record.id) strings_.resize(string_record.id + 1);
+                strings_[string_record.id] = str;
+            } else if (record_type == kBinaryLogRecordMessage) {
+                record->record_type = record_type;
+                if (fread(reinterpret_cast<char *>(record) + 1, sizeof(*record) - 1, 1, input_) != 1) return false;
+                args->resize(record->arg_count);
+                if (record->arg_count && fread(args->data(), sizeof(uint64_t), record->arg_count, input_) != record->arg_count) {
+                    return false;
+                }
+                return true;
+            } else {
+                fprintf(stderr, "Unknown record type %u; the file is truncated or corrupt.\n", record_type);
+                return false;
+            }
+        }
+        return false;
+    }
+
+    const char *String(uint64_t id) const {
+        if (id == kBinaryLogNullString) return "(null)";
+        return id < strings_.size() ? strings_[id].c_str() : "<missing string>";
+    }
+
+    // Reproduces the text log_msg() would have formatted for this message
+    std::string FormatMessage(const BinaryLogMessageRecord &record, const std::vector<uint64_t> &args) const {
+        std::string out;
+        const char *format = String(record.format_id);
+        const char *p = format;
+        size_t arg = 0;
+        BinaryLogConversion conversion;
+        while (NextBinaryLogConversion(p, &conversion)) {
+            out.append(p, conversion.begin - p);
+            p = conversion.begin + conversion.length;
+            std::string spec(conversion.begin, conversion.length);
+            if (conversion.type == kBinaryLogArgNone) {
+                out.append("%");
+                continue;
+            }
+            if (arg + conversion.star_count >= args.size() || conversion.star_count > 2 || spec.back() == 'n') {
+                // Arguments beyond what the writer recorded, or conversions that cannot be replayed
+                out.append(spec);
+                arg += conversion.star_count + 1;
+                continue;
+            }
+            int stars[2] = {};
+            for (uint32_t i = 0; i < conversion.star_count; i++) stars[i] = static_cast<int>(args[arg++]);
+            uint64_t value = args[arg++];
+            switch (conversion.type) {
+                case kBinaryLogArgInt:
+                    AppendConversion(&out, spec, stars, conversion.star_count, static_cast<int>(value));
+                    break;
+                case kBinaryLogArgLong:
+                    AppendConversion(&out, spec, stars, conversion.star_count, static_cast<long>(value));
+                    break;
+                case kBinaryLogArgLongLong:
+                    AppendConversion(&out, spec, stars, conversion.star_count, static_cast<long long>(value));
+                    break;
+                case kBinaryLogArgSize:
+                    AppendConversion(&out, spec, stars, conversion.star_count, static_cast<size_t>(value));
+                    break;
+                case kBinaryLogArgDouble:
+                case kBinaryLogArgLongDouble: {
+                    double d;
+                    memcpy(&d, &value, sizeof(d));
+                    if (conversion.type == kBinaryLogArgDouble) {
+                        AppendConversion(&out, spec, stars, conversion.star_count, d);
+                    } else {
+                        AppendConversion(&out, spec, stars, conversion.star_count, static_cast<long double>(d));
+                    }
+                } break;
+                case kBinaryLogArgString:
+                    AppendConversion(&out, spec, stars, conversion.star_count, String(value));
+                    break;
+                default:
+                    AppendConversion(&out, spec, stars, conversion.star_count,
+                                     reinterpret_cast<void *>(static_cast<uintptr_t>(value)));
+                    break;
+            }
+        }
+        out.append(p);
+        return out;
+    }
+
+   private:
+    FILE *input_;
+    std::vector<std::string> strings_;
+};
+
+int main(int argc, char **argv) {
+    bool summary = false;
+    const char *filename = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--summary")) {
+            summary = true;
+        } else {
+            filename = argv[i];
+        }
+    }
+    if (!filename) {
+        fprintf(stderr, "Usage: %s [--summary] <binary log file>\n", argv[0]);
+        return 1;
+    }
+
+    FILE *input = fopen(filename, "rb");
+    if (!input) {
+        fprintf(stderr, "Unable to open %s\n", filename);
+        return 1;
+    }
+    BinaryLogReader reader(input);
+    uint32_t version = 0;
+    if (!reader.ReadHeader(&version)) {
+        fprintf(stderr, "%s is not a binary validation log\n", filename);
+        fclose(input);
+        return 1;
+    }
+    if (version != kBinaryLogVersion) {
+        fprintf(stderr, "%s is a version %u binary validation log; this decoder reads version %u\n", filename, version,
+                kBinaryLogVersion);
+        fclose(input);
+        return 1;
+    }
+
+    struct CodeSummary {
+        uint64_t count = 0;
+        VkFlags flags = 0;
+        std::string first_message;
+    };
+    std::map<std::pair<std::string, int32_t>, CodeSummary> summaries;
+
+    BinaryLogMessageRecord record;
+    std::vector<uint64_t> args;
+    while (reader.NextMessage(&record, &args)) {
+        if (summary) {
+            CodeSummary &code_summary = summaries[std::make_pair(std::string(reader.String(record.prefix_id)), record.msg_code)];
+            if (code_summary.count++ == 0) code_summary.first_message = reader.FormatMessage(record, args);
+            code_summary.flags |= record.flags;
+            continue;
+        }
+        std::string msg_flags;
+        PrintMsgFlags(record.flags, &msg_flags);
+        printf("%s(%s): object: 0x%" PRIx64 " type: %d location: %lu msgCode: %d: %s\n", reader.String(record.prefix_id),
+               msg_flags.c_str(), record.object, static_cast<int>(record.object_type), (unsigned long)record.location,
+               record.msg_code, reader.FormatMessage(record, args).c_str());
+    }
+    fclose(input);
+
+    if (summary) {
+        std::vector<std::pair<std::pair<std::string, int32_t>, CodeSummary>> sorted(summaries.begin(), summaries.end());
+        std::stable_sort(sorted.begin(), sorted.end(),
+                         [](const std::pair<std::pair<std::string, int32_t>, CodeSummary> &a,
+                            const std::pair<std::pair<std::string, int32_t>, CodeSummary> &b) {
+                             return a.second.count > b.second.count;
+                         });
+        for (const auto &entry : sorted) {
+            std::string msg_flags;
+            PrintMsgFlags(entry.second.flags, &msg_flags);
+            printf("%10" PRIu64 "  %s(%s) msgCode: %d: %s\n", entry.second.count, entry.first.first.c_str(), msg_flags.c_str(),
+                   entry.first.second, entry.second.first_message.c_str());
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,206 @@
+/* Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "vk_layer_binary_log.h"
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// Packs messages into an in-memory buffer that is written to the file whenever it fills up, and when the writer is
+// destroyed. Strings are interned by content, since "%s" arguments are frequently built on the fly.
+struct BinaryLogWriter {
+    static const size_t kFlushSize = 64 * 1024;
+
+    explicit BinaryLogWriter(FILE *output) : output_(output), start_(std::chrono::steady_clock::now()) {
+        BinaryLogFileHeader header;
+        memcpy(header.magic, kBinaryLogMagic, sizeof(header.magic));
+        header.version = kBinaryLogVersion;
+        buffer_.reserve(2 * kFlushSize);
+        Append(&header, sizeof(header));
+    }
+
+    ~BinaryLogWriter() {
+        Flush();
+        fclose(output_);
+    }
+
+    void WriteMessage(VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType, uint64_t srcObject, size_t location,
+                      int32_t msgCode, const char *pLayerPrefix, const char *format, va_list args) {
+        uint64_t timestamp = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_).count());
+        uint32_t thread_id = static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+
+        // Collect the arguments first; strings are only interned once the lock is held
+        uint64_t values[kBinaryLogMaxArgs];
+        const char *strings[kBinaryLogMaxArgs];
+        uint32_t arg_count = 0;
+        BinaryLogConversion conversion;
+        for (const char *p = format; arg_count < kBinaryLogMaxArgs && NextBinaryLogConversion(p, &conversion);
+             p = conversion.begin + conversion.length) {
+            for (uint32_t i = 0; i < conversion.star_count && arg_count < kBinaryLogMaxArgs; i++) {
+                strings[arg_count] = nullptr;
+                values[arg_count++] = static_cast<uint64_t>(static_cast<int64_t>(va_arg(args, int)));
+            }
+            if (conversion.type == kBinaryLogArgNone || arg_count == kBinaryLogMaxArgs) continue;
+            uint64_t value = 0;
+            strings[arg_count] = nullptr;
+            switch (conversion.type) {
+                case kBinaryLogArgInt:
+                    value = static_cast<uint64_t>(static_cast<int64_t>(va_arg(args, int)));
+                    break;
+                case kBinaryLogArgLong:
+                    value = static_cast<uint64_t>(static_cast<int64_t>(va_arg(args, long)));
+                    break;
+                case kBinaryLogArgLongLong:
+                    value = static_cast<uint64_t>(va_arg(args, long long));
+                    break;
+                case kBinaryLogArgSize:
+                    value = static_cast<uint64_t>(va_arg(args, size_t));
+                    break;
+                case kBinaryLogArgDouble: {
+                    double d = va_arg(args, double);
+                    memcpy(&value, &d, sizeof(value));
+                } break;
+                case kBinaryLogArgLongDouble: {
+                    double d = static_cast<double>(va_arg(args, long double));
+                    memcpy(&value, &d, sizeof(value));
+                } break;
+                case kBinaryLogArgString:
+                    strings[arg_count] = va_arg(args, const char *);
+                    value = kBinaryLogNullString;
+                    break;
+                default:
+                    value = reinterpret_cast<uintptr_t>(va_arg(args, void *));
+                    break;
+            }
+            values[arg_count++] = value;
+        }
+
+        BinaryLogMessageRecord record;
+        record.record_type = kBinaryLogRecordMessage;
+        record.arg_count = static_cast<uint8_t>(arg_count);
+        record.flags = static_cast<uint8_t>(msgFlags);
+        record.reserved = 0;
+        record.object_type = static_cast<uint32_t>(objectType);
+        record.thread_id = thread_id;
+        record.timestamp = timestamp;
+        record.object = srcObject;
+        record.location = location;
+        record.msg_code = msgCode;
+
+        std::lock_guard<std::mutex> lock(lock_);
+        record.prefix_id = InternString(pLayerPrefix);
+        record.format_id = InternString(format);
+        for (uint32_t i = 0; i < arg_count; i++) {
+            if (strings[i]) values[i] = InternString(strings[i]);
+        }
+        Append(&record, sizeof(record));
+        Append(values, arg_count * sizeof(uint64_t));
+        if (buffer_.size() >= kFlushSize) Flush();
+    }
+
+   private:
+    static uint64_t HashString(const char *str, size_t length) {
+        // FNV-1a over 8 byte words, then the remaining bytes
+        uint64_t hash = 14695981039346656037ULL;
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t)) {
+            uint64_t word;
+            memcpy(&word, str + i, sizeof(word));
+            hash = (hash ^ word) * 1099511628211ULL;
+        }
+        for (; i < length; i++) {
+            hash = (hash ^ static_cast<uint8_t>(str[i])) * 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    // Returns the id of str, writing a string record the first time it is seen. Must be called with lock_ held.
+    uint32_t InternString(const char *str) {
+        size_t length = strlen(str);
+        // Most strings are literals, so first try the id last seen at this address; a compare is cheaper than a hash
+        auto cached = ids_by_address_.find(str);
+        if (cached != ids_by_address_.end()) {
+            const std::string &existing = strings_[cached->second];
+            if (existing.size() == length && memcmp(existing.data(), str, length) == 0) return cached->second;
+        }
+
+        uint32_t id = LookupString(str, length);
+        ids_by_address_[str] = id;
+        return id;
+    }
+
+    uint32_t LookupString(const char *str, size_t length) {
+        uint64_t hash = HashString(str, length);
+        auto range = string_ids_.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it) {
+            const std::string &existing = strings_[it->second];
+            if (existing.size() == length && memcmp(existing.data(), str, length) == 0) return it->second;
+        }
+
+        uint32_t id = static_cast<uint32_t>(strings_.size());
+        strings_.emplace_back(str, length);
+        string_ids_.emplace(hash, id);
+
+        BinaryLogStringRecord record = {};
+        record.record_type = kBinaryLogRecordString;
+        record.id = id;
+        record.length = static_cast<uint32_t>(length);
+        Append(&record, sizeof(record));
+        Append(str, length);
+        return id;
+    }
+
+    void Append(const void *data, size_t size) {
+        const char *bytes = static_cast<const char *>(data);
+        buffer_.insert(buffer_.end(), bytes, bytes + size);
+    }
+
+    void Flush() {
+        if (!buffer_.empty()) {
+            fwrite(buffer_.data(), 1, buffer_.size(), output_);
+            buffer_.clear();
+        }
+        fflush(output_);
+    }
+
+    FILE *output_;
+    std::chrono::steady_clock::time_point start_;
+    std::mutex lock_;
+    std::vector<char> buffer_;
+    std::vector<std::string> strings_;
+    std::unordered_multimap<uint64_t, uint32_t> string_ids_;
+    std::unordered_map<const char *, uint32_t> ids_by_address_;
+};
+
+VK_LAYER_EXPORT BinaryLogWriter *CreateBinaryLogWriter(const char *filename) {
+    FILE *output = fopen(filename, "wb");
+    if (!output) return nullptr;
+    return new BinaryLogWriter(output);
+}
+
+VK_LAYER_EXPORT void BinaryLogWriteMessage(BinaryLogWriter *writer, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
+                                           uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix,
+                                           const char *format, va_list args) {
+    writer->WriteMessage(msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, format, args);
+}
+
+VK_LAYER_EXPORT void DestroyBinaryLogWriter(BinaryLogWriter *writer) { delete writer; }
@@ -0,0 +1,180 @@
+/* Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Binary validation message log.
+//
+// Instead of formatting each message to text, log_msg() can hand its format string and arguments to a BinaryLogWriter,
+// which packs them into a record and appends it to a file. Strings (format strings, layer prefixes and "%s" arguments) are
+// written once, in a string record, and referred to by id afterwards, so long messages such as the specification text
+// attached to VALIDATION_ERROR_* codes cost a few bytes per occurrence. vk_binary_log_decoder renders the file back to
+// the same text log_callback() would have written, or summarizes it by message code.
+//
+// File layout: a BinaryLogFileHeader, followed by any number of records. Each record starts with a one byte record type.
+//   kBinaryLogRecordString:  BinaryLogStringRecord, followed by length bytes of string data (not NUL terminated)
+//   kBinaryLogRecordMessage: BinaryLogMessageRecord, followed by arg_count 64-bit arguments
+// All values are written in the byte order of the machine that wrote the log.
+
+#ifndef VK_LAYER_BINARY_LOG_H
+#define VK_LAYER_BINARY_LOG_H
+
+#include "vulkan/vulkan.h"
+#include "vulkan/vk_layer.h"
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static const char kBinaryLogMagic[4] = {'V', 'K', 'B', 'L'};
+static const uint32_t kBinaryLogVersion = 2;
+
+// Arguments are recorded as they are found in the format string; a message with more is truncated to this many
+static const uint32_t kBinaryLogMaxArgs = 32;
+// Argument value recorded for a NULL "%s" argument
+static const uint64_t kBinaryLogNullString = 0xFFFFFFFF;
+
+enum BinaryLogRecordType {
+    kBinaryLogRecordString = 1,
+    kBinaryLogRecordMessage = 2,
+};
+
+struct BinaryLogFileHeader {
+    char magic[4];
+    uint32_t version;
+};
+
+struct BinaryLogStringRecord {
+    uint8_t record_type;
+    uint8_t reserved[3];
+    uint32_t id;
+    uint32_t length;
+};
+
+struct BinaryLogMessageRecord {
+    uint8_t record_type;
+    uint8_t arg_count;
+    uint8_t flags;
+    uint8_t reserved;
+    uint32_t thread_id;
+    uint32_t object_type;  // VkDebugReportObjectTypeEXT, including extension values
+    int32_t msg_code;
+    uint64_t timestamp;  // Nanoseconds since the writer was created
+    uint64_t object;
+    uint64_t location;
+    uint32_t prefix_id;
+    uint32_t format_id;
+};
+
+// How a single printf conversion consumes its argument
+enum BinaryLogArgType {
+    kBinaryLogArgNone,        // "%%"
+    kBinaryLogArgInt,         // int, or anything promoted to it
+    kBinaryLogArgLong,        // long
+    kBinaryLogArgLongLong,    // long long, intmax_t
+    kBinaryLogArgSize,        // size_t, ptrdiff_t
+    kBinaryLogArgDouble,      // double
+    kBinaryLogArgLongDouble,  // long double
+    kBinaryLogArgString,      // const char *
+    kBinaryLogArgPointer,     // void *
+};
+
+struct BinaryLogConversion {
+    const char *begin;    // The '%' starting the conversion
+    size_t length;        // Length of the conversion specification, including the '%' and the conversion character
+    uint32_t star_count;  // Number of '*' widths and precisions, each consuming an int argument before the value
+    BinaryLogArgType type;
+};
+
+// Finds the next conversion specification in format. Returns false when there is none.
+static inline bool NextBinaryLogConversion(const char *format, BinaryLogConversion *conversion) {
+    const char *p = format;
+    while (*p && *p != '%') p++;
+    if (!*p) return false;
+
+    conversion->begin = p++;
+    conversion->star_count = 0;
+    // Flags, width and precision
+    while (*p && strchr("-+ #0'123456789.*", *p)) {
+        if (*p == '*') conversion->star_count++;
+        p++;
+    }
+    // Length modifier
+    int longs = 0;
+    bool size = false;
+    bool long_double = false;
+    while (*p && strchr("hlLjztq", *p)) {
+        if (*p == 'l') longs++;
+        if (*p == 'j' || *p == 'q') longs = 2;
+        if (*p == 'z' || *p == 't') size = true;
+        if (*p == 'L') long_double = true;
+        p++;
+    }
+
+    switch (*p) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+        case 'c':
+            conversion->type = size ? kBinaryLogArgSize
+                                    : (longs >= 2 ? kBinaryLogArgLongLong : (longs == 1 ? kBinaryLogArgLong : kBinaryLogArgInt));
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            conversion->type = long_double ? kBinaryLogArgLongDouble : kBinaryLogArgDouble;
+            break;
+        case 's':
+            conversion->type = kBinaryLogArgString;
+            break;
+        case '%':
+            conversion->type = kBinaryLogArgNone;
+            break;
+        default:
+            // 'p', and anything unexpected, is consumed as a pointer-sized value
+            conversion->type = kBinaryLogArgPointer;
+            break;
+    }
+    if (*p) p++;
+    conversion->length = p - conversion->begin;
+    return true;
+}
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct BinaryLogWriter BinaryLogWriter;
+VK_LAYER_EXPORT BinaryLogWriter *CreateBinaryLogWriter(const char *filename);
+VK_LAYER_EXPORT void BinaryLogWriteMessage(BinaryLogWriter *writer, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
+                                           uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix,
+                                           const char *format, va_list args);
+VK_LAYER_EXPORT void DestroyBinaryLogWriter(BinaryLogWriter *writer);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // VK_LAYER_BINARY_LOG_H
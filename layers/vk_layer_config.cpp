@@ -23,12 +23,18 @@
  **************************************************************************/
 #include "vk_layer_config.h"
 #include "vulkan/vk_sdk_platform.h"
+#include <atomic>
+#include <condition_variable>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <stdlib.h>
 #include <string.h>
 #include <string>
 #include <sys/stat.h>
+#include <thread>
 #include <vulkan/vk_layer.h>
 
 #define MAX_CHARS_PER_LINE 4096
@@ -282,3 +288,139 @@ void print_msg_flags(VkFlags msgFlags, char *msg_flags) {
         strcat(msg_flags, "ERROR");
     }
 }
+
+// Bounded multi-producer, single-consumer queue of log messages drained into a FILE by a background thread. Each slot carries
+// a sequence number that tells producers and the consumer whose turn it is to use it, so enqueueing never takes a lock.
+// Short messages are copied into the slot itself; longer ones are copied to the heap and released by the writer thread.
+// The writer thread sleeps on a condition variable while the queue is empty, and producers only touch the mutex to wake it.
+struct LayerLogWriter {
+    static const size_t kInlineTextSize = 512;
+    static const size_t kMaxMessageSize = 64 * 1024;
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        size_t length;
+        char *heap_text;
+        char inline_text[kInlineTextSize];
+    };
+
+    LayerLogWriter(FILE *output, uint32_t queue_size)
+        : output_(output), mask_(0), enqueue_pos_(0), dequeue_pos_(0), dropped_(0), stop_(false), sleeping_(false) {
+        size_t slot_count = 2;
+        while (slot_count < queue_size) slot_count <<= 1;
+        slots_.reset(new Slot[slot_count]);
+        mask_ = slot_count - 1;
+        for (size_t i = 0; i < slot_count; i++) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        thread_ = std::thread(&LayerLogWriter::Run, this);
+    }
+
+    ~LayerLogWriter() {
+        stop_.store(true);
+        Wake();
+        thread_.join();
+        Drain();
+        fflush(output_);
+    }
+
+    void Append(const char *text, size_t length) {
+        if (length > kMaxMessageSize) length = kMaxMessageSize;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        Slot *slot;
+        for (;;) {
+            slot = &slots_[pos & mask_];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                // Queue is full; drop the message rather than block or grow without bound
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        slot->heap_text = nullptr;
+        char *dest = slot->inline_text;
+        if (length > kInlineTextSize) {
+            slot->heap_text = static_cast<char *>(malloc(length));
+            dest = slot->heap_text;
+        }
+        slot->length = dest ? length : 0;
+        if (dest) memcpy(dest, text, length);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+        // Pairs with the fence in Run(): either the writer sees this message before sleeping, or we see it asleep
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_relaxed)) Wake();
+    }
+
+   private:
+    // Write out everything currently queued with a single fwrite, returning the number of messages written
+    size_t Drain() {
+        size_t count = 0;
+        batch_.clear();
+        for (;;) {
+            Slot *slot = &slots_[dequeue_pos_ & mask_];
+            size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            if (sequence != dequeue_pos_ + 1) break;
+            const char *text = slot->heap_text ? slot->heap_text : slot->inline_text;
+            batch_.append(text, slot->length);
+            free(slot->heap_text);
+            slot->sequence.store(dequeue_pos_ + mask_ + 1, std::memory_order_release);
+            dequeue_pos_++;
+            count++;
+        }
+        uint64_t dropped = dropped_.exchange(0, std::memory_order_relaxed);
+        if (dropped) {
+            batch_ += "Log queue full: " + std::to_string(dropped) + " messages were dropped\n";
+        }
+        if (!batch_.empty()) {
+            fwrite(batch_.data(), 1, batch_.size(), output_);
+            fflush(output_);
+        }
+        return count;
+    }
+
+    bool Pending() const {
+        return slots_[dequeue_pos_ & mask_].sequence.load(std::memory_order_acquire) == dequeue_pos_ + 1;
+    }
+
+    void Wake() {
+        std::lock_guard<std::mutex> lock(wake_mutex_);
+        wake_.notify_one();
+    }
+
+    void Run() {
+        while (!stop_.load()) {
+            if (Drain() != 0) continue;
+            std::unique_lock<std::mutex> lock(wake_mutex_);
+            sleeping_.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            wake_.wait(lock, [this] { return stop_.load() || Pending(); });
+            sleeping_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    FILE *output_;
+    std::unique_ptr<Slot[]> slots_;
+    size_t mask_;
+    std::atomic<size_t> enqueue_pos_;
+    size_t dequeue_pos_;  // Only touched by the writer thread, and by the destructor after it has been joined
+    std::atomic<uint64_t> dropped_;
+    std::atomic<bool> stop_;
+    std::atomic<bool> sleeping_;  // Set by the writer thread while it waits for messages
+    std::mutex wake_mutex_;
+    std::condition_variable wake_;
+    std::string batch_;
+    std::thread thread_;
+};
+
+VK_LAYER_EXPORT LayerLogWriter *CreateLayerLogWriter(FILE *output, uint32_t queue_size) {
+    return new LayerLogWriter(output, queue_size);
+}
+
+VK_LAYER_EXPORT void LayerLogWriterAppend(LayerLogWriter *writer, const char *text, size_t length) { writer->Append(text, length); }
+
+VK_LAYER_EXPORT void DestroyLayerLogWriter(LayerLogWriter *writer) { delete writer; }
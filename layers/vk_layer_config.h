@@ -36,6 +36,7 @@ typedef enum VkLayerDbgActionBits {
     VK_DBG_LAYER_ACTION_LOG_MSG = 0x00000002,
     VK_DBG_LAYER_ACTION_BREAK = 0x00000004,
     VK_DBG_LAYER_ACTION_DEBUG_OUTPUT = 0x00000008,
+    VK_DBG_LAYER_ACTION_LOG_BINARY = 0x00000010,
     VK_DBG_LAYER_ACTION_DEFAULT = 0x40000000,
 } VkLayerDbgActionBits;
 typedef VkFlags VkLayerDbgActionFlags;
@@ -45,6 +46,7 @@ const std::unordered_map<std::string, VkFlags> debug_actions_option_definitions
     {std::string("VK_DBG_LAYER_ACTION_CALLBACK"), VK_DBG_LAYER_ACTION_CALLBACK},
     {std::string("VK_DBG_LAYER_ACTION_LOG_MSG"), VK_DBG_LAYER_ACTION_LOG_MSG},
     {std::string("VK_DBG_LAYER_ACTION_BREAK"), VK_DBG_LAYER_ACTION_BREAK},
+    {std::string("VK_DBG_LAYER_ACTION_LOG_BINARY"), VK_DBG_LAYER_ACTION_LOG_BINARY},
 #if defined(WIN32)
     {std::string("VK_DBG_LAYER_ACTION_DEBUG_OUTPUT"), VK_DBG_LAYER_ACTION_DEBUG_OUTPUT},
 #endif
@@ -57,14 +59,22 @@ const std::unordered_map<std::string, VkFlags> report_flags_option_definitions =
     {std::string("error"), VK_DEBUG_REPORT_ERROR_BIT_EXT},
     {std::string("debug"), VK_DEBUG_REPORT_DEBUG_BIT_EXT}};
 
-const char *getLayerOption(const char *_option);
+VK_LAYER_EXPORT const char *getLayerOption(const char *_option);
 FILE *getLayerLogOutput(const char *_option, const char *layerName);
 VkFlags GetLayerOptionFlags(std::string _option, std::unordered_map<std::string, VkFlags> const &enum_data,
                             uint32_t option_default);
 
-void setLayerOption(const char *_option, const char *_val);
+VK_LAYER_EXPORT void setLayerOption(const char *_option, const char *_val);
 void print_msg_flags(VkFlags msgFlags, char *msg_flags);
 
+// Asynchronous log file output. Messages are queued by the reporting thread and written to the file in batches by a
+// background thread, so file I/O does not stall the thread making API calls. When the queue is full, messages are dropped
+// and a count of dropped messages is written once space is available. Destroying the writer drains the queue and flushes.
+typedef struct LayerLogWriter LayerLogWriter;
+VK_LAYER_EXPORT LayerLogWriter *CreateLayerLogWriter(FILE *output, uint32_t queue_size);
+VK_LAYER_EXPORT void LayerLogWriterAppend(LayerLogWriter *writer, const char *text, size_t length);
+VK_LAYER_EXPORT void DestroyLayerLogWriter(LayerLogWriter *writer);
+
 #ifdef __cplusplus
 }
 #endif
@@ -25,11 +25,17 @@
 
 // For the given data key, look up the layer_data instance from given layer_data_map
 template <typename DATA_T>
+DATA_T *GetLayerDataPtr(void *data_key, LayerDataRegistry<DATA_T> &layer_data_map) {
+    return layer_data_map.find_or_create(data_key);
+}
+
+// For the given data key, look up the layer_data instance from given layer_data_map. Not thread safe; layers use a
+// LayerDataRegistry instead.
+template <typename DATA_T>
 DATA_T *GetLayerDataPtr(void *data_key, std::unordered_map<void *, DATA_T *> &layer_data_map) {
     DATA_T *debug_data;
     typename std::unordered_map<void *, DATA_T *>::const_iterator got;
 
-    /* TODO: We probably should lock here, or have caller lock */
     got = layer_data_map.find(data_key);
 
     if (got == layer_data_map.end()) {
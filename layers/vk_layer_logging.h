@@ -23,23 +23,105 @@
 #define LAYER_LOGGING_H
 
 #include "vk_loader_layer.h"
+#include "vk_layer_binary_log.h"
 #include "vk_layer_config.h"
 #include "vk_layer_data.h"
 #include "vk_layer_table.h"
 #include "vk_loader_platform.h"
 #include "vulkan/vk_layer.h"
+#include <atomic>
 #include <cinttypes>
+#include <mutex>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdio.h>
+#include <string>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
+// Suppresses repeats of the same message (same msgCode reported against the same object) once a configured number of them
+// has been delivered. Every summary_interval suppressed repeats, the caller is told to emit a single summary message instead.
+// A suppressed repeat gets the verdict the callbacks returned the last time the message was delivered, so an application
+// that asks for a call to be skipped keeps having it skipped.
+// Layers call ForgetObject() when an object is destroyed, so a new object that is handed the same handle starts counting
+// from zero. At most kMaxTrackedMessages pairs are counted; pairs seen after that are always reported.
+// Configured per layer through the <LayerIdentifier>.duplicate_message_limit and .duplicate_message_summary_interval settings.
+class DuplicateMessageFilter {
+   public:
+    struct MessageCount {
+        uint64_t reported;
+        uint64_t suppressed;
+        // What the callbacks returned the last time the message was delivered. Stored after delivery without the lock.
+        std::atomic<bool> verdict;
+        MessageCount() : reported(0), suppressed(0), verdict(false) {}
+    };
+
+    static const size_t kMaxTrackedMessages = 64 * 1024;
+
+    DuplicateMessageFilter(uint32_t limit, uint32_t summary_interval)
+        : limit_(limit), summary_interval_(summary_interval), tracked_(0) {}
+
+    // Counts an occurrence of the message and returns its record, which stays valid until the object is forgotten. *report
+    // is set if this occurrence should be delivered, in which case the caller stores what the callbacks returned in the
+    // record's verdict. When it should not, *summary_count is set to the number of occurrences suppressed since the last
+    // summary if a summary is now due, and to zero otherwise.
+    MessageCount &ShouldReport(int32_t msg_code, uint64_t object, bool *report, uint64_t *summary_count) {
+        std::lock_guard<std::mutex> lock(lock_);
+        *summary_count = 0;
+        *report = true;
+        auto &object_counts = counts_[object];
+        auto count_it = object_counts.find(msg_code);
+        if (count_it == object_counts.end()) {
+            if (tracked_ >= kMaxTrackedMessages) {
+                if (object_counts.empty()) counts_.erase(object);
+                return untracked_;
+            }
+            tracked_++;
+            count_it = object_counts.emplace(std::piecewise_construct, std::forward_as_tuple(msg_code), std::tuple<>()).first;
+        }
+        MessageCount &count = count_it->second;
+        if (count.reported < limit_) {
+            count.reported++;
+            return count;
+        }
+        count.suppressed++;
+        if (summary_interval_ && (count.suppressed % summary_interval_ == 0)) {
+            *summary_count = summary_interval_;
+        }
+        *report = false;
+        return count;
+    }
+
+    // Drops the counts of every message reported against a destroyed object. The application may not use an object while
+    // destroying it, so no message about it can be between ShouldReport() and storing its verdict.
+    void ForgetObject(uint64_t object) {
+        std::lock_guard<std::mutex> lock(lock_);
+        auto object_counts = counts_.find(object);
+        if (object_counts != counts_.end()) {
+            tracked_ -= object_counts->second.size();
+            counts_.erase(object_counts);
+        }
+    }
+
+   private:
+    uint32_t limit_;
+    uint32_t summary_interval_;
+    std::mutex lock_;
+    size_t tracked_;
+    std::unordered_map<uint64_t, std::unordered_map<int32_t, MessageCount>> counts_;
+    MessageCount untracked_;
+};
+
 typedef struct _debug_report_data {
     VkLayerDbgFunctionNode *debug_callback_list;
     VkLayerDbgFunctionNode *default_debug_callback_list;
     VkFlags active_flags;
     bool g_DEBUG_REPORT;
+    DuplicateMessageFilter *duplicate_filter;  // Only allocated when duplicate message limiting is configured
+    LayerLogWriter *log_writer;                // Only allocated when asynchronous log file output is configured
+    BinaryLogWriter *binary_log;               // Only allocated when binary log output is configured
+    VkFlags binary_log_flags;                  // Message types recorded by binary_log
 } debug_report_data;
 
 template debug_report_data *GetLayerDataPtr<debug_report_data>(void *data_key,
@@ -150,6 +232,10 @@ static inline void layer_debug_report_destroy_instance(debug_report_data *debug_
     if (debug_data) {
         RemoveAllMessageCallbacks(debug_data, &debug_data->default_debug_callback_list);
         RemoveAllMessageCallbacks(debug_data, &debug_data->debug_callback_list);
+        delete debug_data->duplicate_filter;
+        // Drain and flush any queued log output now that no further messages can be reported
+        if (debug_data->log_writer) DestroyLayerLogWriter(debug_data->log_writer);
+        if (debug_data->binary_log) DestroyBinaryLogWriter(debug_data->binary_log);
         free(debug_data);
     }
 }
@@ -297,8 +383,8 @@ static void layer_disable_tmp_callbacks(debug_report_data *debug_data, uint32_t
 // Checks if the message will get logged.
 // Allows layer to defer collecting & formating data if the
 // message will be discarded.
-static inline bool will_log_msg(debug_report_data *debug_data, VkFlags msgFlags) {
-    if (!debug_data || !(debug_data->active_flags & msgFlags)) {
+static inline bool will_log_msg(const debug_report_data *debug_data, VkFlags msgFlags) {
+    if (!debug_data || !((debug_data->active_flags | debug_data->binary_log_flags) & msgFlags)) {
         // Message is not wanted
         return false;
     }
@@ -306,6 +392,12 @@ static inline bool will_log_msg(debug_report_data *debug_data, VkFlags msgFlags)
     return true;
 }
 
+// Called by layers when an object is destroyed, so that a new object that gets the same handle does not inherit the
+// duplicate message counts of the old one
+static inline void debug_report_forget_object(const debug_report_data *debug_data, uint64_t object) {
+    if (debug_data && debug_data->duplicate_filter) debug_data->duplicate_filter->ForgetObject(object);
+}
+
 #ifdef WIN32
 static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
     *strp = nullptr;
@@ -321,6 +413,39 @@ static inline int vasprintf(char **strp, char const *fmt, va_list ap) {
 }
 #endif
 
+// Decides whether a message is delivered, before any of its text is formatted. Returns false if it is not, with *verdict set
+// to what the caller should return. Otherwise *count is the duplicate filter's record for the message, if there is a filter,
+// in which the caller stores what the callbacks returned.
+static inline bool log_msg_admit(const debug_report_data *debug_data, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
+                                 uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix,
+                                 DuplicateMessageFilter::MessageCount **count, bool *verdict) {
+    *count = nullptr;
+    *verdict = false;
+    if (!debug_data || !((debug_data->active_flags | debug_data->binary_log_flags) & msgFlags)) {
+        // Message is not wanted
+        return false;
+    }
+
+    // Drop repeats beyond the configured limit
+    if (debug_data->duplicate_filter) {
+        bool report = true;
+        uint64_t summary_count = 0;
+        *count = &debug_data->duplicate_filter->ShouldReport(msgCode, srcObject, &report, &summary_count);
+        if (!report) {
+            if (summary_count) {
+                char summary[128];
+                snprintf(summary, sizeof(summary),
+                         "%" PRIu64 " more occurrences of message code %d for object 0x%" PRIx64 " were suppressed.", summary_count,
+                         msgCode, srcObject);
+                debug_report_log_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, summary);
+            }
+            *verdict = (*count)->verdict;
+            return false;
+        }
+    }
+    return true;
+}
+
 // Output log message via DEBUG_REPORT
 // Takes format and variable arg list so that output string
 // is only computed if a message needs to be logged
@@ -332,22 +457,86 @@ static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags
 static inline bool log_msg(const debug_report_data *debug_data, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
                            uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix, const char *format,
                            ...) {
-    if (!debug_data || !(debug_data->active_flags & msgFlags)) {
-        // Message is not wanted
-        return false;
+    DuplicateMessageFilter::MessageCount *count;
+    bool verdict;
+    if (!log_msg_admit(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, &count, &verdict)) {
+        return verdict;
+    }
+
+    // The binary log records the format string and raw arguments, so text is only produced if a callback wants it
+    if (debug_data->binary_log_flags & msgFlags) {
+        va_list argptr;
+        va_start(argptr, format);
+        BinaryLogWriteMessage(debug_data->binary_log, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, format,
+                              argptr);
+        va_end(argptr);
+        if (!(debug_data->active_flags & msgFlags)) return false;
     }
 
+    // Most messages fit in a stack buffer, so only fall back to a heap allocation for long ones
+    char stack_str[1024];
+    char *heap_str = nullptr;
+    const char *str = stack_str;
     va_list argptr;
+    va_list argptr_copy;
     va_start(argptr, format);
-    char *str;
-    if (-1 == vasprintf(&str, format, argptr)) {
-        // On failure, glibc vasprintf leaves str undefined
-        str = nullptr;
+    va_copy(argptr_copy, argptr);
+#ifdef WIN32
+    // _vsnprintf returns -1 when the output is truncated
+    int length = _vsnprintf(stack_str, sizeof(stack_str) - 1, format, argptr);
+    stack_str[sizeof(stack_str) - 1] = '\0';
+#else
+    int length = vsnprintf(stack_str, sizeof(stack_str), format, argptr);
+#endif
+    if (length < 0 || static_cast<size_t>(length) >= sizeof(stack_str) - 1) {
+        if (-1 == vasprintf(&heap_str, format, argptr_copy)) {
+            // On failure, glibc vasprintf leaves str undefined
+            heap_str = nullptr;
+        }
+        str = heap_str;
     }
+    va_end(argptr_copy);
     va_end(argptr);
     bool result = debug_report_log_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix,
                                        str ? str : "Allocation failure");
-    free(str);
+    free(heap_str);
+    if (count) count->verdict = result;
+    return result;
+}
+
+#ifndef WIN32
+static inline void log_binary_msg(const debug_report_data *debug_data, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
+                                  uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix,
+                                  const char *format, ...) __attribute__((format(printf, 8, 9)));
+#endif
+static inline void log_binary_msg(const debug_report_data *debug_data, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
+                                  uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix,
+                                  const char *format, ...) {
+    va_list argptr;
+    va_start(argptr, format);
+    BinaryLogWriteMessage(debug_data->binary_log, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, format, argptr);
+    va_end(argptr);
+}
+
+// Output log message via DEBUG_REPORT, for messages whose text is built with std::stringstream or std::string rather than
+// a format string. format_msg() returns the text and is only called once the message is known to be delivered.
+template <typename Formatter>
+static inline bool log_msg_deferred(const debug_report_data *debug_data, VkFlags msgFlags, VkDebugReportObjectTypeEXT objectType,
+                                    uint64_t srcObject, size_t location, int32_t msgCode, const char *pLayerPrefix,
+                                    const Formatter &format_msg) {
+    DuplicateMessageFilter::MessageCount *count;
+    bool verdict;
+    if (!log_msg_admit(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, &count, &verdict)) {
+        return verdict;
+    }
+
+    const std::string str = format_msg();
+    if (debug_data->binary_log_flags & msgFlags) {
+        log_binary_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, "%s", str.c_str());
+        if (!(debug_data->active_flags & msgFlags)) return false;
+    }
+    bool result = debug_report_log_msg(debug_data, msgFlags, objectType, srcObject, location, msgCode, pLayerPrefix, str.c_str());
+    if (count) count->verdict = result;
     return result;
 }
 
@@ -365,6 +554,30 @@ static inline VKAPI_ATTR VkBool32 VKAPI_CALL log_callback(VkFlags msgFlags, VkDe
     return false;
 }
 
+// Same output as log_callback, but handed to a LayerLogWriter so the file is written by a background thread
+static inline VKAPI_ATTR VkBool32 VKAPI_CALL async_log_callback(VkFlags msgFlags, VkDebugReportObjectTypeEXT objType,
+                                                                uint64_t srcObject, size_t location, int32_t msgCode,
+                                                                const char *pLayerPrefix, const char *pMsg, void *pUserData) {
+    char msg_flags[30];
+    char buf[1024];
+
+    print_msg_flags(msgFlags, msg_flags);
+
+    int length = snprintf(buf, sizeof(buf), "%s(%s): object: 0x%" PRIx64 " type: %d location: %lu msgCode: %d: %s\n", pLayerPrefix,
+                          msg_flags, srcObject, objType, (unsigned long)location, msgCode, pMsg);
+    if (length < 0) return false;
+    if (static_cast<size_t>(length) < sizeof(buf)) {
+        LayerLogWriterAppend((LayerLogWriter *)pUserData, buf, length);
+    } else {
+        std::vector<char> long_buf(length + 1);
+        snprintf(long_buf.data(), long_buf.size(), "%s(%s): object: 0x%" PRIx64 " type: %d location: %lu msgCode: %d: %s\n",
+                 pLayerPrefix, msg_flags, srcObject, objType, (unsigned long)location, msgCode, pMsg);
+        LayerLogWriterAppend((LayerLogWriter *)pUserData, long_buf.data(), length);
+    }
+
+    return false;
+}
+
 static inline VKAPI_ATTR VkBool32 VKAPI_CALL win32_debug_output_msg(VkFlags msgFlags, VkDebugReportObjectTypeEXT objType,
                                                                     uint64_t srcObject, size_t location, int32_t msgCode,
                                                                     const char *pLayerPrefix, const char *pMsg, void *pUserData) {
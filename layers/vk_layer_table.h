@@ -21,10 +21,125 @@
 
 #include "vulkan/vk_layer.h"
 #include "vulkan/vulkan.h"
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
-typedef std::unordered_map<void *, VkLayerDispatchTable *> device_table_map;
-typedef std::unordered_map<void *, VkLayerInstanceDispatchTable *> instance_table_map;
+// Maps dispatch keys to a layer's per-instance or per-device data, or to its dispatch tables. Every entry point looks
+// its data up here, so lookups take no lock: the first kSlotCount keys live in a fixed array of slots that readers scan,
+// and a key is published only after its data, so a reader that finds the key sees the data. The first instance or
+// device takes the first slot, and the scan usually ends there. Inserting and erasing take a lock, and keys beyond the
+// slots fall back to a locked map. A slot that is erased can be reused for another key; as with any Vulkan object, the
+// application must not use an instance or device while it is being destroyed.
+template <typename DATA_T>
+class LayerDataRegistry {
+   public:
+    static const uint32_t kSlotCount = 16;
+
+    LayerDataRegistry() : used_slots_(0), has_overflow_(false) {
+        for (uint32_t i = 0; i < kSlotCount; i++) {
+            slots_[i].key.store(nullptr, std::memory_order_relaxed);
+            slots_[i].data.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    // Returns the data for the key, or nullptr if there is none
+    DATA_T *find(void *key) {
+        uint32_t published_slots = used_slots_.load(std::memory_order_acquire);
+        for (uint32_t i = 0; i < published_slots; i++) {
+            if (slots_[i].key.load(std::memory_order_acquire) == key) return slots_[i].data.load(std::memory_order_relaxed);
+        }
+        if (!has_overflow_.load(std::memory_order_acquire)) return nullptr;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto got = overflow_.find(key);
+        return got == overflow_.end() ? nullptr : got->second;
+    }
+
+    // Returns the data for the key, creating it if there is none yet
+    DATA_T *find_or_create(void *key) {
+        DATA_T *data = find(key);
+        if (data) return data;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        data = find_locked(key);
+        if (!data) {
+            data = new DATA_T;
+            insert_locked(key, data);
+        }
+        return data;
+    }
+
+    // Adds data for a key that has none
+    void insert(void *key, DATA_T *data) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        insert_locked(key, data);
+    }
+
+    // Forgets the key. The data is the caller's to free.
+    void erase(void *key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (uint32_t i = 0; i < used_slots_.load(std::memory_order_relaxed); i++) {
+            if (slots_[i].key.load(std::memory_order_relaxed) == key) {
+                slots_[i].key.store(nullptr, std::memory_order_release);
+                slots_[i].data.store(nullptr, std::memory_order_relaxed);
+                return;
+            }
+        }
+        overflow_.erase(key);
+        has_overflow_.store(!overflow_.empty(), std::memory_order_release);
+    }
+
+    // The data of every key, at the time of the call
+    std::vector<DATA_T *> values() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<DATA_T *> result;
+        for (uint32_t i = 0; i < used_slots_.load(std::memory_order_relaxed); i++) {
+            if (slots_[i].key.load(std::memory_order_relaxed)) result.push_back(slots_[i].data.load(std::memory_order_relaxed));
+        }
+        for (auto &entry : overflow_) result.push_back(entry.second);
+        return result;
+    }
+
+   private:
+    struct Slot {
+        std::atomic<void *> key;
+        std::atomic<DATA_T *> data;
+    };
+
+    DATA_T *find_locked(void *key) {
+        for (uint32_t i = 0; i < used_slots_.load(std::memory_order_relaxed); i++) {
+            if (slots_[i].key.load(std::memory_order_relaxed) == key) return slots_[i].data.load(std::memory_order_relaxed);
+        }
+        auto got = overflow_.find(key);
+        return got == overflow_.end() ? nullptr : got->second;
+    }
+
+    // Takes the first free slot, or the next unused one
+    void insert_locked(void *key, DATA_T *data) {
+        uint32_t used_slots = used_slots_.load(std::memory_order_relaxed);
+        uint32_t i = 0;
+        while (i < used_slots && slots_[i].key.load(std::memory_order_relaxed)) i++;
+        if (i < kSlotCount) {
+            slots_[i].data.store(data, std::memory_order_relaxed);
+            slots_[i].key.store(key, std::memory_order_release);
+            if (i == used_slots) used_slots_.store(used_slots + 1, std::memory_order_release);
+        } else {
+            overflow_[key] = data;
+            has_overflow_.store(true, std::memory_order_release);
+        }
+    }
+
+    Slot slots_[kSlotCount];
+    std::atomic<uint32_t> used_slots_;
+    std::atomic<bool> has_overflow_;
+    std::mutex mutex_;
+    std::unordered_map<void *, DATA_T *> overflow_;
+};
+
+typedef LayerDataRegistry<VkLayerDispatchTable> device_table_map;
+typedef LayerDataRegistry<VkLayerInstanceDispatchTable> instance_table_map;
 VkLayerDispatchTable *initDeviceTable(VkDevice device, const PFN_vkGetDeviceProcAddr gpa, device_table_map &map);
 VkLayerDispatchTable *initDeviceTable(VkDevice device, const PFN_vkGetDeviceProcAddr gpa);
 VkLayerInstanceDispatchTable *initInstanceTable(VkInstance instance, const PFN_vkGetInstanceProcAddr gpa, instance_table_map &map);
@@ -19,8 +19,10 @@
  *
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <string>
+#include <iostream>
 #include <vector>
 #include <map>
 #include "vulkan/vulkan.h"
@@ -98,9 +100,19 @@ VK_LAYER_EXPORT void layer_debug_actions(debug_report_data *report_data, std::ve
     std::string report_flags_key = layer_identifier;
     std::string debug_action_key = layer_identifier;
     std::string log_filename_key = layer_identifier;
+    std::string duplicate_limit_key = layer_identifier;
+    std::string duplicate_interval_key = layer_identifier;
     report_flags_key.append(".report_flags");
     debug_action_key.append(".debug_action");
     log_filename_key.append(".log_filename");
+    duplicate_limit_key.append(".duplicate_message_limit");
+    duplicate_interval_key.append(".duplicate_message_summary_interval");
+    std::string log_async_key = layer_identifier;
+    std::string log_async_queue_size_key = layer_identifier;
+    log_async_key.append(".log_async");
+    log_async_queue_size_key.append(".log_async_queue_size");
+    std::string log_binary_filename_key = layer_identifier;
+    log_binary_filename_key.append(".log_binary_filename");
 
     // Initialize layer options
     VkDebugReportFlagsEXT report_flags = GetLayerOptionFlags(report_flags_key, report_flags_option_definitions, 0);
@@ -108,6 +120,13 @@ VK_LAYER_EXPORT void layer_debug_actions(debug_report_data *report_data, std::ve
     // Flag as default if these settings are not from a vk_layer_settings.txt file
     bool default_layer_callback = (debug_action & VK_DBG_LAYER_ACTION_DEFAULT) ? true : false;
 
+    // Optionally limit how many times the same message may be reported against the same object
+    uint32_t duplicate_limit = static_cast<uint32_t>(strtoul(getLayerOption(duplicate_limit_key.c_str()), NULL, 0));
+    if (duplicate_limit && !report_data->duplicate_filter) {
+        uint32_t summary_interval = static_cast<uint32_t>(strtoul(getLayerOption(duplicate_interval_key.c_str()), NULL, 0));
+        report_data->duplicate_filter = new DuplicateMessageFilter(duplicate_limit, summary_interval);
+    }
+
     if (debug_action & VK_DBG_LAYER_ACTION_LOG_MSG) {
         const char *log_filename = getLayerOption(log_filename_key.c_str());
         FILE *log_output = getLayerLogOutput(log_filename, layer_identifier);
@@ -117,10 +136,32 @@ VK_LAYER_EXPORT void layer_debug_actions(debug_report_data *report_data, std::ve
         dbgCreateInfo.flags = report_flags;
         dbgCreateInfo.pfnCallback = log_callback;
         dbgCreateInfo.pUserData = (void *)log_output;
+        if (!strcmp(getLayerOption(log_async_key.c_str()), "true") && !report_data->log_writer) {
+            uint32_t queue_size = static_cast<uint32_t>(strtoul(getLayerOption(log_async_queue_size_key.c_str()), NULL, 0));
+            report_data->log_writer = CreateLayerLogWriter(log_output, queue_size ? queue_size : 4096);
+            dbgCreateInfo.pfnCallback = async_log_callback;
+            dbgCreateInfo.pUserData = (void *)report_data->log_writer;
+        }
         layer_create_msg_callback(report_data, default_layer_callback, &dbgCreateInfo, pAllocator, &callback);
         logging_callback.push_back(callback);
     }
 
+    // Binary output bypasses the callback list; log_msg() hands the unformatted message straight to the writer
+    if ((debug_action & VK_DBG_LAYER_ACTION_LOG_BINARY) && !report_data->binary_log) {
+        std::string log_binary_filename = getLayerOption(log_binary_filename_key.c_str());
+        if (log_binary_filename.empty()) {
+            log_binary_filename = std::string(layer_identifier) + ".vkbl";
+        }
+        report_data->binary_log = CreateBinaryLogWriter(log_binary_filename.c_str());
+        if (report_data->binary_log) {
+            report_data->binary_log_flags = report_flags;
+        } else {
+            std::cout << std::endl
+                      << layer_identifier << " ERROR: Bad binary log filename specified: " << log_binary_filename
+                      << ". Binary log output disabled." << std::endl;
+        }
+    }
+
     callback = VK_NULL_HANDLE;
 
     if (debug_action & VK_DBG_LAYER_ACTION_DEBUG_OUTPUT) {
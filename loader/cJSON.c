@@ -33,9 +33,15 @@
 #include <float.h>
 #include <limits.h>
 #include <ctype.h>
+#include <stddef.h>
 #include "cJSON.h"
 
-static const char *ep;
+/* The loader parses manifests on several threads, so each keeps its own error position */
+#if defined(_WIN32)
+static __declspec(thread) const char *ep;
+#else
+static __thread const char *ep;
+#endif
 
 const char *cJSON_GetErrorPtr(void) { return ep; }
 
@@ -471,6 +477,253 @@ cJSON *cJSON_ParseWithOpts(const char *value, const char **return_parse_end, int
 /* Default options for cJSON_Parse */
 cJSON *cJSON_Parse(const char *value) { return cJSON_ParseWithOpts(value, 0, 0); }
 
+/* In-situ parsing.  cJSON_ParseInSitu accepts the same text as cJSON_Parse and builds the same
+ * tree, but unescapes strings in place inside the text and takes the items from a few large
+ * blocks, so a document costs a handful of allocations instead of one or two per value.  The
+ * tree points into the text, which must outlive it, and is freed with cJSON_DeleteInSitu. */
+typedef struct cJSON_InSituBlock {
+    struct cJSON_InSituBlock *next;
+    size_t capacity;
+    size_t used;
+    cJSON items[1];
+} cJSON_InSituBlock;
+
+static cJSON_InSituBlock *cJSON_InSituNewBlock(size_t capacity) {
+    cJSON_InSituBlock *block =
+        (cJSON_InSituBlock *)cJSON_malloc(sizeof(cJSON_InSituBlock) + (capacity - 1) * sizeof(cJSON));
+    if (block) {
+        block->next = 0;
+        block->capacity = capacity;
+        block->used = 0;
+    }
+    return block;
+}
+
+/* Takes an item from the last block, starting a block twice its size when it is full. The
+ * first block holds the root and links all the others. */
+static cJSON *cJSON_InSituNewItem(cJSON_InSituBlock *first, cJSON_InSituBlock **last) {
+    cJSON *node;
+    if ((*last)->used == (*last)->capacity) {
+        cJSON_InSituBlock *block = cJSON_InSituNewBlock((*last)->capacity * 2);
+        if (!block) return 0;
+        block->next = first->next;
+        first->next = block;
+        *last = block;
+    }
+    node = &(*last)->items[(*last)->used++];
+    memset(node, 0, sizeof(cJSON));
+    return node;
+}
+
+/* Like parse_string, but writes the unescaped string over the text. The unescaped string is
+ * never longer than its escaped form, so the write position never overtakes the read position.
+ * Where parse_string would read past the end of the text, in an escape sequence cut short by
+ * it, this fails instead. */
+static char *parse_string_in_situ(char *str, char **out) {
+    char *ptr = str + 1;
+    char *ptr2 = str + 1;
+    unsigned uc, uc2;
+    int len;
+    if (*str != '\"') {
+        ep = str;
+        return 0;
+    } /* not a string! */
+
+    while (*ptr != '\"' && *ptr) {
+        if (*ptr != '\\')
+            *ptr2++ = *ptr++;
+        else {
+            ptr++;
+            switch (*ptr) {
+                case 'b':
+                    *ptr2++ = '\b';
+                    break;
+                case 'f':
+                    *ptr2++ = '\f';
+                    break;
+                case 'n':
+                    *ptr2++ = '\n';
+                    break;
+                case 'r':
+                    *ptr2++ = '\r';
+                    break;
+                case 't':
+                    *ptr2++ = '\t';
+                    break;
+                case 'u': /* transcode utf16 to utf8. */
+                    if (!ptr[1] || !ptr[2] || !ptr[3] || !ptr[4]) {
+                        ep = str;
+                        return 0;
+                    }
+                    uc = parse_hex4(ptr + 1);
+                    ptr += 4; /* get the unicode char. */
+
+                    if ((uc >= 0xDC00 && uc <= 0xDFFF) || uc == 0) break; /* check for invalid.	*/
+
+                    if (uc >= 0xD800 && uc <= 0xDBFF) /* UTF16 surrogate pairs.	*/
+                    {
+                        if (ptr[1] != '\\' || ptr[2] != 'u') break; /* missing second-half of surrogate.	*/
+                        if (!ptr[3] || !ptr[4] || !ptr[5] || !ptr[6]) {
+                            ep = str;
+                            return 0;
+                        }
+                        uc2 = parse_hex4(ptr + 3);
+                        ptr += 6;
+                        if (uc2 < 0xDC00 || uc2 > 0xDFFF) break; /* invalid second-half of surrogate.	*/
+                        uc = 0x10000 + (((uc & 0x3FF) << 10) | (uc2 & 0x3FF));
+                    }
+
+                    len = 4;
+                    if (uc < 0x80)
+                        len = 1;
+                    else if (uc < 0x800)
+                        len = 2;
+                    else if (uc < 0x10000)
+                        len = 3;
+                    ptr2 += len;
+
+                    switch (len) {
+                        case 4:
+                            *--ptr2 = ((uc | 0x80) & 0xBF);
+                            uc >>= 6;
+                            /* fall through */
+                        case 3:
+                            *--ptr2 = ((uc | 0x80) & 0xBF);
+                            uc >>= 6;
+                            /* fall through */
+                        case 2:
+                            *--ptr2 = ((uc | 0x80) & 0xBF);
+                            uc >>= 6;
+                            /* fall through */
+                        case 1:
+                            *--ptr2 = ((unsigned char)uc | firstByteMark[len]);
+                    }
+                    ptr2 += len;
+                    break;
+                case '\0':
+                    ep = str;
+                    return 0;
+                default:
+                    *ptr2++ = *ptr;
+                    break;
+            }
+            ptr++;
+        }
+    }
+    if (*ptr == '\"') ptr++;
+    *ptr2 = 0;
+    *out = str + 1;
+    return ptr;
+}
+
+static char *skip_in_situ(char *in) {
+    while (in && *in && (unsigned char)*in <= 32) in++;
+    return in;
+}
+
+static char *parse_value_in_situ(cJSON *item, char *value, cJSON_InSituBlock *first, cJSON_InSituBlock **last);
+
+static char *parse_array_in_situ(cJSON *item, char *value, cJSON_InSituBlock *first, cJSON_InSituBlock **last) {
+    cJSON *child;
+    item->type = cJSON_Array;
+    value = skip_in_situ(value + 1);
+    if (*value == ']') return value + 1; /* empty array. */
+
+    item->child = child = cJSON_InSituNewItem(first, last);
+    if (!item->child) return 0;
+    value = skip_in_situ(parse_value_in_situ(child, skip_in_situ(value), first, last));
+    if (!value) return 0;
+
+    while (*value == ',') {
+        cJSON *new_item;
+        if (!(new_item = cJSON_InSituNewItem(first, last))) return 0;
+        child->next = new_item;
+        new_item->prev = child;
+        child = new_item;
+        value = skip_in_situ(parse_value_in_situ(child, skip_in_situ(value + 1), first, last));
+        if (!value) return 0;
+    }
+
+    if (*value == ']') return value + 1; /* end of array */
+    ep = value;
+    return 0; /* malformed. */
+}
+
+static char *parse_object_in_situ(cJSON *item, char *value, cJSON_InSituBlock *first, cJSON_InSituBlock **last) {
+    cJSON *child, *new_item;
+    item->type = cJSON_Object;
+    value = skip_in_situ(value + 1);
+    if (*value == '}') return value + 1; /* empty object. */
+
+    item->child = child = cJSON_InSituNewItem(first, last);
+    if (!item->child) return 0;
+    for (;;) {
+        value = skip_in_situ(parse_string_in_situ(skip_in_situ(value), &child->string));
+        if (!value) return 0;
+        if (*value != ':') {
+            ep = value;
+            return 0;
+        }                                                                          /* fail! */
+        value = skip_in_situ(parse_value_in_situ(child, skip_in_situ(value + 1), first, last)); /* get the value. */
+        if (!value) return 0;
+        if (*value != ',') break;
+
+        if (!(new_item = cJSON_InSituNewItem(first, last))) return 0;
+        child->next = new_item;
+        new_item->prev = child;
+        child = new_item;
+        value++;
+    }
+
+    if (*value == '}') return value + 1; /* end of object */
+    ep = value;
+    return 0; /* malformed. */
+}
+
+static char *parse_value_in_situ(cJSON *item, char *value, cJSON_InSituBlock *first, cJSON_InSituBlock **last) {
+    if (!value) return 0; /* Fail on null. */
+    if (*value == '\"') {
+        char *end = parse_string_in_situ(value, &item->valuestring);
+        if (end) item->type = cJSON_String;
+        return end;
+    }
+    if (*value == '[') {
+        return parse_array_in_situ(item, value, first, last);
+    }
+    if (*value == '{') {
+        return parse_object_in_situ(item, value, first, last);
+    }
+    /* Literals and numbers don't allocate, so they are parsed as usual */
+    return (char *)parse_value(item, value);
+}
+
+cJSON *cJSON_ParseInSitu(char *value) {
+    /* Manifests need roughly one item per 24 bytes of text */
+    cJSON_InSituBlock *first = cJSON_InSituNewBlock(strlen(value) / 24 + 8);
+    cJSON_InSituBlock *last = first;
+    cJSON *c;
+    ep = 0;
+    if (!first) return 0; /* memory fail */
+
+    c = cJSON_InSituNewItem(first, &last);
+    if (!parse_value_in_situ(c, skip_in_situ(value), first, &last)) {
+        cJSON_DeleteInSitu(c);
+        return 0;
+    } /* parse failure. ep is set. */
+    return c;
+}
+
+void cJSON_DeleteInSitu(cJSON *c) {
+    cJSON_InSituBlock *block;
+    if (!c) return;
+    block = (cJSON_InSituBlock *)((char *)c - offsetof(cJSON_InSituBlock, items));
+    while (block) {
+        cJSON_InSituBlock *next = block->next;
+        cJSON_free(block);
+        block = next;
+    }
+}
+
 /* Render a cJSON item/entity/structure to text. */
 char *cJSON_Print(cJSON *item) { return print_value(item, 0, 1, 0); }
 char *cJSON_PrintUnformatted(cJSON *item) { return print_value(item, 0, 0, 0); }
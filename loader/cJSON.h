@@ -152,6 +152,12 @@ The item->next and ->prev pointers are always zero on return from Duplicate. */
  * terminated, and to retrieve the pointer to the final byte parsed. */
 extern cJSON *cJSON_ParseWithOpts(const char *value, const char **return_parse_end, int require_null_terminated);
 
+/* Parse value like cJSON_Parse, unescaping strings in place. The tree points into value, which
+ * must not be freed or changed while it is in use. Call cJSON_DeleteInSitu when finished. */
+extern cJSON *cJSON_ParseInSitu(char *value);
+/* Delete a tree returned by cJSON_ParseInSitu. */
+extern void cJSON_DeleteInSitu(cJSON *c);
+
 extern void cJSON_Minify(char *json);
 
 /* Macros for creating things quickly. */
@@ -148,19 +148,34 @@ struct loader_layer_list {
     struct loader_layer_properties *list;
 };
 
-struct loader_dispatch_hash_list {
-    size_t capacity;
-    uint32_t count;
-    uint32_t *index;  // index into the dev_ext dispatch table
+// Index of an unknown entry point that no ICD or layer supports, or that arrived after every trampoline was in use
+#define LOADER_UNKNOWN_EXT_UNSUPPORTED UINT32_MAX
+
+// An entry point name that is not known to the loader, and the trampoline (in dev_ext_trampoline.c or phys_dev_ext.c) that
+// dispatches it. Entries are immutable once published, apart from layers_checked.
+struct loader_unknown_ext_entry {
+    const char *name;  // Stored after the entry, in the same allocation
+    uint32_t hash;
+    uint32_t index;  // Into loader_dev_ext_dispatch_table.dev_ext or phys_dev_ext, or LOADER_UNKNOWN_EXT_UNSUPPORTED
+    // Physical device entry points only: whether some ICD supports it, and whether the layers have been asked for it yet
+    bool icd_supported;
+    uint32_t layers_checked;
 };
 
-// loader_dispatch_hash_entry and loader_dev_ext_dispatch_table.dev_ext have
-// one to one correspondence; one loader_dispatch_hash_entry for one dev_ext
-// dispatch entry.
-// Also have a one to one correspondence with functions in dev_ext_trampoline.c
-struct loader_dispatch_hash_entry {
-    char *func_name;
-    struct loader_dispatch_hash_list list;  // to handle hashing collisions
+// Open addressing table of entries with linear probing, kept at most half full. When it grows, the old copy is kept in
+// retired until the instance is destroyed, since threads looking up names may still be reading it.
+struct loader_unknown_ext_table {
+    struct loader_unknown_ext_table *retired;
+    uint32_t capacity;  // Power of two
+    void **slots;       // struct loader_unknown_ext_entry *, NULL for an empty slot
+};
+
+// Lookups read table and its slots without a lock; inserts are serialized by loader_unknown_ext_lock.
+struct loader_unknown_ext_map {
+    void *table;  // struct loader_unknown_ext_table *
+    uint32_t count;
+    uint32_t index_count;  // Trampolines handed out so far
+    struct loader_unknown_ext_entry *entries_by_index[MAX_NUM_UNKNOWN_EXTS];
 };
 
 typedef void(VKAPI_PTR *PFN_vkDevExt)(VkDevice device);
@@ -224,6 +239,21 @@ struct loader_instance_dispatch_table {
 };
 
 // Per instance structure
+// Small allocations made while vkCreateInstance runs, such as extension and layer lists, names and paths, are carved out
+// of a few large blocks instead of being allocated one by one, and the blocks are released with the instance. Freeing
+// arena memory does nothing, except that the most recent allocation is handed back while the arena is open.
+struct loader_arena_block {
+    struct loader_arena_block *next;
+    size_t size;
+    size_t used;
+};
+
+struct loader_instance_arena {
+    bool open;                          // Only while vkCreateInstance runs; afterwards everything goes to the heap
+    struct loader_arena_block *blocks;  // Current block first
+    void *last;                         // Most recent allocation, which can still be grown or handed back
+};
+
 struct loader_instance {
     struct loader_instance_dispatch_table *disp;  // must be first entry in structure
 
@@ -250,8 +280,8 @@ struct loader_instance {
     struct loader_icd_term *icd_terms;
     struct loader_icd_tramp_list icd_tramp_list;
 
-    struct loader_dispatch_hash_entry dev_ext_disp_hash[MAX_NUM_UNKNOWN_EXTS];
-    struct loader_dispatch_hash_entry phys_dev_ext_disp_hash[MAX_NUM_UNKNOWN_EXTS];
+    struct loader_unknown_ext_map dev_ext_map;
+    struct loader_unknown_ext_map phys_dev_ext_map;
 
     struct loader_msg_callback_map_entry *icd_msg_callback_map;
 
@@ -276,6 +306,7 @@ struct loader_instance {
     VkDebugReportCallbackEXT *tmp_callbacks;
 
     VkAllocationCallbacks alloc_callbacks;
+    struct loader_instance_arena arena;
 
     bool wsi_surface_enabled;
 #ifdef VK_USE_PLATFORM_WIN32_KHR
@@ -381,6 +412,7 @@ extern THREAD_LOCAL_DECL struct loader_instance *tls_instance;
 extern LOADER_PLATFORM_THREAD_ONCE_DEFINITION(once_init);
 extern loader_platform_thread_mutex loader_lock;
 extern loader_platform_thread_mutex loader_json_lock;
+extern loader_platform_thread_mutex loader_unknown_ext_lock;
 
 struct loader_msg_callback_map_entry {
     VkDebugReportCallbackEXT icd_obj;
@@ -392,6 +424,9 @@ void *loader_instance_heap_alloc(const struct loader_instance *instance, size_t
 void loader_instance_heap_free(const struct loader_instance *instance, void *pMemory);
 void *loader_instance_heap_realloc(const struct loader_instance *instance, void *pMemory, size_t orig_size, size_t size,
                                    VkSystemAllocationScope alloc_scope);
+void loader_instance_arena_open(struct loader_instance *inst);
+void loader_instance_arena_close(struct loader_instance *inst);
+void loader_instance_arena_destroy(struct loader_instance *inst);
 void *loader_instance_tls_heap_alloc(size_t size);
 void loader_instance_tls_heap_free(void *pMemory);
 void *loader_device_heap_alloc(const struct loader_device *device, size_t size, VkSystemAllocationScope allocationScope);
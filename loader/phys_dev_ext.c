@@ -26,6 +26,7 @@
 // unknown to the loader, it will use this code.  Technically, this is not trampoline
 // code since we don't want to optimize it out.
 
+#define _GNU_SOURCE
 #include "vk_loader_platform.h"
 #include "loader.h"
 
@@ -49,7 +50,7 @@
         struct loader_instance *inst = (struct loader_instance *)icd_term->this_instance;                             \
         if (NULL == icd_term->phys_dev_ext[num]) {                                                                    \
             loader_log(inst, VK_DEBUG_REPORT_ERROR_BIT_EXT, 0, "Extension %s not supported for this physical device", \
-                       inst->phys_dev_ext_disp_hash[num].func_name);                                                  \
+                       inst->phys_dev_ext_map.entries_by_index[num]->name);                                           \
         }                                                                                                             \
         icd_term->phys_dev_ext[num](phys_dev_term->phys_dev);                                                         \
     }
@@ -252,6 +252,7 @@ LOADER_EXPORT VKAPI_ATTR VkResult VKAPI_CALL vkCreateInstance(const VkInstanceCr
     if (pAllocator) {
         ptr_instance->alloc_callbacks = *pAllocator;
     }
+    loader_instance_arena_open(ptr_instance);
 
     // Look for one or more debug report create info structures
     // and setup a callback(s) for each one found.
@@ -372,11 +373,13 @@ out:
             loader_scanned_icd_clear(ptr_instance, &ptr_instance->icd_tramp_list);
             loader_destroy_generic_list(ptr_instance, (struct loader_generic_list *)&ptr_instance->ext_list);
 
+            loader_instance_arena_destroy(ptr_instance);
             loader_instance_heap_free(ptr_instance, ptr_instance);
         } else {
             // Remove temporary debug_report callback
             util_DestroyDebugReportCallbacks(ptr_instance, pAllocator, ptr_instance->num_tmp_callbacks,
                                              ptr_instance->tmp_callbacks);
+            loader_instance_arena_close(ptr_instance);
         }
 
         if (loaderLocked) {
@@ -442,6 +445,7 @@ LOADER_EXPORT VKAPI_ATTR void VKAPI_CALL vkDestroyInstance(VkInstance instance,
         util_FreeDebugReportCreateInfos(pAllocator, ptr_instance->tmp_dbg_create_infos, ptr_instance->tmp_callbacks);
     }
     loader_instance_heap_free(ptr_instance, ptr_instance->disp);
+    loader_instance_arena_destroy(ptr_instance);
     loader_instance_heap_free(ptr_instance, ptr_instance);
     loader_platform_thread_unlock_mutex(&loader_lock);
 }
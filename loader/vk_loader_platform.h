@@ -45,6 +45,8 @@
 #include <stdbool.h>
 #include <stdlib.h>
 #include <libgen.h>
+#include <sys/stat.h>
+#include <sys/time.h>
 
 // VK Library Filenames, Paths, etc.:
 #define PATH_SEPARATOR ':'
@@ -95,6 +97,23 @@ static inline bool loader_platform_is_path_absolute(const char *path) {
 
 static inline char *loader_platform_dirname(char *path) { return dirname(path); }
 
+// Modification time (in nanoseconds since the epoch) and size of a file, used to tell whether cached
+// information about it is still valid
+static inline bool loader_platform_file_stamp(const char *path, uint64_t *mtime, uint64_t *size) {
+    struct stat info;
+    if (stat(path, &info) != 0) return false;
+    *mtime = (uint64_t)info.st_mtim.tv_sec * 1000000000ULL + (uint64_t)info.st_mtim.tv_nsec;
+    *size = (uint64_t)info.st_size;
+    return true;
+}
+
+// Time in microseconds, for measuring how long loader operations take
+static inline uint64_t loader_platform_time_us(void) {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return (uint64_t)now.tv_sec * 1000000 + (uint64_t)now.tv_usec;
+}
+
 // Dynamic Loading of libraries:
 typedef void *loader_platform_dl_handle;
 static inline loader_platform_dl_handle loader_platform_open_library(const char *libPath) {
@@ -136,6 +155,24 @@ static inline void loader_platform_thread_cond_wait(loader_platform_thread_cond
     pthread_cond_wait(pCond, pMutex);
 }
 static inline void loader_platform_thread_cond_broadcast(loader_platform_thread_cond *pCond) { pthread_cond_broadcast(pCond); }
+// Loads that see everything written before the matching store, for data that is read without holding a lock:
+static inline void *loader_platform_atomic_load_ptr(void *const *ptr) { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+static inline void loader_platform_atomic_store_ptr(void **ptr, void *value) { __atomic_store_n(ptr, value, __ATOMIC_RELEASE); }
+static inline uint32_t loader_platform_atomic_load_u32(const uint32_t *ptr) { return __atomic_load_n(ptr, __ATOMIC_ACQUIRE); }
+static inline void loader_platform_atomic_store_u32(uint32_t *ptr, uint32_t value) {
+    __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+#define LOADER_PLATFORM_THREAD_CALL
+typedef void *loader_platform_thread_result;
+static inline bool loader_platform_thread_create(loader_platform_thread *thread, loader_platform_thread_result (*func)(void *),
+                                                 void *arg) {
+    return 0 == pthread_create(thread, NULL, func, arg);
+}
+static inline void loader_platform_thread_join(loader_platform_thread thread) { pthread_join(thread, NULL); }
+static inline uint32_t loader_platform_processor_count(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (uint32_t)count : 1;
+}
 
 #define loader_stack_alloc(size) alloca(size)
 
@@ -193,6 +230,27 @@ static bool loader_platform_file_exists(const char *path) {
 
 static bool loader_platform_is_path_absolute(const char *path) { return !PathIsRelative(path); }
 
+// Modification time (in nanoseconds since the epoch) and size of a file, used to tell whether cached
+// information about it is still valid
+static bool loader_platform_file_stamp(const char *path, uint64_t *mtime, uint64_t *size) {
+    WIN32_FILE_ATTRIBUTE_DATA info;
+    if (!GetFileAttributesExA(path, GetFileExInfoStandard, &info)) return false;
+    // FILETIME counts 100ns intervals since 1601
+    uint64_t file_time = ((uint64_t)info.ftLastWriteTime.dwHighDateTime << 32) | info.ftLastWriteTime.dwLowDateTime;
+    *mtime = (file_time - 116444736000000000ULL) * 100ULL;
+    *size = ((uint64_t)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+    return true;
+}
+
+// Time in microseconds, for measuring how long loader operations take
+static uint64_t loader_platform_time_us(void) {
+    LARGE_INTEGER counter, frequency;
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart * 1000000 +
+                      counter.QuadPart % frequency.QuadPart * 1000000 / frequency.QuadPart);
+}
+
 // WIN32 runtime doesn't have dirname().
 static inline char *loader_platform_dirname(char *path) {
     char *current, *next;
@@ -290,6 +348,41 @@ static void loader_platform_thread_cond_wait(loader_platform_thread_cond *pCond,
     SleepConditionVariableCS(pCond, pMutex, INFINITE);
 }
 static void loader_platform_thread_cond_broadcast(loader_platform_thread_cond *pCond) { WakeAllConditionVariable(pCond); }
+// Loads that see everything written before the matching store, for data that is read without holding a lock:
+static void *loader_platform_atomic_load_ptr(void *const *ptr) {
+    void *value = *(void *const volatile *)ptr;
+    MemoryBarrier();
+    return value;
+}
+static void loader_platform_atomic_store_ptr(void **ptr, void *value) {
+    MemoryBarrier();
+    *(void *volatile *)ptr = value;
+}
+static uint32_t loader_platform_atomic_load_u32(const uint32_t *ptr) {
+    uint32_t value = *(const volatile uint32_t *)ptr;
+    MemoryBarrier();
+    return value;
+}
+static void loader_platform_atomic_store_u32(uint32_t *ptr, uint32_t value) {
+    MemoryBarrier();
+    *(volatile uint32_t *)ptr = value;
+}
+#define LOADER_PLATFORM_THREAD_CALL WINAPI
+typedef DWORD loader_platform_thread_result;
+static bool loader_platform_thread_create(loader_platform_thread *thread,
+                                          loader_platform_thread_result(LOADER_PLATFORM_THREAD_CALL *func)(void *), void *arg) {
+    *thread = CreateThread(NULL, 0, func, arg, 0, NULL);
+    return NULL != *thread;
+}
+static void loader_platform_thread_join(loader_platform_thread thread) {
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+static uint32_t loader_platform_processor_count(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? info.dwNumberOfProcessors : 1;
+}
 
 #define loader_stack_alloc(size) _alloca(size)
 #else  // defined(_WIN32)
@@ -0,0 +1,639 @@
+#!/usr/bin/python3 -i
+#
+# Copyright (c) 2017 The Khronos Group Inc.
+# Copyright (c) 2017 Valve Corporation
+# Copyright (c) 2017 LunarG, Inc.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+import os,re,sys
+import xml.etree.ElementTree as etree
+from generator import *
+from collections import namedtuple
+
+#
+# ApiCaptureGeneratorOptions - subclass of GeneratorOptions.
+#
+# Additional members
+#   capture_file_type - 'capture_wrappers' for the intercepts of the api_capture layer, or 'replay_wrappers' for the
+#     per-command replay functions of vk_api_replay
+class ApiCaptureGeneratorOptions(GeneratorOptions):
+    def __init__(self,
+                 filename = None,
+                 directory = '.',
+                 apiname = None,
+                 profile = None,
+                 versions = '.*',
+                 emitversions = '.*',
+                 defaultExtensions = None,
+                 addExtensions = None,
+                 removeExtensions = None,
+                 sortProcedure = regSortFeatures,
+                 prefixText = "",
+                 genFuncPointers = True,
+                 protectFile = True,
+                 protectFeature = True,
+                 protectProto = None,
+                 protectProtoStr = None,
+                 apicall = '',
+                 apientry = '',
+                 apientryp = '',
+                 indentFuncProto = True,
+                 indentFuncPointer = False,
+                 alignFuncParam = 0,
+                 capture_file_type = ''):
+        GeneratorOptions.__init__(self, filename, directory, apiname, profile,
+                                  versions, emitversions, defaultExtensions,
+                                  addExtensions, removeExtensions, sortProcedure)
+        self.prefixText        = prefixText
+        self.genFuncPointers   = genFuncPointers
+        self.protectFile       = protectFile
+        self.protectFeature    = protectFeature
+        self.protectProto      = protectProto
+        self.protectProtoStr   = protectProtoStr
+        self.apicall           = apicall
+        self.apientry          = apientry
+        self.apientryp         = apientryp
+        self.indentFuncProto   = indentFuncProto
+        self.indentFuncPointer = indentFuncPointer
+        self.alignFuncParam    = alignFuncParam
+        self.capture_file_type = capture_file_type
+#
+# ApiCaptureOutputGenerator - subclass of OutputGenerator.
+#
+# Generates the serialization of every command for the api_capture layer, and the matching deserialization for the
+# vk_api_replay tool, from the same member metadata that drives vk_safe_struct: pointer members are followed by their
+# len attributes, pNext chains by sType, and handles are written by value for the replayer to remap. The stream format
+# itself is described in layers/vk_api_capture.h.
+class ApiCaptureOutputGenerator(OutputGenerator):
+    """Generate API capture and replay code based on XML element attributes"""
+    # Commands the loader-layer interface or the layer's own logging provide; they are never captured
+    NOT_CAPTURED = [
+        'vkGetInstanceProcAddr',
+        'vkGetDeviceProcAddr',
+        'vkEnumerateInstanceLayerProperties',
+        'vkEnumerateInstanceExtensionProperties',
+        'vkEnumerateDeviceLayerProperties',
+        'vkEnumerateDeviceExtensionProperties',
+        'vkCreateDebugReportCallbackEXT',
+        'vkDestroyDebugReportCallbackEXT',
+        'vkDebugReportMessageEXT',
+    ]
+    # Commands captured by api_capture.cpp, since they set up or tear down the layer's dispatch tables
+    CAPTURE_SPECIAL = [
+        'vkCreateInstance',
+        'vkDestroyInstance',
+        'vkCreateDevice',
+        'vkDestroyDevice',
+    ]
+    # Commands replayed by vk_api_replay.cpp, since they set up the replayer's dispatch tables and layer stack
+    REPLAY_SPECIAL = [
+        'vkCreateInstance',
+        'vkDestroyInstance',
+        'vkCreateDevice',
+    ]
+    # Structures that carry callbacks into the application; the replayer installs its own
+    EXCLUDED_STRUCTS = [
+        'VkDebugReportCallbackCreateInfoEXT',
+    ]
+    # uint64_t members that hold a handle of any type
+    HANDLE_MEMBERS = [
+        ('VkDebugMarkerObjectNameInfoEXT', 'object'),
+        ('VkDebugMarkerObjectTagInfoEXT', 'object'),
+    ]
+    # Pointer members the implementation ignores depending on other members, so they may be left dangling. As in the
+    # vk_safe_struct special cases, they are only followed when they are used, and are captured as null otherwise.
+    MEMBER_CONDITIONS = {
+        ('VkWriteDescriptorSet', 'pImageInfo'):
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || '
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER || '
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE || '
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_IMAGE || '
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT',
+        ('VkWriteDescriptorSet', 'pBufferInfo'):
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER || '
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER || '
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC || '
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC',
+        ('VkWriteDescriptorSet', 'pTexelBufferView'):
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER || '
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER',
+        ('VkDescriptorSetLayoutBinding', 'pImmutableSamplers'):
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_SAMPLER || '
+            'value->descriptorType == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER',
+        ('VkBufferCreateInfo', 'pQueueFamilyIndices'): 'value->sharingMode == VK_SHARING_MODE_CONCURRENT',
+        ('VkImageCreateInfo', 'pQueueFamilyIndices'): 'value->sharingMode == VK_SHARING_MODE_CONCURRENT',
+        ('VkSwapchainCreateInfoKHR', 'pQueueFamilyIndices'): 'value->imageSharingMode == VK_SHARING_MODE_CONCURRENT',
+        ('VkGraphicsPipelineCreateInfo', 'pViewportState'): '!RasterizerDiscardEnabled(value)',
+        ('VkGraphicsPipelineCreateInfo', 'pMultisampleState'): '!RasterizerDiscardEnabled(value)',
+        ('VkGraphicsPipelineCreateInfo', 'pDepthStencilState'): '!RasterizerDiscardEnabled(value)',
+        ('VkGraphicsPipelineCreateInfo', 'pColorBlendState'): '!RasterizerDiscardEnabled(value)',
+    }
+    def __init__(self,
+                 errFile = sys.stderr,
+                 warnFile = sys.stderr,
+                 diagFile = sys.stdout):
+        OutputGenerator.__init__(self, errFile, warnFile, diagFile)
+        self.Value = namedtuple('Value', ['type', 'name', 'pointers', 'isconst', 'staticarray', 'len', 'decl'])
+        self.StructData = namedtuple('StructData', ['name', 'members', 'returnedonly', 'stype', 'ifdef_protect'])
+        self.CommandData = namedtuple('CommandData', ['name', 'params', 'result', 'cdecl', 'ifdef_protect'])
+        self.structs = dict()                             # Map of struct and union names to StructData
+        self.struct_order = []                            # Struct and union names in registry order
+        self.commands = []                                # CommandData for every command
+        self.handles = set()                              # All handle types
+        self.platform_types = set()                       # Types defined by window system headers
+        self.plain_cache = dict()
+        self.supported_cache = dict()
+    #
+    # Called once at the beginning of each run
+    def beginFile(self, genOpts):
+        OutputGenerator.beginFile(self, genOpts)
+        self.capture_file_type = genOpts.capture_file_type
+        for elem in self.registry.tree.findall('types/type'):
+            name = elem.get('name')
+            if name is None and elem.find('name') is not None:
+                name = elem.find('name').text
+            category = elem.get('category')
+            if category == 'handle':
+                self.handles.add(name)
+            elif category is None and elem.get('requires') not in (None, 'vk_platform'):
+                self.platform_types.add(name)
+        write('// *** THIS FILE IS GENERATED - DO NOT EDIT ***', file=self.outFile)
+        write('// See api_capture_generator.py for modifications', file=self.outFile)
+        self.newline()
+        if (genOpts.prefixText):
+            for s in genOpts.prefixText:
+                write(s, file=self.outFile)
+        write('#pragma once', file=self.outFile)
+        self.newline()
+    #
+    # Write generated file content to output file
+    def endFile(self):
+        if self.capture_file_type == 'capture_wrappers':
+            write(self.GenerateCaptureWrappers(), file=self.outFile)
+        elif self.capture_file_type == 'replay_wrappers':
+            write(self.GenerateReplayWrappers(), file=self.outFile)
+        else:
+            write('Bad API Capture Generator Option %s' % self.capture_file_type, file=self.outFile)
+        OutputGenerator.endFile(self)
+    #
+    # Retrieve the type, name and declarator of a parameter or member
+    def makeValue(self, elem):
+        type = ''
+        name = ''
+        prefix = noneStr(elem.text)
+        for child in elem:
+            if child.tag == 'name':
+                name = noneStr(child.text)
+                break
+            if child.tag == 'type':
+                type = noneStr(child.text)
+            prefix += noneStr(child.text) + noneStr(child.tail)
+        staticarray = re.search(r'\[([^\]]+)\]', ''.join(elem.itertext()))
+        return self.Value(type=type,
+                          name=name,
+                          pointers=prefix.count('*'),
+                          isconst='const' in prefix,
+                          staticarray=staticarray.group(1) if staticarray else None,
+                          len=elem.get('len'),
+                          decl=prefix.strip())
+    #
+    # Collect struct and union members
+    def genType(self, typeinfo, name):
+        OutputGenerator.genType(self, typeinfo, name)
+        category = typeinfo.elem.get('category')
+        if category != 'struct' and category != 'union':
+            return
+        members = [self.makeValue(member) for member in typeinfo.elem.findall('.//member')]
+        stype = None
+        for member in members:
+            if member.type == 'VkStructureType' and member.name == 'sType':
+                # The required sType value is named in the member's values attribute or, in this registry version,
+                # in a comment of the struct definition
+                rawXml = etree.tostring(typeinfo.elem).decode('ascii')
+                result = re.search(r'VK_STRUCTURE_TYPE_\w+', rawXml)
+                if result:
+                    stype = result.group(0)
+        self.structs[name] = self.StructData(name=name,
+                                             members=members,
+                                             returnedonly=typeinfo.elem.get('returnedonly') == 'true',
+                                             stype=stype,
+                                             ifdef_protect=self.featureExtraProtect)
+        self.struct_order.append(name)
+    #
+    # Collect command parameters
+    def genCmd(self, cmdinfo, name):
+        OutputGenerator.genCmd(self, cmdinfo, name)
+        params = [self.makeValue(param) for param in cmdinfo.elem.findall('param')]
+        result = cmdinfo.elem.find('proto/type').text
+        self.commands.append(self.CommandData(name=name,
+                                              params=params,
+                                              result=result,
+                                              cdecl=self.makeCDecls(cmdinfo.elem)[0],
+                                              ifdef_protect=self.featureExtraProtect))
+    #
+    # Override makeProtoName to drop the "vk" prefix
+    def makeProtoName(self, name, tail):
+        return self.genOpts.apientry + name[2:] + tail
+    #
+    # A type is plain if its values can be copied as bytes: no pointers, handles, size_t or window system types,
+    # including in nested structs
+    def IsPlain(self, type):
+        if type in self.plain_cache:
+            return self.plain_cache[type]
+        plain = True
+        if type in self.handles or type in self.platform_types or type == 'size_t' or type.startswith('PFN_'):
+            plain = False
+        elif type in self.structs:
+            self.plain_cache[type] = False
+            for member in self.structs[type].members:
+                if member.pointers or (type, member.name) in self.HANDLE_MEMBERS or not self.IsPlain(member.type):
+                    plain = False
+                    break
+        self.plain_cache[type] = plain
+        return plain
+    #
+    # Classify how a struct member or command parameter is captured. owner is the struct or command name.
+    def ValueKind(self, owner, value):
+        type = value.type
+        if (owner, value.name) in self.HANDLE_MEMBERS:
+            return 'handle'
+        if type == 'VkAllocationCallbacks' or type.startswith('PFN_') or type in self.platform_types:
+            return 'skip'
+        if value.pointers == 0:
+            if value.staticarray:
+                return 'static_array' if self.IsPlain(type) else 'unsupported'
+            if type == 'size_t':
+                return 'size'
+            if type in self.handles:
+                return 'handle'
+            if type in self.structs and not self.IsPlain(type):
+                return 'struct'
+            return 'value'
+        if not value.isconst:
+            if value.name == 'pNext' or (type == 'void' and value.pointers == 1 and not value.len):
+                return 'skip'
+            return 'output'
+        if value.name == 'pNext':
+            return 'pnext'
+        if type == 'char':
+            return 'string' if value.pointers == 1 else 'string_array'
+        if value.pointers > 1:
+            return 'unsupported'
+        if type == 'void':
+            return 'bytes' if value.len else 'unsupported'
+        if type in self.handles:
+            return 'handle_array'
+        if type in self.structs and not self.IsPlain(type):
+            return 'struct_array'
+        return 'array'
+    #
+    # A struct can be captured if all of its members and the structs they point to can be
+    def IsSupportedStruct(self, name):
+        if name in self.supported_cache:
+            return self.supported_cache[name]
+        struct = self.structs[name]
+        supported = not struct.returnedonly and name not in self.EXCLUDED_STRUCTS
+        self.supported_cache[name] = supported
+        for member in struct.members:
+            if not supported:
+                break
+            kind = self.ValueKind(name, member)
+            if kind == 'unsupported':
+                supported = False
+            elif kind in ['struct', 'struct_array'] and not self.IsSupportedStruct(member.type):
+                supported = False
+        self.supported_cache[name] = supported
+        return supported
+    #
+    # Structs that need Encode and Decode functions; plain structs are copied as bytes
+    def CodedStructs(self):
+        return [self.structs[name] for name in self.struct_order
+                if not self.IsPlain(name) and self.IsSupportedStruct(name)]
+    #
+    # Classify the parameters of a command, or return None if it can not be captured
+    def CommandKinds(self, command):
+        if command.result not in ['void', 'VkResult']:
+            return None
+        counts = set()
+        for param in command.params:
+            if param.len:
+                counts.add(param.len.split(',')[0].split('::')[0])
+        kinds = []
+        for param in command.params:
+            kind = self.ValueKind(command.name, param)
+            if kind == 'skip' and param.type != 'VkAllocationCallbacks':
+                return None
+            if kind == 'unsupported':
+                return None
+            if kind in ['struct', 'struct_array'] and not self.IsSupportedStruct(param.type):
+                return None
+            if kind == 'output':
+                if param.type in self.handles:
+                    kind = 'output_handles'
+                elif param.name in counts:
+                    kind = 'inout_count'
+                else:
+                    kind = 'scratch'
+            kinds.append(kind)
+        return kinds
+    #
+    # The element count of a pointer member or parameter, as an expression. prefix is 'value->' for struct members.
+    def LenExpression(self, value, prefix, params = None):
+        length = value.len
+        if not length or length == 'null-terminated':
+            return '1'
+        if 'latexmath' in length:
+            if 'codeSize' in length:
+                return '%scodeSize / 4' % prefix
+            if 'rasterizationSamples' in length:
+                return '(%srasterizationSamples + 31) / 32' % prefix
+            raise Exception('Unrecognized latexmath expression %s' % length)
+        parts = length.split(',')[0].split('::')
+        expression = prefix + '->'.join(parts)
+        if params is not None and len(parts) == 1:
+            for param in params:
+                if param.name == parts[0] and param.pointers:
+                    expression = '*' + expression
+        return expression
+    #
+    # The element type of a pointer, e.g. 'void *' for void **
+    def ElementType(self, value):
+        if value.type == 'void' and value.pointers == 1:
+            return 'uint8_t'
+        return value.type + (' ' + '*' * (value.pointers - 1) if value.pointers > 1 else '')
+    #
+    # Statements encoding a member or parameter; access is the expression naming it
+    def EncodeStatements(self, kind, value, access, count):
+        if kind in ['value', 'handle']:
+            return ['encoder->%s(%s);' % ('Value' if kind == 'value' else 'Handle', access)]
+        elif kind == 'size':
+            return ['encoder->Size(%s);' % access]
+        elif kind == 'struct':
+            return ['Encode%s(encoder, &%s);' % (value.type, access)]
+        elif kind == 'static_array':
+            return ['encoder->Bytes(%s, sizeof(%s) * %s);' % (access, value.type, value.staticarray)]
+        elif kind == 'string':
+            return ['encoder->String(%s);' % access]
+        elif kind == 'string_array':
+            return ['encoder->Strings(%s, %s);' % (access, count)]
+        elif kind == 'pnext':
+            return ['EncodePNext(encoder, %s);' % access]
+        elif kind == 'bytes':
+            return ['encoder->Blob(%s, %s);' % (access, count)]
+        elif kind == 'array':
+            return ['encoder->Array(%s, %s);' % (access, count)]
+        elif kind == 'handle_array':
+            return ['encoder->Handles(%s, %s);' % (access, count)]
+        elif kind == 'struct_array' and count == '1':
+            return ['if (encoder->Pointer(%s, 1)) Encode%s(encoder, %s);' % (access, value.type, access)]
+        elif kind == 'struct_array':
+            return ['if (encoder->Pointer(%s, %s)) {' % (access, count),
+                    '    for (uint32_t i = 0; i < %s; i++) Encode%s(encoder, &%s[i]);' % (count, value.type, access),
+                    '}']
+        elif kind in ['output', 'scratch', 'output_handles']:
+            return ['encoder->Pointer(%s, %s);' % (access, count)]
+        elif kind == 'inout_count':
+            return ['if (encoder->Pointer(%s, 1)) encoder->%s(*%s);' % (access, 'Size' if value.type == 'size_t' else 'Value', access)]
+        return []
+    #
+    # Expression decoding a member or parameter, or None if it is decoded in place by DecodeInPlace
+    def DecodeExpression(self, kind, value, stype = None):
+        if kind == 'value':
+            return 'decoder->Value<%s>()' % value.type
+        elif kind == 'handle':
+            return 'replayer->Map<%s>(decoder->Handle())' % value.type
+        elif kind == 'size':
+            return 'static_cast<size_t>(decoder->Size())'
+        elif kind == 'string':
+            return 'decoder->String()'
+        elif kind == 'string_array':
+            return 'decoder->Strings()'
+        elif kind == 'pnext':
+            return 'DecodePNext(replayer, decoder)'
+        elif kind == 'bytes':
+            return 'decoder->Blob()'
+        elif kind == 'array':
+            return 'decoder->Values<%s>()' % value.type
+        elif kind == 'handle_array':
+            return 'replayer->Handles<%s>(decoder)' % value.type
+        elif kind == 'struct_array':
+            return 'DecodeStructs(replayer, decoder, Decode%s)' % value.type
+        elif kind in ['output', 'scratch']:
+            if stype is None:
+                return 'decoder->Scratch<%s>(decoder->Count())' % self.ElementType(value)
+            return 'ScratchStructs<%s>(decoder, %s)' % (value.type, stype)
+        return None
+    #
+    # Statement decoding a by-value struct or a static array into the storage named by access
+    def DecodeInPlace(self, kind, value, access):
+        if kind == 'struct':
+            return 'Decode%s(replayer, decoder, &%s);' % (value.type, access)
+        elif kind == 'static_array':
+            return 'decoder->Bytes(%s, sizeof(%s) * %s);' % (access, value.type, value.staticarray)
+        return None
+    #
+    # Wrap statements in an #ifdef for the feature that defines them
+    def Protect(self, protect, lines):
+        if protect is None:
+            return lines
+        return ['#ifdef %s' % protect] + lines + ['#endif  // %s' % protect]
+    #
+    # Output struct sType, for the replayer's scratch storage
+    def ScratchSType(self, value):
+        if value.pointers == 1 and value.type in self.structs:
+            return self.structs[value.type].stype
+        return None
+    #
+    # Encode functions for structs, and the pNext chain walker
+    def GenerateEncoders(self):
+        decls = ['static void EncodePNext(ApiCaptureEncoder *encoder, const void *pNext);']
+        defs = []
+        chain = []
+        for struct in self.CodedStructs():
+            signature = 'static void Encode%s(ApiCaptureEncoder *encoder, const %s *value)' % (struct.name, struct.name)
+            decls += self.Protect(struct.ifdef_protect, [signature + ';'])
+            body = [signature + ' {']
+            for member in struct.members:
+                kind = self.ValueKind(struct.name, member)
+                lines = self.EncodeStatements(kind, member, 'value->' + member.name, self.LenExpression(member, 'value->'))
+                condition = self.MEMBER_CONDITIONS.get((struct.name, member.name))
+                if condition:
+                    lines = ['if (%s) {' % condition] + ['    ' + line for line in lines] + \
+                            ['} else {', '    encoder->Pointer(nullptr, 0);', '}']
+                body += ['    ' + line for line in lines]
+            body.append('}')
+            defs += [''] + self.Protect(struct.ifdef_protect, body)
+            if struct.stype:
+                chain += self.Protect(struct.ifdef_protect,
+                                      ['            case %s:' % struct.stype,
+                                       '                Encode%s(encoder, reinterpret_cast<const %s *>(next));' % (struct.name, struct.name),
+                                       '                return;'])
+        walker = ['',
+                  '// Writes the first structure of the chain the replayer knows, which writes the rest of the chain in turn',
+                  'static void EncodePNext(ApiCaptureEncoder *encoder, const void *pNext) {',
+                  '    for (const ApiCaptureStructHeader *next = static_cast<const ApiCaptureStructHeader *>(pNext); next; next = static_cast<const ApiCaptureStructHeader *>(next->pNext)) {',
+                  '        switch (next->sType) {'] + chain + \
+                 ['            default:',
+                  '                break;',
+                  '        }',
+                  '    }',
+                  '    encoder->Value(kApiCaptureEndOfChain);',
+                  '}']
+        return decls + defs + walker
+    #
+    # Decode functions for structs, and the pNext chain reader
+    def GenerateDecoders(self):
+        decls = ['static const void *DecodePNext(ApiReplayer *replayer, ApiCaptureDecoder *decoder);']
+        defs = []
+        chain = []
+        for struct in self.CodedStructs():
+            signature = 'static void Decode%s(ApiReplayer *replayer, ApiCaptureDecoder *decoder, %s *value)' % (struct.name, struct.name)
+            decls += self.Protect(struct.ifdef_protect, [signature + ';'])
+            body = [signature + ' {']
+            for member in struct.members:
+                kind = self.ValueKind(struct.name, member)
+                access = 'value->' + member.name
+                expression = self.DecodeExpression(kind, member, self.ScratchSType(member))
+                if expression:
+                    body.append('    %s = %s;' % (access, expression))
+                elif self.DecodeInPlace(kind, member, access):
+                    body.append('    ' + self.DecodeInPlace(kind, member, access))
+            body.append('}')
+            defs += [''] + self.Protect(struct.ifdef_protect, body)
+            if struct.stype:
+                chain += self.Protect(struct.ifdef_protect,
+                                      ['        case %s: {' % struct.stype,
+                                       '            %s *next = decoder->Array<%s>(1);' % (struct.name, struct.name),
+                                       '            if (next) Decode%s(replayer, decoder, next);' % struct.name,
+                                       '            return next;',
+                                       '        }'])
+        reader = ['',
+                  'static const void *DecodePNext(ApiReplayer *replayer, ApiCaptureDecoder *decoder) {',
+                  '    switch (decoder->Peek<VkStructureType>()) {'] + chain + \
+                 ['        default:',
+                  '            decoder->EndOfChain();',
+                  '            return nullptr;',
+                  '    }',
+                  '}']
+        return decls + defs + reader
+    #
+    # The table a command dispatches through, from the type of its first parameter
+    def IsInstanceCommand(self, command):
+        return command.params[0].type in ['VkInstance', 'VkPhysicalDevice']
+    #
+    # Capture intercepts, and the procmap the layer looks them up in
+    def GenerateCaptureWrappers(self):
+        lines = ['namespace api_capture {', '']
+        lines += self.GenerateEncoders()
+        intercepts = []
+        for command in self.commands:
+            if command.name in self.NOT_CAPTURED:
+                continue
+            intercepts += self.Protect(command.ifdef_protect,
+                                       ['    {"%s", reinterpret_cast<PFN_vkVoidFunction>(%s)},' % (command.name, command.name[2:])])
+            if command.name in self.CAPTURE_SPECIAL:
+                lines += [''] + self.Protect(command.ifdef_protect, ['// declare only', command.cdecl])
+                continue
+            kinds = self.CommandKinds(command)
+            first = command.params[0].name
+            table = 'instance_dispatch_table' if self.IsInstanceCommand(command) else 'device_dispatch_table'
+            call = 'my_data->%s->%s(%s);' % (table, command.name[2:], ', '.join([param.name for param in command.params]))
+            if command.result == 'VkResult':
+                call = 'VkResult result = ' + call
+            body = [command.cdecl[:-1] + ' {',
+                    '    layer_data *my_data = GetLayerDataPtr(get_dispatch_key(%s), layer_data_map);' % first]
+            if kinds is None:
+                # Not representable in the stream; the call still goes through, and the capture says what is missing
+                body += ['    WarnNotCaptured(my_data, kVkCommand%s);' % command.name[2:],
+                         '    ' + call]
+            else:
+                body.append('    ApiCaptureEncoder *encoder = BeginCapture(kVkCommand%s);' % command.name[2:])
+                for param, kind in zip(command.params, kinds):
+                    count = self.LenExpression(param, '', command.params)
+                    body += ['    ' + line for line in self.EncodeStatements(kind, param, param.name, count)]
+                body.append('    ' + call)
+                if command.result == 'VkResult':
+                    body.append('    encoder->Value(result);')
+                for param, kind in zip(command.params, kinds):
+                    if kind == 'output_handles':
+                        body.append('    encoder->Handles(%s, %s);' % (param.name, self.LenExpression(param, '', command.params)))
+                body.append('    EndCapture(encoder);')
+            if command.result == 'VkResult':
+                body.append('    return result;')
+            body.append('}')
+            lines += [''] + self.Protect(command.ifdef_protect, body)
+        lines += ['',
+                  '// intercepts',
+                  'struct { const char* name; PFN_vkVoidFunction pFunc;} procmap[] = {'] + intercepts + ['};', '']
+        lines.append('}  // namespace api_capture')
+        return '\n'.join(lines)
+    #
+    # Replay functions, and the table of them by command id
+    def GenerateReplayWrappers(self):
+        lines = self.GenerateDecoders()
+        entries = []
+        for command in self.commands:
+            if command.name in self.NOT_CAPTURED or (command.name not in self.CAPTURE_SPECIAL and self.CommandKinds(command) is None):
+                continue
+            name = command.name[2:]
+            signature = 'static bool Replay%s(ApiReplayer *replayer, ApiCaptureDecoder *decoder)' % name
+            entries += self.Protect(command.ifdef_protect, ['    {kVkCommand%s, Replay%s},' % (name, name)])
+            if command.name in self.REPLAY_SPECIAL:
+                lines += [''] + self.Protect(command.ifdef_protect, ['// declare only', signature + ';'])
+                continue
+            kinds = self.CommandKinds(command)
+            body = [signature + ' {']
+            for param, kind in zip(command.params, kinds):
+                decl = param.decl if param.pointers else param.type
+                if kind == 'output_handles':
+                    body += ['    uint32_t %s_capacity = decoder->Count();' % param.name,
+                             '    %s %s = decoder->Scratch<%s>(%s_capacity);' % (decl, param.name, param.type, param.name)]
+                elif kind == 'inout_count':
+                    read = 'decoder->Size()' if param.type == 'size_t' else 'decoder->Value<%s>()' % param.type
+                    body += ['    %s %s = decoder->Scratch<%s>(decoder->Count());' % (decl, param.name, param.type),
+                             '    if (%s) *%s = %s;' % (param.name, param.name, read)]
+                elif kind == 'skip':
+                    body.append('    %s %s = nullptr;' % (decl, param.name))
+                elif kind == 'static_array':
+                    body += ['    %s %s[%s];' % (param.type, param.name, param.staticarray),
+                             '    ' + self.DecodeInPlace(kind, param, param.name)]
+                elif kind == 'struct':
+                    body += ['    %s %s = {};' % (param.type, param.name),
+                             '    ' + self.DecodeInPlace(kind, param, param.name)]
+                else:
+                    body.append('    %s %s = %s;' % (decl, param.name, self.DecodeExpression(kind, param, self.ScratchSType(param))))
+            first = command.params[0].name
+            table = 'InstanceTable' if self.IsInstanceCommand(command) else 'DeviceTable'
+            body += ['    auto table = replayer->%s(%s);' % (table, first),
+                     '    if (!table || decoder->Failed()) return false;']
+            call = 'table->%s(%s);' % (name, ', '.join([param.name for param in command.params]))
+            if command.result == 'VkResult':
+                body += ['    VkResult result = ' + call,
+                         '    replayer->CheckResult(kVkCommand%s, decoder->Value<VkResult>(), result);' % name]
+            else:
+                body.append('    ' + call)
+            for param, kind in zip(command.params, kinds):
+                if kind == 'output_handles':
+                    body.append('    replayer->MapHandles(decoder, %s, %s_capacity);' % (param.name, param.name))
+            body += ['    return true;', '}']
+            lines += [''] + self.Protect(command.ifdef_protect, body)
+        lines += ['',
+                  'typedef bool (*ApiReplayFunction)(ApiReplayer *replayer, ApiCaptureDecoder *decoder);',
+                  '',
+                  '// Replay function of every command the capture layer records',
+                  'static const struct {',
+                  '    VkCommandId id;',
+                  '    ApiReplayFunction function;',
+                  '} replay_functions[] = {'] + entries + ['};']
+        return '\n'.join(lines)
@@ -85,6 +85,7 @@ class HelperFileOutputGenerator(OutputGenerator):
         self.structMembers = []                           # List of StructMemberData records for all Vulkan structs
         self.object_types = []                            # List of all handle types
         self.debug_report_object_types = []               # Handy copy of debug_report_object_type enum data
+        self.command_names = []                           # List of all command names
 
         # Named tuples to store struct and command data
         self.StructType = namedtuple('StructType', ['name', 'value'])
@@ -173,6 +174,11 @@ class HelperFileOutputGenerator(OutputGenerator):
             self.structNames.append(name)
             self.genStruct(typeinfo, name)
     #
+    # Record each command name for the command id header
+    def genCmd(self, cmdinfo, name):
+        OutputGenerator.genCmd(self, cmdinfo, name)
+        self.command_names.append(name)
+    #
     # Generate a VkStructureType based on a structure typename
     def genVkStructureType(self, typename):
         # Add underscore between lowercase then uppercase
@@ -581,6 +587,125 @@ class HelperFileOutputGenerator(OutputGenerator):
         object_types_header += '};\n'
         return object_types_header
     #
+    # FNV-1a from a seeded basis, matching HashVkCommandName() in the generated header
+    def HashCommandName(self, name, seed):
+        hash = (2166136261 ^ seed) & 0xffffffff
+        for c in name:
+            hash = ((hash ^ ord(c)) * 16777619) & 0xffffffff
+        return hash
+    #
+    # Lay out an open addressed table of id + 1 for names. Returns the table and the longest probe sequence.
+    def LayoutCommandHashTable(self, names, table_size, seed):
+        slots = [0] * table_size
+        max_probes = 0
+        for id, name in enumerate(names):
+            slot = self.HashCommandName(name, seed) & (table_size - 1)
+            probes = 1
+            while slots[slot] != 0:
+                slot = (slot + 1) & (table_size - 1)
+                probes += 1
+            slots[slot] = id + 1
+            max_probes = max(max_probes, probes)
+        return slots, max_probes
+    #
+    # Combine command id helper header file preamble with body text and return
+    def GenerateCommandIdsHelperHeader(self):
+        command_ids_helper_header = '\n'
+        command_ids_helper_header += '#pragma once\n'
+        command_ids_helper_header += '\n'
+        command_ids_helper_header += '#include <assert.h>\n'
+        command_ids_helper_header += '#include <stddef.h>\n'
+        command_ids_helper_header += '#include <stdint.h>\n'
+        command_ids_helper_header += '#include <string.h>\n\n'
+        command_ids_helper_header += self.GenerateCommandIdsHeader()
+        return command_ids_helper_header
+    #
+    # Command id header: a dense id for every command, and a hash table from command names to ids that is laid out here
+    # rather than at run time. Layers use it to find their intercepts with one hash and one strcmp, whatever their number.
+    def GenerateCommandIdsHeader(self):
+        # The loader-layer interface entry point is not in vk.xml, but layers return it from GetInstanceProcAddr
+        names = sorted(set(self.command_names + ['vk_layerGetPhysicalDeviceProcAddr']))
+        table_size = 1
+        while table_size < 4 * len(names):
+            table_size *= 2
+        # Try a few seeds and keep the one with the shortest worst case
+        seed = 0
+        slots, max_probes = self.LayoutCommandHashTable(names, table_size, seed)
+        for candidate in range(1, 256):
+            if max_probes <= 2:
+                break
+            candidate_slots, candidate_probes = self.LayoutCommandHashTable(names, table_size, candidate)
+            if candidate_probes < max_probes:
+                seed, slots, max_probes = candidate, candidate_slots, candidate_probes
+
+        command_ids_header = '// Dense ids for every Vulkan command, in name order\n'
+        command_ids_header += 'typedef enum VkCommandId {\n'
+        for id, name in enumerate(names):
+            command_ids_header += '    kVkCommand%s = %d,\n' % (name[2:].lstrip('_')[0].upper() + name[2:].lstrip('_')[1:], id)
+        command_ids_header += '    kVkCommandIdCount = %d,\n' % len(names)
+        command_ids_header += '    kVkCommandIdInvalid = kVkCommandIdCount,\n'
+        command_ids_header += '} VkCommandId;\n\n'
+
+        command_ids_header += 'static const char *const vk_command_names[kVkCommandIdCount] = {\n'
+        for name in names:
+            command_ids_header += '    "%s",\n' % name
+        command_ids_header += '};\n\n'
+
+        command_ids_header += '// Open addressed table of command id + 1, indexed by HashVkCommandName() and probed linearly.\n'
+        command_ids_header += '// No name takes more than %d probes; names that are not commands stop at the first empty slot.\n' % max_probes
+        command_ids_header += 'static const uint16_t vk_command_hash_table[%d] = {\n' % table_size
+        for i in range(0, table_size, 16):
+            command_ids_header += '    ' + ', '.join('%d' % slot for slot in slots[i:i + 16]) + ',\n'
+        command_ids_header += '};\n\n'
+
+        command_ids_header += 'static inline uint32_t HashVkCommandName(const char *name) {\n'
+        command_ids_header += '    uint32_t hash = 2166136261u ^ %du;\n' % seed
+        command_ids_header += '    for (; *name; name++) hash = (hash ^ static_cast<uint8_t>(*name)) * 16777619u;\n'
+        command_ids_header += '    return hash;\n'
+        command_ids_header += '}\n\n'
+
+        command_ids_header += '// Returns the id of a command name, or kVkCommandIdInvalid if it does not name a command\n'
+        command_ids_header += 'static inline VkCommandId GetVkCommandId(const char *name) {\n'
+        command_ids_header += '    if (!name) return kVkCommandIdInvalid;\n'
+        command_ids_header += '    for (uint32_t slot = HashVkCommandName(name) & %du;; slot = (slot + 1) & %du) {\n' % (table_size - 1, table_size - 1)
+        command_ids_header += '        uint16_t entry = vk_command_hash_table[slot];\n'
+        command_ids_header += '        if (!entry) return kVkCommandIdInvalid;\n'
+        command_ids_header += '        if (!strcmp(vk_command_names[entry - 1], name)) return static_cast<VkCommandId>(entry - 1);\n'
+        command_ids_header += '    }\n'
+        command_ids_header += '}\n\n'
+
+        command_ids_header += '// Finds the entries of a layer\'s intercept array by command name in constant time. Entry is any struct with a\n'
+        command_ids_header += '// "const char *name" member; the array must outlive the table. Each name may appear once.\n'
+        command_ids_header += 'template <typename Entry>\n'
+        command_ids_header += 'class VkCommandTable {\n'
+        command_ids_header += '   public:\n'
+        command_ids_header += '    template <size_t N>\n'
+        command_ids_header += '    explicit VkCommandTable(const Entry (&entries)[N]) : entries_(entries) {\n'
+        command_ids_header += '        static_assert(N < UINT16_MAX, "Too many entries for a VkCommandTable");\n'
+        command_ids_header += '        memset(index_, 0, sizeof(index_));\n'
+        command_ids_header += '        for (size_t i = 0; i < N; i++) {\n'
+        command_ids_header += '            VkCommandId id = GetVkCommandId(entries[i].name);\n'
+        command_ids_header += '            assert(id != kVkCommandIdInvalid && !index_[id]);\n'
+        command_ids_header += '            if (id != kVkCommandIdInvalid) index_[id] = static_cast<uint16_t>(i + 1);\n'
+        command_ids_header += '        }\n'
+        command_ids_header += '    }\n\n'
+        command_ids_header += '    // Returns the entry for name, or nullptr if the array has none\n'
+        command_ids_header += '    const Entry *Find(const char *name) const {\n'
+        command_ids_header += '        VkCommandId id = GetVkCommandId(name);\n'
+        command_ids_header += '        if (id == kVkCommandIdInvalid || !index_[id]) return nullptr;\n'
+        command_ids_header += '        return &entries_[index_[id] - 1];\n'
+        command_ids_header += '    }\n\n'
+        command_ids_header += '   private:\n'
+        command_ids_header += '    const Entry *entries_;\n'
+        command_ids_header += '    uint16_t index_[kVkCommandIdCount];\n'
+        command_ids_header += '};\n\n'
+
+        command_ids_header += 'template <typename Entry, size_t N>\n'
+        command_ids_header += 'VkCommandTable<Entry> MakeVkCommandTable(const Entry (&entries)[N]) {\n'
+        command_ids_header += '    return VkCommandTable<Entry>(entries);\n'
+        command_ids_header += '}\n'
+        return command_ids_header
+    #
     # Determine if a structure needs a safe_struct helper function
     # That is, it has an sType or one of its members is a pointer
     def NeedSafeStruct(self, structure):
@@ -771,6 +896,8 @@ class HelperFileOutputGenerator(OutputGenerator):
             return self.GenerateSafeStructHelperSource()
         elif self.helper_file_type == 'object_types_header':
             return self.GenerateObjectTypesHelperHeader()
+        elif self.helper_file_type == 'command_ids_header':
+            return self.GenerateCommandIdsHelperHeader()
         else:
             return 'Bad Helper File Generator Option %s' % self.helper_file_type
 
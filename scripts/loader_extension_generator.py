@@ -149,6 +149,7 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
 
         elif self.genOpts.filename == 'vk_loader_extensions.c':
             preamble += '#define _GNU_SOURCE\n'
+            preamble += '#include <stddef.h>\n'
             preamble += '#include <stdio.h>\n'
             preamble += '#include <stdlib.h>\n'
             preamble += '#include <string.h>\n'
@@ -404,6 +405,9 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
         protos += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,\n'
         protos += '                                                                  bool *found_name);\n'
         protos += '\n'
+        protos += '// Core command trampoline lookup function, for all but the global commands\n'
+        protos += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_core_trampoline(const char *name);\n'
+        protos += '\n'
         protos += 'VKAPI_ATTR bool VKAPI_CALL loader_icd_init_entries(struct loader_icd_term *icd_term, VkInstance inst,\n'
         protos += '                                                   const PFN_vkGetInstanceProcAddr fp_gipa);\n'
         protos += '\n'
@@ -755,74 +759,115 @@ class LoaderExtensionOutputGenerator(OutputGenerator):
 
     #
     # Create a lookup table function from the appropriate list of entrypoints and
-    # return it as a string
+    # return it as a string.  Each lookup is a binary search of a table of the command
+    # names, less their 'vk' prefix, sorted the way strcmp orders them.
     def OutputLoaderLookupFunc(self):
-        commands = []
         tables = ''
-        cur_type = ''
-        cur_extension_name = ''
-
-        for x in range(0, 2):
-            if x == 0:
-                cur_type = 'device'
+        tables += '// A command name, less its "vk" prefix, and where to find the command\n'
+        tables += 'struct loader_entrypoint_table_entry {\n'
+        tables += '    const char *name;\n'
+        tables += '    size_t offset;             // Offset of the dispatch table member\n'
+        tables += '    PFN_vkVoidFunction entry;  // The trampoline\n'
+        tables += '};\n'
+        tables += '\n'
+        tables += '// Binary search of a table sorted by name\n'
+        tables += 'static const struct loader_entrypoint_table_entry *loader_find_entrypoint(const struct loader_entrypoint_table_entry *table,\n'
+        tables += '                                                                     size_t count, const char *name) {\n'
+        tables += '    size_t low = 0, high = count;\n'
+        tables += '    while (low < high) {\n'
+        tables += '        size_t mid = low + (high - low) / 2;\n'
+        tables += '        int cmp = strcmp(name, table[mid].name);\n'
+        tables += '        if (cmp == 0) return &table[mid];\n'
+        tables += '        if (cmp < 0) {\n'
+        tables += '            high = mid;\n'
+        tables += '        } else {\n'
+        tables += '            low = mid + 1;\n'
+        tables += '        }\n'
+        tables += '    }\n'
+        tables += '    return NULL;\n'
+        tables += '}\n'
+        tables += '\n'
+
+        global_commands = ['CreateInstance', 'EnumerateInstanceExtensionProperties', 'EnumerateInstanceLayerProperties']
+
+        for cur_type in ['device', 'instance']:
+            entries = []
+            for cur_cmd in self.core_commands + self.ext_commands:
+                is_inst_handle_type = cur_cmd.ext_type == 'instance' or cur_cmd.handle_type == 'VkInstance' or cur_cmd.handle_type == 'VkPhysicalDevice'
+                if ((cur_type == 'instance' and is_inst_handle_type) or (cur_type == 'device' and not is_inst_handle_type)):
+                    # Remove 'vk' from proto name
+                    base_name = cur_cmd.name[2:]
+                    if base_name in global_commands or base_name == 'CreateDevice':
+                        continue
+                    entries.append((base_name, cur_cmd.protect))
 
-                tables += '// Device command lookup function\n'
-                tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {\n'
-                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') return NULL;\n'
-                tables += '\n'
-                tables += '    name += 2;\n'
+            if cur_type == 'device':
+                table_type = 'VkLayerDispatchTable'
             else:
-                cur_type = 'instance'
-
-                tables += '// Instance command lookup function\n'
-                tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,\n'
-                tables += '                                                                 bool *found_name) {\n'
-                tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') {\n'
-                tables += '        *found_name = false;\n'
-                tables += '        return NULL;\n'
-                tables += '    }\n'
-                tables += '\n'
-                tables += '    *found_name = true;\n'
-                tables += '    name += 2;\n'
-
-            for y in range(0, 2):
-                if y == 0:
-                    commands = self.core_commands
-                else:
-                    commands = self.ext_commands
-
-                for cur_cmd in commands:
-                    is_inst_handle_type = cur_cmd.ext_type == 'instance' or cur_cmd.handle_type == 'VkInstance' or cur_cmd.handle_type == 'VkPhysicalDevice'
-                    if ((cur_type == 'instance' and is_inst_handle_type) or (cur_type == 'device' and not is_inst_handle_type)):
-
-                        if cur_cmd.ext_name != cur_extension_name:
-                            if 'VK_VERSION_' in cur_cmd.ext_name:
-                                tables += '\n    // ---- Core %s commands\n' % cur_cmd.ext_name[11:]
-                            else:
-                                tables += '\n    // ---- %s extension commands\n' % cur_cmd.ext_name
-                            cur_extension_name = cur_cmd.ext_name
-
-                        # Remove 'vk' from proto name
-                        base_name = cur_cmd.name[2:]
-
-                        if (base_name == 'CreateInstance' or base_name == 'CreateDevice' or
-                            base_name == 'EnumerateInstanceExtensionProperties' or
-                            base_name == 'EnumerateInstanceLayerProperties'):
-                            continue
-
-                        if cur_cmd.protect is not None:
-                            tables += '#ifdef %s\n' % cur_cmd.protect
-
-                        tables += '    if (!strcmp(name, "%s")) return (void *)table->%s;\n' % (base_name, base_name)
-
-                        if cur_cmd.protect is not None:
-                            tables += '#endif // %s\n' % cur_cmd.protect
-
+                table_type = 'VkLayerInstanceDispatchTable'
+            tables += 'static const struct loader_entrypoint_table_entry %s_dispatch_table_entries[] = {\n' % cur_type
+            for base_name, protect in sorted(entries):
+                if protect is not None:
+                    tables += '#ifdef %s\n' % protect
+                tables += '    {"%s", offsetof(%s, %s), NULL},\n' % (base_name, table_type, base_name)
+                if protect is not None:
+                    tables += '#endif // %s\n' % protect
+            tables += '};\n'
             tables += '\n'
-            if x == 1:
-                tables += '    *found_name = false;\n'
-            tables += '    return NULL;\n'
-            tables += '}\n\n'
+
+        tables += '// Device command lookup function\n'
+        tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_device_dispatch_table(const VkLayerDispatchTable *table, const char *name) {\n'
+        tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') return NULL;\n'
+        tables += '\n'
+        tables += '    const struct loader_entrypoint_table_entry *entry = loader_find_entrypoint(\n'
+        tables += '        device_dispatch_table_entries, sizeof(device_dispatch_table_entries) / sizeof(device_dispatch_table_entries[0]), name + 2);\n'
+        tables += '    if (NULL == entry) return NULL;\n'
+        tables += '    return *(void *const *)((const char *)table + entry->offset);\n'
+        tables += '}\n'
+        tables += '\n'
+
+        tables += '// Instance command lookup function\n'
+        tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_instance_dispatch_table(const VkLayerInstanceDispatchTable *table, const char *name,\n'
+        tables += '                                                                 bool *found_name) {\n'
+        tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') {\n'
+        tables += '        *found_name = false;\n'
+        tables += '        return NULL;\n'
+        tables += '    }\n'
+        tables += '\n'
+        tables += '    const struct loader_entrypoint_table_entry *entry = loader_find_entrypoint(\n'
+        tables += '        instance_dispatch_table_entries, sizeof(instance_dispatch_table_entries) / sizeof(instance_dispatch_table_entries[0]), name + 2);\n'
+        tables += '    *found_name = NULL != entry;\n'
+        tables += '    if (NULL == entry) return NULL;\n'
+        tables += '    return *(void *const *)((const char *)table + entry->offset);\n'
+        tables += '}\n'
+        tables += '\n'
+
+        # The core trampolines, other than the global commands, which vkGetInstanceProcAddr
+        # handles before it gets here
+        entries = []
+        for cur_cmd in self.core_commands:
+            base_name = cur_cmd.name[2:]
+            if base_name not in global_commands:
+                entries.append((base_name, cur_cmd.protect))
+        tables += 'static const struct loader_entrypoint_table_entry core_trampoline_entries[] = {\n'
+        for base_name, protect in sorted(entries):
+            if protect is not None:
+                tables += '#ifdef %s\n' % protect
+            tables += '    {"%s", 0, (PFN_vkVoidFunction)vk%s},\n' % (base_name, base_name)
+            if protect is not None:
+                tables += '#endif // %s\n' % protect
+        tables += '};\n'
+        tables += '\n'
+        tables += '// Core command trampoline lookup function\n'
+        tables += 'VKAPI_ATTR void* VKAPI_CALL loader_lookup_core_trampoline(const char *name) {\n'
+        tables += '    if (!name || name[0] != \'v\' || name[1] != \'k\') return NULL;\n'
+        tables += '\n'
+        tables += '    const struct loader_entrypoint_table_entry *entry = loader_find_entrypoint(\n'
+        tables += '        core_trampoline_entries, sizeof(core_trampoline_entries) / sizeof(core_trampoline_entries[0]), name + 2);\n'
+        tables += '    if (NULL == entry) return NULL;\n'
+        tables += '    return (void *)entry->entry;\n'
+        tables += '}\n'
+        tables += '\n'
         return tables
 
     #
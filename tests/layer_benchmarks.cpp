@@ -0,0 +1,981 @@
+/*
+ * Copyright (c) 2017 The Khronos Group Inc.
+ * Copyright (c) 2017 Valve Corporation
+ * Copyright (c) 2017 LunarG, Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Measures what the validation layers add to each Vulkan call. Every workload is run through the loader with no layers,
+// with each layer on its own, and with VK_LAYER_LUNARG_standard_validation, and the cost per call is reported.
+//
+//   vk_layer_benchmarks [--json <file>] [--scale <factor>] [--layers <name>] [--workload <name>]
+//
+// By default the benchmark runs against the null driver and the layers of this build; set VK_ICD_FILENAMES and
+// VK_LAYER_PATH to measure others. Allocations per call count operator new, which is how the layers allocate, and the
+// allocation callbacks the benchmark hands to Vulkan. Validation messages are counted too: a workload that triggers any
+// is measuring error reporting rather than validation, and should be fixed. Point VK_LAYER_SETTINGS_PATH at a settings
+// file to measure non-default layer settings, such as lunarg_core_validation.noncoherent_guard_pages.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.h>
+
+static std::atomic<uint64_t> allocation_count(0);
+
+void *operator new(size_t size) {
+    ++allocation_count;
+    void *memory = malloc(size ? size : 1);
+    if (memory == nullptr) throw std::bad_alloc();
+    return memory;
+}
+
+void *operator new[](size_t size) { return operator new(size); }
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+    ++allocation_count;
+    return malloc(size ? size : 1);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept { return operator new(size, tag); }
+
+void operator delete(void *memory) noexcept { free(memory); }
+
+void operator delete[](void *memory) noexcept { free(memory); }
+
+void operator delete(void *memory, const std::nothrow_t &) noexcept { free(memory); }
+
+void operator delete[](void *memory, const std::nothrow_t &) noexcept { free(memory); }
+
+namespace {
+
+// Allocation callbacks that count, for the allocations the loader and drivers make through them
+VKAPI_ATTR void *VKAPI_CALL CountingAlloc(void *pUserData, size_t size, size_t alignment, VkSystemAllocationScope scope) {
+    ++allocation_count;
+    // Keep the block malloc returned and the size in front of the aligned block, so free and realloc can find them
+    size_t const header = sizeof(char *) + sizeof(size_t);
+    char *memory = static_cast<char *>(malloc(size + header + alignment));
+    if (memory == nullptr) return nullptr;
+    char *aligned = memory + header;
+    aligned += (alignment - reinterpret_cast<uintptr_t>(aligned) % alignment) % alignment;
+    memcpy(aligned - sizeof(size_t), &size, sizeof(size_t));
+    memcpy(aligned - header, &memory, sizeof(char *));
+    return aligned;
+}
+
+VKAPI_ATTR void VKAPI_CALL CountingFree(void *pUserData, void *pMemory) {
+    if (pMemory == nullptr) return;
+    char *memory = nullptr;
+    memcpy(&memory, static_cast<char *>(pMemory) - sizeof(char *) - sizeof(size_t), sizeof(char *));
+    free(memory);
+}
+
+VKAPI_ATTR void *VKAPI_CALL CountingRealloc(void *pUserData, void *pOriginal, size_t size, size_t alignment,
+                                            VkSystemAllocationScope scope) {
+    if (pOriginal == nullptr) return CountingAlloc(pUserData, size, alignment, scope);
+    if (size == 0) {
+        CountingFree(pUserData, pOriginal);
+        return nullptr;
+    }
+    void *memory = CountingAlloc(pUserData, size, alignment, scope);
+    if (memory == nullptr) return nullptr;
+    size_t original_size;
+    memcpy(&original_size, static_cast<char *>(pOriginal) - sizeof(size_t), sizeof(size_t));
+    memcpy(memory, pOriginal, original_size < size ? original_size : size);
+    CountingFree(pUserData, pOriginal);
+    return memory;
+}
+
+VkAllocationCallbacks const counting_allocator = {nullptr, CountingAlloc, CountingRealloc, CountingFree, nullptr, nullptr};
+VkAllocationCallbacks const *const allocator = &counting_allocator;
+
+std::atomic<uint32_t> validation_messages(0);
+
+VKAPI_ATTR VkBool32 VKAPI_CALL CountMessage(VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object,
+                                            size_t location, int32_t messageCode, char const *pLayerPrefix, char const *pMessage,
+                                            void *pUserData) {
+    if (validation_messages++ == 0) {
+        fprintf(stderr, "First validation message: %s: %s\n", pLayerPrefix, pMessage);
+    }
+    return VK_FALSE;
+}
+
+// A vertex shader that does nothing:
+//   OpCapability Shader
+//   OpMemoryModel Logical GLSL450
+//   OpEntryPoint Vertex %1 "main"
+//   %2 = OpTypeVoid
+//   %3 = OpTypeFunction %2
+//   %1 = OpFunction %2 None %3
+//   %4 = OpLabel
+//   OpReturn
+//   OpFunctionEnd
+uint32_t const empty_vertex_shader[] = {0x07230203, 0x00010000, 0x00000000, 5,          0,          0x00020011, 1,
+                                        0x0003000E, 0,          1,          0x0005000F, 0,          1,          0x6E69616D,
+                                        0,          0x00020013, 2,          0x00030021, 3,          2,          0x00050036,
+                                        2,          1,          0,          3,          0x000200F8, 4,          0x000100FD,
+                                        0x00010038};
+
+struct LayerConfiguration {
+    char const *name;
+    std::vector<char const *> layers;
+};
+
+// Objects the workloads share, created outside of the measurements
+struct Context {
+    VkInstance instance = VK_NULL_HANDLE;
+    VkDebugReportCallbackEXT callback = VK_NULL_HANDLE;
+    VkPhysicalDevice physical_device = VK_NULL_HANDLE;
+    VkDevice device = VK_NULL_HANDLE;
+    std::vector<VkQueue> queues;
+    uint32_t host_memory_type = 0;
+    // Host visible memory that is not coherent, which the validation layers shadow while it is mapped
+    uint32_t noncoherent_memory_type = 0;
+    VkCommandPool command_pool = VK_NULL_HANDLE;
+};
+
+struct Measurement {
+    uint64_t calls = 0;
+    double seconds = 0.0;
+    uint64_t allocations = 0;
+};
+
+// Times body, which makes calls Vulkan calls, and counts the allocations made meanwhile
+template <typename Body>
+Measurement Measure(uint64_t calls, Body body) {
+    Measurement measurement;
+    measurement.calls = calls;
+    uint64_t const allocations_before = allocation_count;
+    auto const start = std::chrono::steady_clock::now();
+    body();
+    auto const end = std::chrono::steady_clock::now();
+    measurement.allocations = allocation_count - allocations_before;
+    measurement.seconds = std::chrono::duration<double>(end - start).count();
+    return measurement;
+}
+
+#define CHECK(call)                                                                               \
+    do {                                                                                          \
+        VkResult check_result = (call);                                                           \
+        if (check_result != VK_SUCCESS) {                                                         \
+            fprintf(stderr, "%s:%d: %s returned %d\n", __FILE__, __LINE__, #call, check_result); \
+            exit(1);                                                                              \
+        }                                                                                         \
+    } while (0)
+
+bool HasExtension(std::vector<VkExtensionProperties> const &extensions, char const *name) {
+    for (auto const &extension : extensions) {
+        if (strcmp(extension.extensionName, name) == 0) return true;
+    }
+    return false;
+}
+
+bool CreateContext(LayerConfiguration const &configuration, Context *context) {
+    uint32_t count = 0;
+    CHECK(vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr));
+    std::vector<VkExtensionProperties> instance_extensions(count);
+    CHECK(vkEnumerateInstanceExtensionProperties(nullptr, &count, instance_extensions.data()));
+    std::vector<char const *> enabled_instance_extensions = {VK_EXT_DEBUG_REPORT_EXTENSION_NAME};
+    if (HasExtension(instance_extensions, VK_KHR_SURFACE_EXTENSION_NAME)) {
+        enabled_instance_extensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+    }
+
+    VkApplicationInfo application_info = {VK_STRUCTURE_TYPE_APPLICATION_INFO};
+    application_info.pApplicationName = "vk_layer_benchmarks";
+    application_info.apiVersion = VK_MAKE_VERSION(1, 0, 0);
+    VkInstanceCreateInfo instance_info = {VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+    instance_info.pApplicationInfo = &application_info;
+    instance_info.enabledLayerCount = static_cast<uint32_t>(configuration.layers.size());
+    instance_info.ppEnabledLayerNames = configuration.layers.data();
+    instance_info.enabledExtensionCount = static_cast<uint32_t>(enabled_instance_extensions.size());
+    instance_info.ppEnabledExtensionNames = enabled_instance_extensions.data();
+    VkResult result = vkCreateInstance(&instance_info, allocator, &context->instance);
+    if (result != VK_SUCCESS) {
+        fprintf(stderr, "Skipping %s: vkCreateInstance returned %d\n", configuration.name, result);
+        return false;
+    }
+
+    VkDebugReportCallbackCreateInfoEXT callback_info = {VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT};
+    callback_info.flags = VK_DEBUG_REPORT_ERROR_BIT_EXT | VK_DEBUG_REPORT_WARNING_BIT_EXT |
+                          VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT;
+    callback_info.pfnCallback = CountMessage;
+    auto create_callback = reinterpret_cast<PFN_vkCreateDebugReportCallbackEXT>(
+        vkGetInstanceProcAddr(context->instance, "vkCreateDebugReportCallbackEXT"));
+    CHECK(create_callback(context->instance, &callback_info, allocator, &context->callback));
+
+    count = 1;
+    result = vkEnumeratePhysicalDevices(context->instance, &count, &context->physical_device);
+    if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || count == 0) {
+        fprintf(stderr, "Skipping %s: there is no physical device\n", configuration.name);
+        return false;
+    }
+
+    vkGetPhysicalDeviceQueueFamilyProperties(context->physical_device, &count, nullptr);
+    std::vector<VkQueueFamilyProperties> families(count);
+    vkGetPhysicalDeviceQueueFamilyProperties(context->physical_device, &count, families.data());
+    if (count == 0 || !(families[0].queueFlags & VK_QUEUE_GRAPHICS_BIT)) {
+        fprintf(stderr, "Skipping %s: the first queue family does not support graphics\n", configuration.name);
+        return false;
+    }
+    uint32_t const queue_count = families[0].queueCount < 4 ? families[0].queueCount : 4;
+    std::vector<float> priorities(queue_count, 1.0f);
+    VkDeviceQueueCreateInfo queue_info = {VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
+    queue_info.queueFamilyIndex = 0;
+    queue_info.queueCount = queue_count;
+    queue_info.pQueuePriorities = priorities.data();
+
+    CHECK(vkEnumerateDeviceExtensionProperties(context->physical_device, nullptr, &count, nullptr));
+    std::vector<VkExtensionProperties> device_extensions(count);
+    CHECK(vkEnumerateDeviceExtensionProperties(context->physical_device, nullptr, &count, device_extensions.data()));
+    std::vector<char const *> enabled_device_extensions;
+    if (HasExtension(device_extensions, VK_KHR_SWAPCHAIN_EXTENSION_NAME)) {
+        enabled_device_extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+    }
+
+    VkDeviceCreateInfo device_info = {VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO};
+    device_info.queueCreateInfoCount = 1;
+    device_info.pQueueCreateInfos = &queue_info;
+    device_info.enabledLayerCount = static_cast<uint32_t>(configuration.layers.size());
+    device_info.ppEnabledLayerNames = configuration.layers.data();
+    device_info.enabledExtensionCount = static_cast<uint32_t>(enabled_device_extensions.size());
+    device_info.ppEnabledExtensionNames = enabled_device_extensions.data();
+    CHECK(vkCreateDevice(context->physical_device, &device_info, allocator, &context->device));
+
+    context->queues.resize(queue_count);
+    for (uint32_t i = 0; i < queue_count; i++) {
+        vkGetDeviceQueue(context->device, 0, i, &context->queues[i]);
+    }
+
+    VkPhysicalDeviceMemoryProperties memory_properties;
+    vkGetPhysicalDeviceMemoryProperties(context->physical_device, &memory_properties);
+    for (uint32_t i = 0; i < memory_properties.memoryTypeCount; i++) {
+        VkMemoryPropertyFlags const host = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+        if ((memory_properties.memoryTypes[i].propertyFlags & host) == host) {
+            context->host_memory_type = i;
+            break;
+        }
+    }
+    context->noncoherent_memory_type = context->host_memory_type;
+    for (uint32_t i = 0; i < memory_properties.memoryTypeCount; i++) {
+        if ((memory_properties.memoryTypes[i].propertyFlags & (VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+                                                               VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) ==
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+            context->noncoherent_memory_type = i;
+            break;
+        }
+    }
+
+    VkCommandPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+    pool_info.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    pool_info.queueFamilyIndex = 0;
+    CHECK(vkCreateCommandPool(context->device, &pool_info, allocator, &context->command_pool));
+    return true;
+}
+
+void DestroyContext(Context *context) {
+    if (context->device != VK_NULL_HANDLE) {
+        vkDestroyCommandPool(context->device, context->command_pool, allocator);
+        vkDestroyDevice(context->device, allocator);
+    }
+    if (context->callback != VK_NULL_HANDLE) {
+        auto destroy_callback = reinterpret_cast<PFN_vkDestroyDebugReportCallbackEXT>(
+            vkGetInstanceProcAddr(context->instance, "vkDestroyDebugReportCallbackEXT"));
+        destroy_callback(context->instance, context->callback, allocator);
+    }
+    if (context->instance != VK_NULL_HANDLE) {
+        vkDestroyInstance(context->instance, allocator);
+    }
+    *context = Context();
+}
+
+VkBuffer CreateBoundBuffer(Context const &context, VkDeviceSize size, VkBufferUsageFlags usage, VkDeviceMemory *memory) {
+    VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    buffer_info.size = size;
+    buffer_info.usage = usage;
+    VkBuffer buffer;
+    CHECK(vkCreateBuffer(context.device, &buffer_info, allocator, &buffer));
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(context.device, buffer, &requirements);
+    VkMemoryAllocateInfo allocate_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    allocate_info.allocationSize = requirements.size;
+    allocate_info.memoryTypeIndex = context.host_memory_type;
+    CHECK(vkAllocateMemory(context.device, &allocate_info, allocator, memory));
+    CHECK(vkBindBufferMemory(context.device, buffer, *memory, 0));
+    return buffer;
+}
+
+VkCommandBuffer AllocateCommandBuffer(Context const &context) {
+    VkCommandBufferAllocateInfo allocate_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+    allocate_info.commandPool = context.command_pool;
+    allocate_info.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    allocate_info.commandBufferCount = 1;
+    VkCommandBuffer command_buffer;
+    CHECK(vkAllocateCommandBuffers(context.device, &allocate_info, &command_buffer));
+    return command_buffer;
+}
+
+// Records one command buffer of draws in a render pass, then submits it and waits for it
+Measurement DrawWorkload(Context const &context, uint32_t scale) {
+    uint32_t const draw_count = 100000 * scale;
+    VkDevice const device = context.device;
+
+    VkSubpassDescription subpass = {};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    VkRenderPassCreateInfo render_pass_info = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO};
+    render_pass_info.subpassCount = 1;
+    render_pass_info.pSubpasses = &subpass;
+    VkRenderPass render_pass;
+    CHECK(vkCreateRenderPass(device, &render_pass_info, allocator, &render_pass));
+
+    VkFramebufferCreateInfo framebuffer_info = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO};
+    framebuffer_info.renderPass = render_pass;
+    framebuffer_info.width = 256;
+    framebuffer_info.height = 256;
+    framebuffer_info.layers = 1;
+    VkFramebuffer framebuffer;
+    CHECK(vkCreateFramebuffer(device, &framebuffer_info, allocator, &framebuffer));
+
+    VkShaderModuleCreateInfo shader_info = {VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+    shader_info.codeSize = sizeof(empty_vertex_shader);
+    shader_info.pCode = empty_vertex_shader;
+    VkShaderModule shader;
+    CHECK(vkCreateShaderModule(device, &shader_info, allocator, &shader));
+
+    VkPipelineLayoutCreateInfo layout_info = {VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+    VkPipelineLayout pipeline_layout;
+    CHECK(vkCreatePipelineLayout(device, &layout_info, allocator, &pipeline_layout));
+
+    VkPipelineShaderStageCreateInfo stage = {VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO};
+    stage.stage = VK_SHADER_STAGE_VERTEX_BIT;
+    stage.module = shader;
+    stage.pName = "main";
+    VkPipelineVertexInputStateCreateInfo vertex_input = {VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO};
+    VkPipelineInputAssemblyStateCreateInfo input_assembly = {VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO};
+    input_assembly.topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+    VkViewport viewport = {0.0f, 0.0f, 256.0f, 256.0f, 0.0f, 1.0f};
+    VkRect2D scissor = {{0, 0}, {256, 256}};
+    VkPipelineViewportStateCreateInfo viewport_state = {VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO};
+    viewport_state.viewportCount = 1;
+    viewport_state.pViewports = &viewport;
+    viewport_state.scissorCount = 1;
+    viewport_state.pScissors = &scissor;
+    VkPipelineRasterizationStateCreateInfo rasterization = {VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO};
+    rasterization.polygonMode = VK_POLYGON_MODE_FILL;
+    rasterization.cullMode = VK_CULL_MODE_NONE;
+    rasterization.lineWidth = 1.0f;
+    VkPipelineMultisampleStateCreateInfo multisample = {VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO};
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+    VkPipelineColorBlendStateCreateInfo color_blend = {VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO};
+    VkGraphicsPipelineCreateInfo pipeline_info = {VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+    pipeline_info.stageCount = 1;
+    pipeline_info.pStages = &stage;
+    pipeline_info.pVertexInputState = &vertex_input;
+    pipeline_info.pInputAssemblyState = &input_assembly;
+    pipeline_info.pViewportState = &viewport_state;
+    pipeline_info.pRasterizationState = &rasterization;
+    pipeline_info.pMultisampleState = &multisample;
+    pipeline_info.pColorBlendState = &color_blend;
+    pipeline_info.layout = pipeline_layout;
+    pipeline_info.renderPass = render_pass;
+    VkPipeline pipeline;
+    CHECK(vkCreateGraphicsPipelines(device, VK_NULL_HANDLE, 1, &pipeline_info, allocator, &pipeline));
+
+    VkCommandBuffer command_buffer = AllocateCommandBuffer(context);
+    VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+    VkFence fence;
+    CHECK(vkCreateFence(device, &fence_info, allocator, &fence));
+
+    Measurement measurement = Measure(draw_count, [&]() {
+        VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+        begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+        CHECK(vkBeginCommandBuffer(command_buffer, &begin_info));
+        VkRenderPassBeginInfo pass_begin = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO};
+        pass_begin.renderPass = render_pass;
+        pass_begin.framebuffer = framebuffer;
+        pass_begin.renderArea = scissor;
+        vkCmdBeginRenderPass(command_buffer, &pass_begin, VK_SUBPASS_CONTENTS_INLINE);
+        vkCmdBindPipeline(command_buffer, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+        for (uint32_t i = 0; i < draw_count; i++) {
+            vkCmdDraw(command_buffer, 3, 1, 0, 0);
+        }
+        vkCmdEndRenderPass(command_buffer);
+        CHECK(vkEndCommandBuffer(command_buffer));
+        VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+        submit_info.commandBufferCount = 1;
+        submit_info.pCommandBuffers = &command_buffer;
+        CHECK(vkQueueSubmit(context.queues[0], 1, &submit_info, fence));
+        CHECK(vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX));
+    });
+
+    vkDestroyFence(device, fence, allocator);
+    vkFreeCommandBuffers(device, context.command_pool, 1, &command_buffer);
+    vkDestroyPipeline(device, pipeline, allocator);
+    vkDestroyPipelineLayout(device, pipeline_layout, allocator);
+    vkDestroyShaderModule(device, shader, allocator);
+    vkDestroyFramebuffer(device, framebuffer, allocator);
+    vkDestroyRenderPass(device, render_pass, allocator);
+    return measurement;
+}
+
+// Rewrites the uniform buffer descriptors of a set of descriptor sets, one vkUpdateDescriptorSets call at a time
+Measurement DescriptorUpdateWorkload(Context const &context, uint32_t scale) {
+    uint32_t const set_count = 256;
+    uint32_t const update_count = 100000 * scale;
+    VkDevice const device = context.device;
+
+    VkDescriptorSetLayoutBinding binding = {};
+    binding.binding = 0;
+    binding.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+    binding.descriptorCount = 1;
+    binding.stageFlags = VK_SHADER_STAGE_VERTEX_BIT;
+    VkDescriptorSetLayoutCreateInfo set_layout_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+    set_layout_info.bindingCount = 1;
+    set_layout_info.pBindings = &binding;
+    VkDescriptorSetLayout set_layout;
+    CHECK(vkCreateDescriptorSetLayout(device, &set_layout_info, allocator, &set_layout));
+
+    VkDescriptorPoolSize pool_size = {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, set_count};
+    VkDescriptorPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+    pool_info.maxSets = set_count;
+    pool_info.poolSizeCount = 1;
+    pool_info.pPoolSizes = &pool_size;
+    VkDescriptorPool pool;
+    CHECK(vkCreateDescriptorPool(device, &pool_info, allocator, &pool));
+
+    std::vector<VkDescriptorSetLayout> set_layouts(set_count, set_layout);
+    std::vector<VkDescriptorSet> sets(set_count);
+    VkDescriptorSetAllocateInfo allocate_info = {VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+    allocate_info.descriptorPool = pool;
+    allocate_info.descriptorSetCount = set_count;
+    allocate_info.pSetLayouts = set_layouts.data();
+    CHECK(vkAllocateDescriptorSets(device, &allocate_info, sets.data()));
+
+    VkDeviceMemory memory;
+    VkBuffer buffer = CreateBoundBuffer(context, 64 * 1024, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT, &memory);
+
+    Measurement measurement = Measure(update_count, [&]() {
+        for (uint32_t i = 0; i < update_count; i++) {
+            VkDescriptorBufferInfo buffer_info = {buffer, (i % 64) * 256, 256};
+            VkWriteDescriptorSet write = {VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+            write.dstSet = sets[i % set_count];
+            write.dstBinding = 0;
+            write.descriptorCount = 1;
+            write.descriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+            write.pBufferInfo = &buffer_info;
+            vkUpdateDescriptorSets(device, 1, &write, 0, nullptr);
+        }
+    });
+
+    vkDestroyBuffer(device, buffer, allocator);
+    vkFreeMemory(device, memory, allocator);
+    vkDestroyDescriptorPool(device, pool, allocator);
+    vkDestroyDescriptorSetLayout(device, set_layout, allocator);
+    return measurement;
+}
+
+// Creates, binds and destroys buffers, images and image views, as streaming resource managers do
+Measurement ResourceChurnWorkload(Context const &context, uint32_t scale) {
+    uint32_t const iterations = 5000 * scale;
+    uint32_t const calls_per_iteration = 13;
+    VkDevice const device = context.device;
+
+    Measurement measurement = Measure(uint64_t(iterations) * calls_per_iteration, [&]() {
+        for (uint32_t i = 0; i < iterations; i++) {
+            VkBufferCreateInfo buffer_info = {VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+            buffer_info.size = 4096;
+            buffer_info.usage = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            VkBuffer buffer;
+            CHECK(vkCreateBuffer(device, &buffer_info, allocator, &buffer));
+            VkMemoryRequirements requirements;
+            vkGetBufferMemoryRequirements(device, buffer, &requirements);
+            VkMemoryAllocateInfo allocate_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+            allocate_info.allocationSize = requirements.size;
+            allocate_info.memoryTypeIndex = context.host_memory_type;
+            VkDeviceMemory buffer_memory;
+            CHECK(vkAllocateMemory(device, &allocate_info, allocator, &buffer_memory));
+            CHECK(vkBindBufferMemory(device, buffer, buffer_memory, 0));
+
+            VkImageCreateInfo image_info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+            image_info.imageType = VK_IMAGE_TYPE_2D;
+            image_info.format = VK_FORMAT_R8G8B8A8_UNORM;
+            image_info.extent = {64, 64, 1};
+            image_info.mipLevels = 1;
+            image_info.arrayLayers = 1;
+            image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+            image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+            image_info.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT;
+            image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+            VkImage image;
+            CHECK(vkCreateImage(device, &image_info, allocator, &image));
+            vkGetImageMemoryRequirements(device, image, &requirements);
+            allocate_info.allocationSize = requirements.size;
+            VkDeviceMemory image_memory;
+            CHECK(vkAllocateMemory(device, &allocate_info, allocator, &image_memory));
+            CHECK(vkBindImageMemory(device, image, image_memory, 0));
+
+            VkImageViewCreateInfo view_info = {VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+            view_info.image = image;
+            view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+            view_info.format = image_info.format;
+            view_info.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+            VkImageView view;
+            CHECK(vkCreateImageView(device, &view_info, allocator, &view));
+
+            vkDestroyImageView(device, view, allocator);
+            vkDestroyImage(device, image, allocator);
+            vkFreeMemory(device, image_memory, allocator);
+            vkDestroyBuffer(device, buffer, allocator);
+            vkFreeMemory(device, buffer_memory, allocator);
+        }
+    });
+    return measurement;
+}
+
+// Submits small command buffers round robin to every queue, waiting on each submission's fence
+Measurement QueueSubmitWorkload(Context const &context, uint32_t scale) {
+    uint32_t const submit_count = 20000 * scale;
+    uint32_t const calls_per_submit = 3;
+    VkDevice const device = context.device;
+    size_t const queue_count = context.queues.size();
+
+    VkDeviceMemory memory;
+    VkBuffer buffer = CreateBoundBuffer(context, 4096, VK_BUFFER_USAGE_TRANSFER_DST_BIT, &memory);
+    std::vector<VkCommandBuffer> command_buffers(queue_count);
+    std::vector<VkFence> fences(queue_count);
+    for (size_t i = 0; i < queue_count; i++) {
+        command_buffers[i] = AllocateCommandBuffer(context);
+        VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+        CHECK(vkBeginCommandBuffer(command_buffers[i], &begin_info));
+        vkCmdFillBuffer(command_buffers[i], buffer, 0, 4096, static_cast<uint32_t>(i));
+        CHECK(vkEndCommandBuffer(command_buffers[i]));
+        VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+        CHECK(vkCreateFence(device, &fence_info, allocator, &fences[i]));
+    }
+
+    Measurement measurement = Measure(uint64_t(submit_count) * calls_per_submit, [&]() {
+        for (uint32_t i = 0; i < submit_count; i++) {
+            size_t const queue = i % queue_count;
+            VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+            submit_info.commandBufferCount = 1;
+            submit_info.pCommandBuffers = &command_buffers[queue];
+            CHECK(vkQueueSubmit(context.queues[queue], 1, &submit_info, fences[queue]));
+            CHECK(vkWaitForFences(device, 1, &fences[queue], VK_TRUE, UINT64_MAX));
+            CHECK(vkResetFences(device, 1, &fences[queue]));
+        }
+    });
+
+    for (size_t i = 0; i < queue_count; i++) {
+        vkDestroyFence(device, fences[i], allocator);
+    }
+    vkFreeCommandBuffers(device, context.command_pool, static_cast<uint32_t>(queue_count), command_buffers.data());
+    vkDestroyBuffer(device, buffer, allocator);
+    vkFreeMemory(device, memory, allocator);
+    return measurement;
+}
+
+// Resets a large timestamp pool, writes part of it, submits, and reads the written queries back, as GPU profilers do
+Measurement TimestampQueryWorkload(Context const &context, uint32_t scale) {
+    uint32_t const frame_count = 500 * scale;
+    uint32_t const pool_size = 4096;
+    uint32_t const timestamp_count = 256;
+    uint32_t const calls_per_frame = 8 + timestamp_count;
+    VkDevice const device = context.device;
+
+    VkQueryPoolCreateInfo pool_info = {VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO};
+    pool_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    pool_info.queryCount = pool_size;
+    VkQueryPool query_pool;
+    CHECK(vkCreateQueryPool(device, &pool_info, allocator, &query_pool));
+    VkCommandBuffer command_buffer = AllocateCommandBuffer(context);
+    VkFenceCreateInfo fence_info = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+    VkFence fence;
+    CHECK(vkCreateFence(device, &fence_info, allocator, &fence));
+    std::vector<uint64_t> results(timestamp_count);
+
+    Measurement measurement = Measure(uint64_t(frame_count) * calls_per_frame, [&]() {
+        for (uint32_t i = 0; i < frame_count; i++) {
+            VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+            begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            CHECK(vkBeginCommandBuffer(command_buffer, &begin_info));
+            vkCmdResetQueryPool(command_buffer, query_pool, 0, pool_size);
+            for (uint32_t j = 0; j < timestamp_count; j++) {
+                vkCmdWriteTimestamp(command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, query_pool, j);
+            }
+            CHECK(vkEndCommandBuffer(command_buffer));
+            VkSubmitInfo submit_info = {VK_STRUCTURE_TYPE_SUBMIT_INFO};
+            submit_info.commandBufferCount = 1;
+            submit_info.pCommandBuffers = &command_buffer;
+            CHECK(vkQueueSubmit(context.queues[0], 1, &submit_info, fence));
+            CHECK(vkWaitForFences(device, 1, &fence, VK_TRUE, UINT64_MAX));
+            CHECK(vkResetFences(device, 1, &fence));
+            CHECK(vkGetQueryPoolResults(device, query_pool, 0, timestamp_count, results.size() * sizeof(uint64_t), results.data(),
+                                        sizeof(uint64_t), VK_QUERY_RESULT_64_BIT));
+        }
+    });
+
+    vkDestroyFence(device, fence, allocator);
+    vkFreeCommandBuffers(device, context.command_pool, 1, &command_buffer);
+    vkDestroyQueryPool(device, query_pool, allocator);
+    return measurement;
+}
+
+// Records a deferred shading render pass over and over: a G-buffer subpass, a lighting subpass reading the G-buffer as input
+// attachments, and a post-processing subpass reading the lit image
+Measurement RenderPassWorkload(Context const &context, uint32_t scale) {
+    uint32_t const frame_count = 2000 * scale;
+    uint32_t const passes_per_frame = 16;
+    uint32_t const calls_per_frame = 2 + passes_per_frame * 4;
+    uint32_t const attachment_count = 6;
+    VkDevice const device = context.device;
+
+    VkFormat const color_format = VK_FORMAT_R8G8B8A8_UNORM;
+    VkFormat const depth_format = VK_FORMAT_D16_UNORM;
+    VkAttachmentDescription attachments[attachment_count] = {};
+    for (uint32_t i = 0; i < attachment_count; i++) {
+        attachments[i].format = i == 3 ? depth_format : color_format;
+        attachments[i].samples = VK_SAMPLE_COUNT_1_BIT;
+        attachments[i].loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachments[i].storeOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[i].stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        attachments[i].stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        attachments[i].initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        attachments[i].finalLayout = i == 3 ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL : VK_IMAGE_LAYOUT_GENERAL;
+    }
+    attachments[5].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    VkImageLayout const color = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    VkImageLayout const input = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    VkAttachmentReference const gbuffer_outputs[] = {{0, color}, {1, color}, {2, color}};
+    VkAttachmentReference const depth_output = {3, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+    VkAttachmentReference const gbuffer_inputs[] = {{0, input}, {1, input}, {2, input}};
+    VkAttachmentReference const lit_output = {4, color};
+    VkAttachmentReference const lit_input = {4, input};
+    VkAttachmentReference const final_output = {5, color};
+    VkSubpassDescription subpasses[3] = {};
+    for (auto &subpass : subpasses) subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpasses[0].colorAttachmentCount = 3;
+    subpasses[0].pColorAttachments = gbuffer_outputs;
+    subpasses[0].pDepthStencilAttachment = &depth_output;
+    subpasses[1].inputAttachmentCount = 3;
+    subpasses[1].pInputAttachments = gbuffer_inputs;
+    subpasses[1].colorAttachmentCount = 1;
+    subpasses[1].pColorAttachments = &lit_output;
+    subpasses[2].inputAttachmentCount = 1;
+    subpasses[2].pInputAttachments = &lit_input;
+    subpasses[2].colorAttachmentCount = 1;
+    subpasses[2].pColorAttachments = &final_output;
+    VkSubpassDependency dependencies[2] = {};
+    for (uint32_t i = 0; i < 2; i++) {
+        dependencies[i].srcSubpass = i;
+        dependencies[i].dstSubpass = i + 1;
+        dependencies[i].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+        dependencies[i].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+        dependencies[i].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
+        dependencies[i].dstAccessMask = VK_ACCESS_INPUT_ATTACHMENT_READ_BIT;
+        dependencies[i].dependencyFlags = VK_DEPENDENCY_BY_REGION_BIT;
+    }
+    VkRenderPassCreateInfo render_pass_info = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO};
+    render_pass_info.attachmentCount = attachment_count;
+    render_pass_info.pAttachments = attachments;
+    render_pass_info.subpassCount = 3;
+    render_pass_info.pSubpasses = subpasses;
+    render_pass_info.dependencyCount = 2;
+    render_pass_info.pDependencies = dependencies;
+    VkRenderPass render_pass;
+    CHECK(vkCreateRenderPass(device, &render_pass_info, allocator, &render_pass));
+
+    VkImage images[attachment_count];
+    VkDeviceMemory memories[attachment_count];
+    VkImageView views[attachment_count];
+    for (uint32_t i = 0; i < attachment_count; i++) {
+        VkImageCreateInfo image_info = {VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+        image_info.imageType = VK_IMAGE_TYPE_2D;
+        image_info.format = attachments[i].format;
+        image_info.extent = {256, 256, 1};
+        image_info.mipLevels = 1;
+        image_info.arrayLayers = 1;
+        image_info.samples = VK_SAMPLE_COUNT_1_BIT;
+        image_info.tiling = VK_IMAGE_TILING_OPTIMAL;
+        image_info.usage = i == 3 ? VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT
+                                  : VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+        image_info.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        CHECK(vkCreateImage(device, &image_info, allocator, &images[i]));
+        VkMemoryRequirements requirements;
+        vkGetImageMemoryRequirements(device, images[i], &requirements);
+        VkMemoryAllocateInfo allocate_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+        allocate_info.allocationSize = requirements.size;
+        allocate_info.memoryTypeIndex = context.host_memory_type;
+        CHECK(vkAllocateMemory(device, &allocate_info, allocator, &memories[i]));
+        CHECK(vkBindImageMemory(device, images[i], memories[i], 0));
+        VkImageViewCreateInfo view_info = {VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+        view_info.image = images[i];
+        view_info.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        view_info.format = attachments[i].format;
+        view_info.subresourceRange = {i == 3 ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        CHECK(vkCreateImageView(device, &view_info, allocator, &views[i]));
+    }
+    VkFramebufferCreateInfo framebuffer_info = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO};
+    framebuffer_info.renderPass = render_pass;
+    framebuffer_info.attachmentCount = attachment_count;
+    framebuffer_info.pAttachments = views;
+    framebuffer_info.width = 256;
+    framebuffer_info.height = 256;
+    framebuffer_info.layers = 1;
+    VkFramebuffer framebuffer;
+    CHECK(vkCreateFramebuffer(device, &framebuffer_info, allocator, &framebuffer));
+
+    VkCommandBuffer command_buffer = AllocateCommandBuffer(context);
+
+    Measurement measurement = Measure(uint64_t(frame_count) * calls_per_frame, [&]() {
+        for (uint32_t i = 0; i < frame_count; i++) {
+            VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+            begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            CHECK(vkBeginCommandBuffer(command_buffer, &begin_info));
+            for (uint32_t j = 0; j < passes_per_frame; j++) {
+                VkRenderPassBeginInfo pass_begin = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO};
+                pass_begin.renderPass = render_pass;
+                pass_begin.framebuffer = framebuffer;
+                pass_begin.renderArea = {{0, 0}, {256, 256}};
+                vkCmdBeginRenderPass(command_buffer, &pass_begin, VK_SUBPASS_CONTENTS_INLINE);
+                vkCmdNextSubpass(command_buffer, VK_SUBPASS_CONTENTS_INLINE);
+                vkCmdNextSubpass(command_buffer, VK_SUBPASS_CONTENTS_INLINE);
+                vkCmdEndRenderPass(command_buffer);
+            }
+            CHECK(vkEndCommandBuffer(command_buffer));
+        }
+    });
+
+    vkFreeCommandBuffers(device, context.command_pool, 1, &command_buffer);
+    vkDestroyFramebuffer(device, framebuffer, allocator);
+    for (uint32_t i = 0; i < attachment_count; i++) {
+        vkDestroyImageView(device, views[i], allocator);
+        vkDestroyImage(device, images[i], allocator);
+        vkFreeMemory(device, memories[i], allocator);
+    }
+    vkDestroyRenderPass(device, render_pass, allocator);
+    return measurement;
+}
+
+// Writes a few pages of a large mapping of non-coherent memory and flushes it, as streaming uploads do
+Measurement MappedFlushWorkload(Context const &context, uint32_t scale) {
+    uint32_t const flush_count = 100 * scale;
+    size_t const mapping_size = 64 * 1024 * 1024;
+    size_t const write_size = 16 * 1024;
+    VkDevice const device = context.device;
+
+    VkMemoryAllocateInfo allocate_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    allocate_info.allocationSize = mapping_size;
+    allocate_info.memoryTypeIndex = context.noncoherent_memory_type;
+    VkDeviceMemory memory;
+    CHECK(vkAllocateMemory(device, &allocate_info, allocator, &memory));
+    char *data = nullptr;
+    CHECK(vkMapMemory(device, memory, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&data)));
+    VkMappedMemoryRange range = {VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE};
+    range.memory = memory;
+    range.size = VK_WHOLE_SIZE;
+
+    Measurement measurement = Measure(flush_count, [&]() {
+        for (uint32_t i = 0; i < flush_count; i++) {
+            memset(data + (i * 7919u * write_size) % (mapping_size - write_size), static_cast<int>(i), write_size);
+            CHECK(vkFlushMappedMemoryRanges(device, 1, &range));
+        }
+    });
+
+    vkUnmapMemory(device, memory);
+    vkFreeMemory(device, memory, allocator);
+    return measurement;
+}
+
+// Records pipeline barriers and vertex buffer bindings, whose array elements parameter_validation checks under indexed
+// parameter names such as pBufferMemoryBarriers[i].offset, then resets the command buffer
+Measurement ArrayParameterWorkload(Context const &context, uint32_t scale) {
+    uint32_t const record_count = 2000 * scale;
+    uint32_t const commands_per_record = 64;
+    uint32_t const calls_per_record = 3 + 2 * commands_per_record;
+    uint32_t const element_count = 4;
+    VkDeviceSize const element_size = 4096;
+    VkDevice const device = context.device;
+
+    VkDeviceMemory memory;
+    VkBuffer buffer = CreateBoundBuffer(context, element_count * element_size,
+                                        VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT, &memory);
+    VkCommandBuffer command_buffer = AllocateCommandBuffer(context);
+    VkBufferMemoryBarrier barriers[element_count];
+    VkBuffer vertex_buffers[element_count];
+    VkDeviceSize offsets[element_count];
+    for (uint32_t i = 0; i < element_count; i++) {
+        barriers[i] = {VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER};
+        barriers[i].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+        barriers[i].dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT;
+        barriers[i].srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[i].dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        barriers[i].buffer = buffer;
+        barriers[i].offset = i * element_size;
+        barriers[i].size = element_size;
+        vertex_buffers[i] = buffer;
+        offsets[i] = i * element_size;
+    }
+
+    Measurement measurement = Measure(uint64_t(record_count) * calls_per_record, [&]() {
+        for (uint32_t i = 0; i < record_count; i++) {
+            VkCommandBufferBeginInfo begin_info = {VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+            begin_info.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            CHECK(vkBeginCommandBuffer(command_buffer, &begin_info));
+            for (uint32_t j = 0; j < commands_per_record; j++) {
+                vkCmdPipelineBarrier(command_buffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_VERTEX_INPUT_BIT, 0, 0,
+                                     nullptr, element_count, barriers, 0, nullptr);
+                vkCmdBindVertexBuffers(command_buffer, 0, element_count, vertex_buffers, offsets);
+            }
+            CHECK(vkEndCommandBuffer(command_buffer));
+            CHECK(vkResetCommandBuffer(command_buffer, 0));
+        }
+    });
+
+    vkFreeCommandBuffers(device, context.command_pool, 1, &command_buffer);
+    vkDestroyBuffer(device, buffer, allocator);
+    vkFreeMemory(device, memory, allocator);
+    return measurement;
+}
+
+struct Workload {
+    char const *name;
+    Measurement (*run)(Context const &context, uint32_t scale);
+};
+
+Workload const workloads[] = {
+    {"draws", DrawWorkload},
+    {"descriptor_updates", DescriptorUpdateWorkload},
+    {"resource_churn", ResourceChurnWorkload},
+    {"queue_submits", QueueSubmitWorkload},
+    {"timestamp_queries", TimestampQueryWorkload},
+    {"mapped_flushes", MappedFlushWorkload},
+    {"render_passes", RenderPassWorkload},
+    {"array_parameters", ArrayParameterWorkload},
+};
+
+struct Result {
+    std::string layers;
+    std::string workload;
+    Measurement measurement;
+    uint32_t validation_messages;
+};
+
+void SetDefaultEnvironment(char const *name, char const *value) {
+    if (getenv(name) != nullptr) return;
+#ifdef _WIN32
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 0);
+#endif
+}
+
+void WriteJson(FILE *file, std::vector<Result> const &results) {
+    fprintf(file, "{\n  \"benchmarks\": [\n");
+    for (size_t i = 0; i < results.size(); i++) {
+        Result const &result = results[i];
+        double const calls = static_cast<double>(result.measurement.calls);
+        fprintf(file,
+                "    {\"layers\": \"%s\", \"workload\": \"%s\", \"calls\": %llu, \"ns_per_call\": %.2f, "
+                "\"allocations_per_call\": %.3f, \"validation_messages\": %u}%s\n",
+                result.layers.c_str(), result.workload.c_str(), static_cast<unsigned long long>(result.measurement.calls),
+                result.measurement.seconds * 1e9 / calls, result.measurement.allocations / calls, result.validation_messages,
+                i + 1 < results.size() ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    char const *json_filename = nullptr;
+    char const *only_layers = nullptr;
+    char const *only_workload = nullptr;
+    uint32_t scale = 1;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--json") && i + 1 < argc) {
+            json_filename = argv[++i];
+        } else if (!strcmp(argv[i], "--scale") && i + 1 < argc) {
+            scale = static_cast<uint32_t>(atoi(argv[++i]));
+            if (scale == 0) scale = 1;
+        } else if (!strcmp(argv[i], "--layers") && i + 1 < argc) {
+            only_layers = argv[++i];
+        } else if (!strcmp(argv[i], "--workload") && i + 1 < argc) {
+            only_workload = argv[++i];
+        } else {
+            fprintf(stderr, "Usage: %s [--json <file>] [--scale <factor>] [--layers <name>] [--workload <name>]\n", argv[0]);
+            return 1;
+        }
+    }
+
+#if defined(NULL_DRIVER_MANIFEST)
+    SetDefaultEnvironment("VK_ICD_FILENAMES", NULL_DRIVER_MANIFEST);
+#endif
+#if defined(BENCHMARK_LAYER_PATH)
+    SetDefaultEnvironment("VK_LAYER_PATH", BENCHMARK_LAYER_PATH);
+#endif
+
+    std::vector<LayerConfiguration> const configurations = {
+        {"none", {}},
+        {"core_validation", {"VK_LAYER_LUNARG_core_validation"}},
+        {"object_tracker", {"VK_LAYER_LUNARG_object_tracker"}},
+        {"parameter_validation", {"VK_LAYER_LUNARG_parameter_validation"}},
+        {"threading", {"VK_LAYER_GOOGLE_threading"}},
+        {"unique_objects", {"VK_LAYER_GOOGLE_unique_objects"}},
+        {"swapchain", {"VK_LAYER_LUNARG_swapchain"}},
+        {"standard_validation", {"VK_LAYER_LUNARG_standard_validation"}},
+    };
+
+    std::vector<Result> results;
+    printf("%-22s %-20s %12s %12s %14s %9s\n", "layers", "workload", "calls", "ns/call", "allocs/call", "messages");
+    for (auto const &configuration : configurations) {
+        if (only_layers && strcmp(only_layers, configuration.name)) continue;
+        Context context;
+        if (!CreateContext(configuration, &context)) {
+            DestroyContext(&context);
+            continue;
+        }
+        for (auto const &workload : workloads) {
+            if (only_workload && strcmp(only_workload, workload.name)) continue;
+            validation_messages = 0;
+            Result result;
+            result.layers = configuration.name;
+            result.workload = workload.name;
+            result.measurement = workload.run(context, scale);
+            result.validation_messages = validation_messages;
+            double const calls = static_cast<double>(result.measurement.calls);
+            printf("%-22s %-20s %12llu %12.1f %14.3f %9u\n", configuration.name, workload.name,
+                   static_cast<unsigned long long>(result.measurement.calls), result.measurement.seconds * 1e9 / calls,
+                   result.measurement.allocations / calls, result.validation_messages);
+            results.push_back(result);
+        }
+        DestroyContext(&context);
+    }
+
+    if (json_filename != nullptr) {
+        FILE *file = fopen(json_filename, "w");
+        if (file == nullptr) {
+            fprintf(stderr, "Unable to write %s\n", json_filename);
+            return 1;
+        }
+        WriteJson(file, results);
+        fclose(file);
+    }
+    return 0;
+}
@@ -1768,6 +1768,58 @@ TEST_F(VkLayerTest, InvalidMemoryMapping) {
     vkFreeMemory(m_device->device(), mem, NULL);
 }
 
+// Turns on lunarg_core_validation.noncoherent_guard_pages for the instances created while it is in scope
+class NoncoherentGuardPagesOption {
+   public:
+    NoncoherentGuardPagesOption() { setLayerOption("lunarg_core_validation.noncoherent_guard_pages", "true"); }
+    ~NoncoherentGuardPagesOption() { setLayerOption("lunarg_core_validation.noncoherent_guard_pages", "false"); }
+};
+
+// Several pages, so that a guarded mapping has pages that are never touched
+static const VkDeviceSize kGuardedMemorySize = 64 * 1024;
+
+// Allocates host visible memory that isn't coherent; returns false if the device has none
+static bool AllocateNoncoherentMemory(VkDeviceObj *device, VkDeviceSize size, VkDeviceMemory *mem) {
+    VkMemoryAllocateInfo alloc_info = {VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    alloc_info.allocationSize = size;
+    if (!device->phy().set_memory_type(0xFFFFFFFF, &alloc_info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT,
+                                       VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)) {
+        return false;
+    }
+    return vkAllocateMemory(device->device(), &alloc_info, nullptr, mem) == VK_SUCCESS;
+}
+
+TEST_F(VkLayerTest, GuardedNonCoherentMemoryOutOfBounds) {
+    TEST_DESCRIPTION("Write just before and just after a guarded non-coherent mapping, and check that the flush reports it");
+
+    NoncoherentGuardPagesOption guard_pages;
+    ASSERT_NO_FATAL_FAILURE(Init());
+    VkDeviceMemory mem;
+    if (!AllocateNoncoherentMemory(m_device, kGuardedMemorySize, &mem)) {
+        printf("             No non-coherent host visible memory type; skipped.\n");
+        return;
+    }
+
+    uint8_t *data;
+    ASSERT_VK_SUCCESS(vkMapMemory(m_device->device(), mem, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&data)));
+    VkMappedMemoryRange range = {VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, nullptr, mem, 0, VK_WHOLE_SIZE};
+
+    data[-1] = 0;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "Memory underflow was detected");
+    vkFlushMappedMemoryRanges(m_device->device(), 1, &range);
+    m_errorMonitor->VerifyFound();
+    vkUnmapMemory(m_device->device(), mem);
+
+    ASSERT_VK_SUCCESS(vkMapMemory(m_device->device(), mem, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&data)));
+    data[kGuardedMemorySize] = 0;
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "Memory overflow was detected");
+    vkFlushMappedMemoryRanges(m_device->device(), 1, &range);
+    m_errorMonitor->VerifyFound();
+    vkUnmapMemory(m_device->device(), mem);
+
+    vkFreeMemory(m_device->device(), mem, nullptr);
+}
+
 #if 0  // disabled until PV gets real extension enable checks
 TEST_F(VkLayerTest, EnableWsiBeforeUse) {
     VkResult err;
@@ -11780,6 +11832,105 @@ TEST_F(VkLayerTest, RenderPassIncompatible) {
     vkDestroyRenderPass(m_device->device(), rp, NULL);
 }
 
+// Creates a render pass with one color attachment of the given format, for render pass compatibility tests
+static VkResult CreateSingleColorAttachmentRenderPass(VkDevice device, VkFormat format, VkRenderPass *render_pass) {
+    VkAttachmentDescription attachment = {0,
+                                          format,
+                                          VK_SAMPLE_COUNT_1_BIT,
+                                          VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                                          VK_ATTACHMENT_STORE_OP_STORE,
+                                          VK_ATTACHMENT_LOAD_OP_DONT_CARE,
+                                          VK_ATTACHMENT_STORE_OP_DONT_CARE,
+                                          VK_IMAGE_LAYOUT_UNDEFINED,
+                                          VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    VkAttachmentReference att_ref = {0, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL};
+    VkSubpassDescription subpass = {0, VK_PIPELINE_BIND_POINT_GRAPHICS, 0, nullptr, 1, &att_ref, nullptr, nullptr, 0, nullptr};
+    VkRenderPassCreateInfo rpci = {VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO, nullptr, 0, 1, &attachment, 1, &subpass, 0, nullptr};
+    return vkCreateRenderPass(device, &rpci, nullptr, render_pass);
+}
+
+TEST_F(VkLayerTest, RenderPassBeginIncompatibleFramebuffer) {
+    TEST_DESCRIPTION(
+        "Begin a render pass with a framebuffer that was created with a render pass "
+        "whose color attachment has a different format.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkRenderPass fb_rp, rp;
+    ASSERT_VK_SUCCESS(CreateSingleColorAttachmentRenderPass(m_device->device(), VK_FORMAT_R8G8B8A8_UNORM, &fb_rp));
+    ASSERT_VK_SUCCESS(CreateSingleColorAttachmentRenderPass(m_device->device(), VK_FORMAT_B8G8R8A8_UNORM, &rp));
+
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(image.initialized());
+    VkImageView view = image.targetView(VK_FORMAT_R8G8B8A8_UNORM);
+
+    VkFramebufferCreateInfo fci = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, nullptr, 0, fb_rp, 1, &view, 32, 32, 1};
+    VkFramebuffer fb;
+    ASSERT_VK_SUCCESS(vkCreateFramebuffer(m_device->device(), &fci, nullptr, &fb));
+
+    VkRenderPassBeginInfo rpbi = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, nullptr, rp, fb, {{0, 0}, {32, 32}}, 0, nullptr};
+    m_commandBuffer->BeginCommandBuffer();
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01702);
+    vkCmdBeginRenderPass(m_commandBuffer->handle(), &rpbi, VK_SUBPASS_CONTENTS_INLINE);
+    m_errorMonitor->VerifyFound();
+    vkCmdEndRenderPass(m_commandBuffer->handle());
+    m_commandBuffer->EndCommandBuffer();
+
+    vkDestroyFramebuffer(m_device->device(), fb, nullptr);
+    vkDestroyRenderPass(m_device->device(), rp, nullptr);
+    vkDestroyRenderPass(m_device->device(), fb_rp, nullptr);
+}
+
+TEST_F(VkLayerTest, RenderPassBeginIncompatibleFramebufferRepeated) {
+    TEST_DESCRIPTION(
+        "Begin render passes that are incompatible with a framebuffer's render pass more than once, "
+        "including a distinct render pass of the same structure, so that the compatibility of their pair "
+        "is already known. Each begin must still be reported, and a compatible render pass must not be.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    // rp and same_rp are structurally identical, as are fb_rp and compatible_rp
+    VkRenderPass fb_rp, compatible_rp, rp, same_rp;
+    ASSERT_VK_SUCCESS(CreateSingleColorAttachmentRenderPass(m_device->device(), VK_FORMAT_R8G8B8A8_UNORM, &fb_rp));
+    ASSERT_VK_SUCCESS(CreateSingleColorAttachmentRenderPass(m_device->device(), VK_FORMAT_R8G8B8A8_UNORM, &compatible_rp));
+    ASSERT_VK_SUCCESS(CreateSingleColorAttachmentRenderPass(m_device->device(), VK_FORMAT_B8G8R8A8_UNORM, &rp));
+    ASSERT_VK_SUCCESS(CreateSingleColorAttachmentRenderPass(m_device->device(), VK_FORMAT_B8G8R8A8_UNORM, &same_rp));
+
+    VkImageObj image(m_device);
+    image.Init(32, 32, 1, VK_FORMAT_R8G8B8A8_UNORM, VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT, VK_IMAGE_TILING_OPTIMAL, 0);
+    ASSERT_TRUE(image.initialized());
+    VkImageView view = image.targetView(VK_FORMAT_R8G8B8A8_UNORM);
+
+    VkFramebufferCreateInfo fci = {VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO, nullptr, 0, fb_rp, 1, &view, 32, 32, 1};
+    VkFramebuffer fb;
+    ASSERT_VK_SUCCESS(vkCreateFramebuffer(m_device->device(), &fci, nullptr, &fb));
+
+    VkRenderPassBeginInfo rpbi = {VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO, nullptr, rp, fb, {{0, 0}, {32, 32}}, 0, nullptr};
+    m_commandBuffer->BeginCommandBuffer();
+    const VkRenderPass incompatible_rps[] = {rp, rp, same_rp};
+    for (auto incompatible_rp : incompatible_rps) {
+        rpbi.renderPass = incompatible_rp;
+        m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01702);
+        vkCmdBeginRenderPass(m_commandBuffer->handle(), &rpbi, VK_SUBPASS_CONTENTS_INLINE);
+        m_errorMonitor->VerifyFound();
+        vkCmdEndRenderPass(m_commandBuffer->handle());
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    rpbi.renderPass = compatible_rp;
+    vkCmdBeginRenderPass(m_commandBuffer->handle(), &rpbi, VK_SUBPASS_CONTENTS_INLINE);
+    vkCmdEndRenderPass(m_commandBuffer->handle());
+    m_errorMonitor->VerifyNotFound();
+    m_commandBuffer->EndCommandBuffer();
+
+    vkDestroyFramebuffer(m_device->device(), fb, nullptr);
+    vkDestroyRenderPass(m_device->device(), same_rp, nullptr);
+    vkDestroyRenderPass(m_device->device(), rp, nullptr);
+    vkDestroyRenderPass(m_device->device(), compatible_rp, nullptr);
+    vkDestroyRenderPass(m_device->device(), fb_rp, nullptr);
+}
+
 TEST_F(VkLayerTest, NumBlendAttachMismatch) {
     // Create Pipeline where the number of blend attachments doesn't match the
     // number of color attachments.  In this case, we don't add any color
@@ -12269,6 +12420,135 @@ TEST_F(VkLayerTest, InvalidQueueIndexInvalidQuery) {
     vkDestroyEvent(m_device->device(), event, nullptr);
 }
 
+TEST_F(VkLayerTest, QueryRangePastEndOfPool) {
+    TEST_DESCRIPTION(
+        "Name queries past the end of a query pool in commands that reset, write, begin, end, copy and get them, including a "
+        "first query whose range would wrap around a 32-bit count, then submit the command buffer.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    VkQueryPoolCreateInfo query_pool_create_info = {};
+    query_pool_create_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    query_pool_create_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    query_pool_create_info.queryCount = 4;
+    VkQueryPool timestamp_pool;
+    vkCreateQueryPool(m_device->device(), &query_pool_create_info, nullptr, &timestamp_pool);
+    query_pool_create_info.queryType = VK_QUERY_TYPE_OCCLUSION;
+    VkQueryPool occlusion_pool;
+    vkCreateQueryPool(m_device->device(), &query_pool_create_info, nullptr, &occlusion_pool);
+
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    vk_testing::Buffer buffer;
+    buffer.init_as_dst(*m_device, (VkDeviceSize)64, reqs);
+
+    m_commandBuffer->BeginCommandBuffer();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01020);
+    vkCmdResetQueryPool(m_commandBuffer->handle(), timestamp_pool, 2, 4);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01019);
+    vkCmdResetQueryPool(m_commandBuffer->handle(), timestamp_pool, UINT32_MAX, 1);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, "is past the end of queryPool");
+    vkCmdWriteTimestamp(m_commandBuffer->handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestamp_pool, UINT32_MAX);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01031);
+    vkCmdBeginQuery(m_commandBuffer->handle(), occlusion_pool, 4, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01042);
+    vkCmdEndQuery(m_commandBuffer->handle(), occlusion_pool, 4);
+    m_errorMonitor->VerifyFound();
+
+    // Make the queries in the pool available, so that copying them is valid when the command buffer is submitted
+    vkCmdResetQueryPool(m_commandBuffer->handle(), timestamp_pool, 0, 4);
+    for (uint32_t i = 0; i < 4; ++i) {
+        vkCmdWriteTimestamp(m_commandBuffer->handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, timestamp_pool, i);
+    }
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01061);
+    vkCmdCopyQueryPoolResults(m_commandBuffer->handle(), timestamp_pool, 4, 1, buffer.handle(), 0, 8, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01062);
+    vkCmdCopyQueryPoolResults(m_commandBuffer->handle(), timestamp_pool, 0, 5, buffer.handle(), 0, 8, 0);
+    m_errorMonitor->VerifyFound();
+
+    m_commandBuffer->EndCommandBuffer();
+
+    // The layer records the query updates of the skipped commands too; they must stay within the pool
+    m_errorMonitor->ExpectSuccess();
+    m_commandBuffer->QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    uint32_t data[8] = {};
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01048);
+    vkGetQueryPoolResults(m_device->device(), timestamp_pool, 0x80000000, 1, sizeof(data), data, sizeof(uint32_t), 0);
+    m_errorMonitor->VerifyFound();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, VALIDATION_ERROR_01051);
+    vkGetQueryPoolResults(m_device->device(), timestamp_pool, 2, 4, sizeof(data), data, sizeof(uint32_t), 0);
+    m_errorMonitor->VerifyFound();
+
+    vkDestroyQueryPool(m_device->device(), occlusion_pool, nullptr);
+    vkDestroyQueryPool(m_device->device(), timestamp_pool, nullptr);
+}
+
+TEST_F(VkLayerTest, QueryCopyUnavailableQueries) {
+    TEST_DESCRIPTION(
+        "Copy the results of a range of queries spanning several 64-query words, of which two were never written, "
+        "then write those two and copy the range again.");
+
+    ASSERT_NO_FATAL_FAILURE(Init());
+
+    const uint32_t query_count = 256;
+    VkQueryPoolCreateInfo query_pool_create_info = {};
+    query_pool_create_info.sType = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+    query_pool_create_info.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    query_pool_create_info.queryCount = query_count;
+    VkQueryPool query_pool;
+    vkCreateQueryPool(m_device->device(), &query_pool_create_info, nullptr, &query_pool);
+
+    VkMemoryPropertyFlags reqs = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT;
+    vk_testing::Buffer buffer;
+    buffer.init_as_dst(*m_device, (VkDeviceSize)(query_count * sizeof(uint64_t)), reqs);
+
+    m_commandBuffer->BeginCommandBuffer();
+    vkCmdResetQueryPool(m_commandBuffer->handle(), query_pool, 0, query_count);
+    for (uint32_t i = 0; i < query_count; ++i) {
+        if (i != 70 && i != 200) {
+            vkCmdWriteTimestamp(m_commandBuffer->handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, query_pool, i);
+        }
+    }
+    vkCmdCopyQueryPoolResults(m_commandBuffer->handle(), query_pool, 0, query_count, buffer.handle(), 0, sizeof(uint64_t),
+                              VK_QUERY_RESULT_64_BIT);
+    m_commandBuffer->EndCommandBuffer();
+
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, ", index 70");
+    m_errorMonitor->SetDesiredFailureMsg(VK_DEBUG_REPORT_ERROR_BIT_EXT, ", index 200");
+    m_commandBuffer->QueueCommandBuffer(false);
+    m_errorMonitor->VerifyFound();
+
+    // The queries the first submission wrote are still available on the queue, so only the two need writing
+    VkCommandBufferObj command_buffer(m_device, m_commandPool);
+    command_buffer.BeginCommandBuffer();
+    vkCmdWriteTimestamp(command_buffer.handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, query_pool, 70);
+    vkCmdWriteTimestamp(command_buffer.handle(), VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, query_pool, 200);
+    vkCmdCopyQueryPoolResults(command_buffer.handle(), query_pool, 0, query_count, buffer.handle(), 0, sizeof(uint64_t),
+                              VK_QUERY_RESULT_64_BIT);
+    command_buffer.EndCommandBuffer();
+
+    m_errorMonitor->ExpectSuccess();
+    command_buffer.QueueCommandBuffer();
+    m_errorMonitor->VerifyNotFound();
+
+    vkQueueWaitIdle(m_device->m_queue);
+    vkDestroyQueryPool(m_device->device(), query_pool, nullptr);
+}
+
 TEST_F(VkLayerTest, VertexBufferInvalid) {
     TEST_DESCRIPTION(
         "Submit a command buffer using deleted vertex buffer, "
@@ -20748,6 +21028,69 @@ TEST_F(VkPositiveLayerTest, NonCoherentMemoryMapping) {
     vkFreeMemory(m_device->device(), mem, NULL);
 }
 
+TEST_F(VkPositiveLayerTest, GuardedNonCoherentMemoryFlush) {
+    TEST_DESCRIPTION("Write to some pages of a guarded non-coherent mapping, flush, and check that the data reached the driver");
+
+    NoncoherentGuardPagesOption guard_pages;
+    ASSERT_NO_FATAL_FAILURE(Init());
+    VkDeviceMemory mem;
+    if (!AllocateNoncoherentMemory(m_device, kGuardedMemorySize, &mem)) {
+        printf("             No non-coherent host visible memory type; skipped.\n");
+        return;
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    uint8_t *data;
+    ASSERT_VK_SUCCESS(vkMapMemory(m_device->device(), mem, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&data)));
+    // The first and last pages only, so that most of the mapping is never touched
+    memset(data, 0x5a, 256);
+    memset(data + kGuardedMemorySize - 256, 0xa5, 256);
+    VkMappedMemoryRange range = {VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, nullptr, mem, 0, VK_WHOLE_SIZE};
+    ASSERT_VK_SUCCESS(vkFlushMappedMemoryRanges(m_device->device(), 1, &range));
+    vkUnmapMemory(m_device->device(), mem);
+
+    // A new mapping is filled from the driver's memory
+    ASSERT_VK_SUCCESS(vkMapMemory(m_device->device(), mem, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&data)));
+    for (VkDeviceSize i = 0; i < 256; ++i) {
+        ASSERT_EQ(data[i], 0x5a) << "at " << i;
+        ASSERT_EQ(data[kGuardedMemorySize - 256 + i], 0xa5) << "at " << kGuardedMemorySize - 256 + i;
+    }
+    vkUnmapMemory(m_device->device(), mem);
+    m_errorMonitor->VerifyNotFound();
+
+    vkFreeMemory(m_device->device(), mem, nullptr);
+}
+
+TEST_F(VkPositiveLayerTest, GuardedNonCoherentMemoryInvalidate) {
+    TEST_DESCRIPTION("Invalidate a guarded non-coherent mapping and check that reads return the driver's data again");
+
+    NoncoherentGuardPagesOption guard_pages;
+    ASSERT_NO_FATAL_FAILURE(Init());
+    VkDeviceMemory mem;
+    if (!AllocateNoncoherentMemory(m_device, kGuardedMemorySize, &mem)) {
+        printf("             No non-coherent host visible memory type; skipped.\n");
+        return;
+    }
+
+    m_errorMonitor->ExpectSuccess();
+    uint8_t *data;
+    ASSERT_VK_SUCCESS(vkMapMemory(m_device->device(), mem, 0, VK_WHOLE_SIZE, 0, reinterpret_cast<void **>(&data)));
+    memset(data, 0x5a, kGuardedMemorySize);
+    VkMappedMemoryRange range = {VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE, nullptr, mem, 0, VK_WHOLE_SIZE};
+    ASSERT_VK_SUCCESS(vkFlushMappedMemoryRanges(m_device->device(), 1, &range));
+
+    // Writes that are never flushed are replaced by the driver's data
+    memset(data, 0xa5, kGuardedMemorySize);
+    ASSERT_VK_SUCCESS(vkInvalidateMappedMemoryRanges(m_device->device(), 1, &range));
+    for (VkDeviceSize i = 0; i < kGuardedMemorySize; ++i) {
+        ASSERT_EQ(data[i], 0x5a) << "at " << i;
+    }
+    vkUnmapMemory(m_device->device(), mem);
+    m_errorMonitor->VerifyNotFound();
+
+    vkFreeMemory(m_device->device(), mem, nullptr);
+}
+
 // This is a positive test. We used to expect error in this case but spec now allows it
 TEST_F(VkPositiveLayerTest, ResetUnsignaledFence) {
     m_errorMonitor->ExpectSuccess();
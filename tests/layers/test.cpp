@@ -37,7 +37,7 @@ struct layer_data {
 
 static uint32_t loader_layer_if_version = CURRENT_LOADER_LAYER_INTERFACE_VERSION;
 
-static std::unordered_map<void *, layer_data *> layer_data_map;
+static LayerDataRegistry<layer_data> layer_data_map;
 
 VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(const VkInstanceCreateInfo* pCreateInfo, const VkAllocationCallbacks* pAllocator,
 		VkInstance* pInstance)
@@ -33,13 +33,24 @@
 #include <stdint.h> // For UINT32_MAX
 
 #include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "test_common.h"
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #include <vulkan/vulkan.h>
+#include "cJSON.h"
+#include "loader_test_manifests.h"
 
 namespace VK {
 
@@ -403,6 +414,34 @@ VKAPI_ATTR void *VKAPI_CALL ReallocCallbackFunc(void *pUserData, void *pOriginal
     }
 }
 
+// Counts the calls into the allocation callbacks, then hands them to the tracker above
+uint32_t g_allocation_calls = 0;
+
+VKAPI_ATTR void *VKAPI_CALL CountingAllocCallbackFunc(void *pUserData, size_t size, size_t alignment,
+                                                      VkSystemAllocationScope allocationScope) {
+    ++g_allocation_calls;
+    return AllocCallbackFunc(pUserData, size, alignment, allocationScope);
+}
+
+VKAPI_ATTR void *VKAPI_CALL CountingReallocCallbackFunc(void *pUserData, void *pOriginal, size_t size, size_t alignment,
+                                                        VkSystemAllocationScope allocationScope) {
+    ++g_allocation_calls;
+    return ReallocCallbackFunc(pUserData, pOriginal, size, alignment, allocationScope);
+}
+
+// Sets, or with a null value removes, an environment variable the loader reads
+void SetLoaderEnvironment(char const *name, char const *value) {
+#ifdef _WIN32
+    _putenv_s(name, value ? value : "");
+#else
+    if (value) {
+        setenv(name, value, 1);
+    } else {
+        unsetenv(name);
+    }
+#endif
+}
+
 // Test groups:
 // LX = lunar exchange
 // LVLGH = loader and validation github
@@ -897,6 +936,377 @@ TEST(EnumerateDeviceExtensionProperties, DeviceExtensionEnumerated) {
     vkDestroyInstance(instance, nullptr);
 }
 
+#if !defined(_WIN32)
+// Writes implicit layer manifests that each advertise a block of shared instance and device extensions, plus a block
+// of their own, into a fresh XDG_DATA_HOME. The layer libraries don't exist, which only matters to vkCreateInstance.
+class ManyLayerExtensions {
+   public:
+    static uint32_t const layerCount = 32;
+    static uint32_t const extensionCount = 64;
+
+    ManyLayerExtensions() {
+        char path[] = "/tmp/vk_loader_many_layer_extensions_XXXXXX";
+        if (mkdtemp(path) == nullptr) return;
+        directory = path;
+        std::string const layerDirectory = directory + "/vulkan/implicit_layer.d";
+        mkdir((directory + "/vulkan").c_str(), 0755);
+        mkdir(layerDirectory.c_str(), 0755);
+        for (uint32_t layer = 0; layer < layerCount; ++layer) {
+            std::string const name = "VK_LAYER_LOADER_TEST_many_extensions_" + std::to_string(layer);
+            std::string const filename = layerDirectory + "/" + name + ".json";
+            std::ofstream manifest(filename);
+            manifest << "{\"file_format_version\": \"1.1.0\", \"layer\": {\"name\": \"" << name
+                     << "\", \"type\": \"GLOBAL\", \"library_path\": \"./lib" << name
+                     << ".so\", \"api_version\": \"1.0.61\", \"implementation_version\": \"1\", \"description\": \"\", ";
+            for (char const *kind : {"instance", "device"}) {
+                manifest << '"' << kind << "_extensions\": [";
+                for (uint32_t ext = 0; ext < 2 * extensionCount; ++ext) {
+                    manifest << (ext ? ", " : "") << "{\"name\": \"VK_LOADER_TEST_" << kind << "_"
+                             << (ext < extensionCount ? std::string("shared") : std::to_string(layer)) << "_"
+                             << ext % extensionCount << "\", \"spec_version\": \"1\"}";
+                }
+                manifest << "], ";
+            }
+            manifest << "\"disable_environment\": {\"VK_LOADER_TEST_DISABLE_MANY_EXTENSIONS\": \"1\"}}}\n";
+            files.push_back(filename);
+        }
+        files.push_back(layerDirectory);
+        files.push_back(directory + "/vulkan");
+        SetLoaderEnvironment("XDG_DATA_HOME", directory.c_str());
+    }
+
+    ~ManyLayerExtensions() {
+        SetLoaderEnvironment("XDG_DATA_HOME", nullptr);
+        for (std::string const &file : files) remove(file.c_str());
+        if (!directory.empty()) rmdir(directory.c_str());
+    }
+
+    // Extensions the layers add to a list that has none of them yet
+    static uint32_t UniqueExtensionCount() { return extensionCount * (layerCount + 1); }
+
+    std::string directory;
+    std::vector<std::string> files;
+};
+
+static uint32_t CountTestExtensions(VkExtensionProperties const *properties, uint32_t count, char const *prefix) {
+    uint32_t matches = 0;
+    for (uint32_t p = 0; p < count; ++p) {
+        if (strncmp(properties[p].extensionName, prefix, strlen(prefix)) == 0) ++matches;
+    }
+    return matches;
+}
+
+// Merges thousands of layer extensions, half of them duplicated across layers, into the instance and device extension
+// lists, and reports the time per enumeration.
+TEST(ExtensionLists, ManyLayerExtensions) {
+    uint32_t baseInstanceCount = 0;
+    ASSERT_EQ(vkEnumerateInstanceExtensionProperties(nullptr, &baseInstanceCount, nullptr), VK_SUCCESS);
+
+    ManyLayerExtensions layers;
+    ASSERT_FALSE(layers.directory.empty());
+
+    uint32_t const rounds = 20;
+    uint32_t count = 0;
+    ASSERT_EQ(vkEnumerateInstanceExtensionProperties(nullptr, &count, nullptr), VK_SUCCESS);
+    std::vector<VkExtensionProperties> properties(count);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < rounds; ++round) {
+        count = static_cast<uint32_t>(properties.size());
+        ASSERT_EQ(vkEnumerateInstanceExtensionProperties(nullptr, &count, properties.data()), VK_SUCCESS);
+    }
+    auto end = std::chrono::steady_clock::now();
+    EXPECT_EQ(CountTestExtensions(properties.data(), count, "VK_LOADER_TEST_instance_"),
+              ManyLayerExtensions::UniqueExtensionCount());
+    EXPECT_EQ(count, baseInstanceCount + ManyLayerExtensions::UniqueExtensionCount());
+    std::cout << "vkEnumerateInstanceExtensionProperties: "
+              << std::chrono::duration<double, std::micro>(end - start).count() / rounds << " us for " << count
+              << " extensions\n";
+
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    uint32_t physicalCount = 1;
+    VkPhysicalDevice physical = VK_NULL_HANDLE;
+    result = vkEnumeratePhysicalDevices(instance, &physicalCount, &physical);
+    ASSERT_TRUE(result == VK_SUCCESS || result == VK_INCOMPLETE);
+    ASSERT_EQ(physicalCount, 1u);
+
+    ASSERT_EQ(vkEnumerateDeviceExtensionProperties(physical, nullptr, &count, nullptr), VK_SUCCESS);
+    properties.resize(count);
+    start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < rounds; ++round) {
+        count = static_cast<uint32_t>(properties.size());
+        ASSERT_EQ(vkEnumerateDeviceExtensionProperties(physical, nullptr, &count, properties.data()), VK_SUCCESS);
+    }
+    end = std::chrono::steady_clock::now();
+    EXPECT_EQ(CountTestExtensions(properties.data(), count, "VK_LOADER_TEST_device_"), ManyLayerExtensions::UniqueExtensionCount());
+    std::cout << "vkEnumerateDeviceExtensionProperties: "
+              << std::chrono::duration<double, std::micro>(end - start).count() / rounds << " us for " << count
+              << " extensions\n";
+
+    vkDestroyInstance(instance, nullptr);
+}
+#endif
+
+// Core commands that vkGetInstanceProcAddr resolves with an instance, other than the global commands
+static char const *const core_instance_level_commands[] = {
+    "vkDestroyInstance", "vkEnumeratePhysicalDevices", "vkGetPhysicalDeviceFeatures", "vkGetPhysicalDeviceFormatProperties",
+    "vkGetPhysicalDeviceImageFormatProperties", "vkGetPhysicalDeviceProperties", "vkGetPhysicalDeviceQueueFamilyProperties",
+    "vkGetPhysicalDeviceMemoryProperties", "vkGetInstanceProcAddr", "vkCreateDevice", "vkEnumerateDeviceExtensionProperties",
+    "vkEnumerateDeviceLayerProperties", "vkGetPhysicalDeviceSparseImageFormatProperties"};
+
+// Core commands that vkGetDeviceProcAddr also resolves
+static char const *const core_device_level_commands[] = {
+    "vkGetDeviceProcAddr", "vkDestroyDevice", "vkGetDeviceQueue", "vkQueueSubmit", "vkQueueWaitIdle", "vkDeviceWaitIdle",
+    "vkAllocateMemory", "vkFreeMemory", "vkMapMemory", "vkUnmapMemory", "vkFlushMappedMemoryRanges",
+    "vkInvalidateMappedMemoryRanges", "vkGetDeviceMemoryCommitment", "vkBindBufferMemory", "vkBindImageMemory",
+    "vkGetBufferMemoryRequirements", "vkGetImageMemoryRequirements", "vkGetImageSparseMemoryRequirements", "vkQueueBindSparse",
+    "vkCreateFence", "vkDestroyFence", "vkResetFences", "vkGetFenceStatus", "vkWaitForFences", "vkCreateSemaphore",
+    "vkDestroySemaphore", "vkCreateEvent", "vkDestroyEvent", "vkGetEventStatus", "vkSetEvent", "vkResetEvent",
+    "vkCreateQueryPool", "vkDestroyQueryPool", "vkGetQueryPoolResults", "vkCreateBuffer", "vkDestroyBuffer",
+    "vkCreateBufferView", "vkDestroyBufferView", "vkCreateImage", "vkDestroyImage", "vkGetImageSubresourceLayout",
+    "vkCreateImageView", "vkDestroyImageView", "vkCreateShaderModule", "vkDestroyShaderModule", "vkCreatePipelineCache",
+    "vkDestroyPipelineCache", "vkGetPipelineCacheData", "vkMergePipelineCaches", "vkCreateGraphicsPipelines",
+    "vkCreateComputePipelines", "vkDestroyPipeline", "vkCreatePipelineLayout", "vkDestroyPipelineLayout", "vkCreateSampler",
+    "vkDestroySampler", "vkCreateDescriptorSetLayout", "vkDestroyDescriptorSetLayout", "vkCreateDescriptorPool",
+    "vkDestroyDescriptorPool", "vkResetDescriptorPool", "vkAllocateDescriptorSets", "vkFreeDescriptorSets",
+    "vkUpdateDescriptorSets", "vkCreateFramebuffer", "vkDestroyFramebuffer", "vkCreateRenderPass", "vkDestroyRenderPass",
+    "vkGetRenderAreaGranularity", "vkCreateCommandPool", "vkDestroyCommandPool", "vkResetCommandPool",
+    "vkAllocateCommandBuffers", "vkFreeCommandBuffers", "vkBeginCommandBuffer", "vkEndCommandBuffer", "vkResetCommandBuffer",
+    "vkCmdBindPipeline", "vkCmdSetViewport", "vkCmdSetScissor", "vkCmdSetLineWidth", "vkCmdSetDepthBias",
+    "vkCmdSetBlendConstants", "vkCmdSetDepthBounds", "vkCmdSetStencilCompareMask", "vkCmdSetStencilWriteMask",
+    "vkCmdSetStencilReference", "vkCmdBindDescriptorSets", "vkCmdBindIndexBuffer", "vkCmdBindVertexBuffers", "vkCmdDraw",
+    "vkCmdDrawIndexed", "vkCmdDrawIndirect", "vkCmdDrawIndexedIndirect", "vkCmdDispatch", "vkCmdDispatchIndirect",
+    "vkCmdCopyBuffer", "vkCmdCopyImage", "vkCmdBlitImage", "vkCmdCopyBufferToImage", "vkCmdCopyImageToBuffer",
+    "vkCmdUpdateBuffer", "vkCmdFillBuffer", "vkCmdClearColorImage", "vkCmdClearDepthStencilImage", "vkCmdClearAttachments",
+    "vkCmdResolveImage", "vkCmdSetEvent", "vkCmdResetEvent", "vkCmdWaitEvents", "vkCmdPipelineBarrier", "vkCmdBeginQuery",
+    "vkCmdEndQuery", "vkCmdResetQueryPool", "vkCmdWriteTimestamp", "vkCmdCopyQueryPoolResults", "vkCmdPushConstants",
+    "vkCmdBeginRenderPass", "vkCmdNextSubpass", "vkCmdEndRenderPass", "vkCmdExecuteCommands"};
+
+// Resolves the whole core API through vkGetInstanceProcAddr and vkGetDeviceProcAddr, as an engine does at device
+// creation, and reports the average time per lookup.
+TEST(GetProcAddr, ResolveCoreApi) {
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    uint32_t physicalCount = 1;
+    VkPhysicalDevice physical = VK_NULL_HANDLE;
+    result = vkEnumeratePhysicalDevices(instance, &physicalCount, &physical);
+    ASSERT_TRUE(result == VK_SUCCESS || result == VK_INCOMPLETE);
+    ASSERT_EQ(physicalCount, 1u);
+
+    float const priorities[] = {0.0f};
+    VkDeviceQueueCreateInfo const queueInfo[1]{
+        VK::DeviceQueueCreateInfo().queueFamilyIndex(0).queueCount(1).pQueuePriorities(priorities)};
+    VkDevice device = VK_NULL_HANDLE;
+    result =
+        vkCreateDevice(physical, VK::DeviceCreateInfo().queueCreateInfoCount(1).pQueueCreateInfos(queueInfo), nullptr, &device);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    for (char const *name : core_instance_level_commands) {
+        EXPECT_NE(vkGetInstanceProcAddr(instance, name), nullptr) << name;
+    }
+    for (char const *name : core_device_level_commands) {
+        EXPECT_NE(vkGetInstanceProcAddr(instance, name), nullptr) << name;
+        EXPECT_NE(vkGetDeviceProcAddr(device, name), nullptr) << name;
+    }
+
+    uint32_t const rounds = 1000;
+    PFN_vkVoidFunction volatile sink = nullptr;
+    auto const start = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < rounds; ++round) {
+        for (char const *name : core_instance_level_commands) sink = vkGetInstanceProcAddr(instance, name);
+        for (char const *name : core_device_level_commands) sink = vkGetInstanceProcAddr(instance, name);
+    }
+    auto const middle = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < rounds; ++round) {
+        for (char const *name : core_device_level_commands) sink = vkGetDeviceProcAddr(device, name);
+    }
+    auto const end = std::chrono::steady_clock::now();
+    (void)sink;
+
+    size_t const instanceLookups =
+        rounds * (sizeof(core_instance_level_commands) + sizeof(core_device_level_commands)) / sizeof(char *);
+    size_t const deviceLookups = rounds * sizeof(core_device_level_commands) / sizeof(char *);
+    std::cout << "vkGetInstanceProcAddr: "
+              << std::chrono::duration<double, std::nano>(middle - start).count() / instanceLookups << " ns per command\n"
+              << "vkGetDeviceProcAddr: " << std::chrono::duration<double, std::nano>(end - middle).count() / deviceLookups
+              << " ns per command\n";
+
+    vkDestroyDevice(device, nullptr);
+    vkDestroyInstance(instance, nullptr);
+}
+
+// Resolve thousands of names from several threads at once: device commands that the null ICD has, more of them than the
+// loader has trampolines for, mixed with names that nothing knows about. Each name must resolve the same way every time,
+// each supported name must get its own trampoline until they run out, and each trampoline must reach its own command.
+TEST(GetProcAddr, UnknownCommandStress) {
+    VkInstance instance = VK_NULL_HANDLE;
+    VkResult result = vkCreateInstance(VK::InstanceCreateInfo(), VK_NULL_HANDLE, &instance);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    uint32_t physicalCount = 1;
+    VkPhysicalDevice physical = VK_NULL_HANDLE;
+    result = vkEnumeratePhysicalDevices(instance, &physicalCount, &physical);
+    ASSERT_TRUE(result == VK_SUCCESS || result == VK_INCOMPLETE);
+    ASSERT_EQ(physicalCount, 1u);
+
+    float const priorities[] = {0.0f};
+    VkDeviceQueueCreateInfo const queueInfo[1]{
+        VK::DeviceQueueCreateInfo().queueFamilyIndex(0).queueCount(1).pQueuePriorities(priorities)};
+    VkDevice device = VK_NULL_HANDLE;
+    result =
+        vkCreateDevice(physical, VK::DeviceCreateInfo().queueCreateInfoCount(1).pQueueCreateInfos(queueInfo), nullptr, &device);
+    ASSERT_EQ(result, VK_SUCCESS);
+
+    // vkNullTestDeviceCommand<N> is only known to the null ICD (tests/icd/null_driver.cpp), and stores N % 8
+    uint32_t const commandVariants = 8;
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(physical, &properties);
+    bool const nullDriver = strcmp(properties.deviceName, "Null Device") == 0;
+    if (!nullDriver) {
+        std::cout << "Not running on the null ICD, so only unsupported commands are resolved\n";
+    }
+
+    // MAX_NUM_UNKNOWN_EXTS in loader/loader.h
+    uint32_t const trampolineCount = 250;
+    uint32_t const nameCount = 4096;
+    uint32_t const supportedCount = 2 * trampolineCount;
+    uint32_t const threadCount = 4;
+    std::vector<std::string> names(nameCount);
+    std::vector<bool> supported(nameCount);
+    for (uint32_t i = 0; i < nameCount; ++i) {
+        // Every eighth name is supported, so that supported and unsupported names are added between each other
+        supported[i] = i % 8 == 0 && i / 8 < supportedCount;
+        names[i] = supported[i] ? "vkNullTestDeviceCommand" + std::to_string(i / 8)
+                                : "vkLoaderStressTestCommand" + std::to_string(i) + "EXT";
+    }
+
+    typedef void(VKAPI_PTR * PFN_TestDeviceCommand)(VkDevice, uint32_t *);
+    std::vector<std::vector<PFN_vkVoidFunction>> resolved(threadCount, std::vector<PFN_vkVoidFunction>(nameCount));
+    std::vector<std::vector<uint32_t>> called(threadCount, std::vector<uint32_t>(nameCount, commandVariants));
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < threadCount; ++thread) {
+        threads.emplace_back([&, thread]() {
+            // Start pairs of threads at the same name, and each pair at a different one, so that they race to add the
+            // same names both as they are first seen and as they are found again
+            for (uint32_t i = 0; i < nameCount; ++i) {
+                uint32_t const name = (i + thread / 2 * 2 * nameCount / threadCount) % nameCount;
+                resolved[thread][name] = vkGetInstanceProcAddr(instance, names[name].c_str());
+                // Call it right away, while other threads may still be adding it, which catches a trampoline that is
+                // handed out before the device's dispatch table has it
+                if (nullDriver && resolved[thread][name] != nullptr) {
+                    reinterpret_cast<PFN_TestDeviceCommand>(resolved[thread][name])(device, &called[thread][name]);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    auto const start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < nameCount; ++i) {
+        EXPECT_EQ(vkGetInstanceProcAddr(instance, names[i].c_str()), resolved[0][i]) << names[i];
+    }
+    auto const end = std::chrono::steady_clock::now();
+    std::cout << "vkGetInstanceProcAddr: " << std::chrono::duration<double, std::nano>(end - start).count() / nameCount
+              << " ns per previously seen unknown command\n";
+
+    std::vector<PFN_vkVoidFunction> trampolines;
+    for (uint32_t i = 0; i < nameCount; ++i) {
+        for (uint32_t thread = 1; thread < threadCount; ++thread) {
+            EXPECT_EQ(resolved[thread][i], resolved[0][i]) << names[i];
+        }
+        if (!supported[i] || !nullDriver) {
+            EXPECT_EQ(resolved[0][i], nullptr) << names[i];
+        } else if (resolved[0][i] != nullptr) {
+            trampolines.push_back(resolved[0][i]);
+
+            // The trampoline was handed out after the device was created, so it has to have been set up for it
+            for (uint32_t thread = 0; thread < threadCount; ++thread) {
+                EXPECT_EQ(called[thread][i], i / 8 % commandVariants) << names[i];
+            }
+        }
+    }
+    if (nullDriver) {
+        // The names that came too late for a trampoline resolve to NULL
+        EXPECT_EQ(trampolines.size(), trampolineCount);
+    }
+    std::sort(trampolines.begin(), trampolines.end());
+    EXPECT_EQ(std::adjacent_find(trampolines.begin(), trampolines.end()), trampolines.end());
+
+    vkDestroyDevice(device, nullptr);
+    vkDestroyInstance(instance, nullptr);
+}
+
+// Create and destroy instances and devices with object_tracker enabled on several threads at once, and make calls on
+// them in between. Each call looks up the layer's data for its instance or device while other threads add and remove
+// theirs, which used to crash object_tracker.
+TEST(LayerData, ConcurrentInstancesAndDevices) {
+    char const *const layers[] = {"VK_LAYER_LUNARG_object_tracker"};  // Temporary required due to MSVC bug.
+    uint32_t const threadCount = 4;
+    uint32_t const iterations = 25;
+
+    std::vector<uint32_t> completed(threadCount);
+    std::vector<std::thread> threads;
+    for (uint32_t thread = 0; thread < threadCount; ++thread) {
+        threads.emplace_back([&, thread]() {
+            for (uint32_t i = 0; i < iterations; ++i) {
+                VkInstance instance = VK_NULL_HANDLE;
+                if (vkCreateInstance(VK::InstanceCreateInfo().enabledLayerCount(1).ppEnabledLayerNames(layers), nullptr,
+                                     &instance) != VK_SUCCESS) {
+                    return;
+                }
+
+                uint32_t physicalCount = 1;
+                VkPhysicalDevice physical = VK_NULL_HANDLE;
+                VkResult result = vkEnumeratePhysicalDevices(instance, &physicalCount, &physical);
+                if ((result != VK_SUCCESS && result != VK_INCOMPLETE) || physicalCount != 1) {
+                    vkDestroyInstance(instance, nullptr);
+                    return;
+                }
+                VkPhysicalDeviceProperties properties;
+                vkGetPhysicalDeviceProperties(physical, &properties);
+
+                float const priorities[] = {0.0f};
+                VkDeviceQueueCreateInfo const queueInfo[1]{
+                    VK::DeviceQueueCreateInfo().queueFamilyIndex(0).queueCount(1).pQueuePriorities(priorities)};
+                VkDevice device = VK_NULL_HANDLE;
+                if (vkCreateDevice(physical, VK::DeviceCreateInfo().queueCreateInfoCount(1).pQueueCreateInfos(queueInfo),
+                                   nullptr, &device) != VK_SUCCESS) {
+                    vkDestroyInstance(instance, nullptr);
+                    return;
+                }
+
+                VkQueue queue = VK_NULL_HANDLE;
+                vkGetDeviceQueue(device, 0, 0, &queue);
+                VkFenceCreateInfo const fenceInfo = {VK_STRUCTURE_TYPE_FENCE_CREATE_INFO, nullptr, 0};
+                for (uint32_t j = 0; j < 8; ++j) {
+                    VkFence fence = VK_NULL_HANDLE;
+                    if (vkCreateFence(device, &fenceInfo, nullptr, &fence) == VK_SUCCESS) {
+                        vkDestroyFence(device, fence, nullptr);
+                    }
+                }
+                vkDeviceWaitIdle(device);
+
+                vkDestroyDevice(device, nullptr);
+                vkDestroyInstance(instance, nullptr);
+                ++completed[thread];
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (uint32_t thread = 0; thread < threadCount; ++thread) {
+        EXPECT_EQ(completed[thread], iterations) << "thread " << thread;
+    }
+}
+
 TEST_F(ImplicitLayer, Present) {
     auto const info = VK::InstanceCreateInfo();
     VkInstance instance = VK_NULL_HANDLE;
@@ -978,6 +1388,38 @@ TEST(Allocation, Instance) {
     FreeAllocTracker();
 }
 
+// Test that the instance arena cuts the number of allocations vkCreateInstance makes, and that
+// everything is still freed by vkDestroyInstance.
+TEST(Allocation, InstanceArena) {
+    auto const info = VK::InstanceCreateInfo();
+    VkAllocationCallbacks alloc_callbacks = {};
+    alloc_callbacks.pUserData = (void *)0x00000003;
+    alloc_callbacks.pfnAllocation = CountingAllocCallbackFunc;
+    alloc_callbacks.pfnReallocation = CountingReallocCallbackFunc;
+    alloc_callbacks.pfnFree = FreeCallbackFunc;
+
+    uint32_t allocation_calls[2] = {};
+    for (uint32_t arena = 0; arena < 2; ++arena) {
+        SetLoaderEnvironment("VK_LOADER_DISABLE_INSTANCE_ARENA", arena ? nullptr : "1");
+        InitAllocTracker(4096);
+        g_allocation_calls = 0;
+
+        VkInstance instance = VK_NULL_HANDLE;
+        VkResult result = vkCreateInstance(info, &alloc_callbacks, &instance);
+        allocation_calls[arena] = g_allocation_calls;
+        SetLoaderEnvironment("VK_LOADER_DISABLE_INSTANCE_ARENA", nullptr);
+        ASSERT_EQ(result, VK_SUCCESS);
+
+        vkDestroyInstance(instance, &alloc_callbacks);
+        ASSERT_EQ(true, IsAllocTrackerEmpty());
+        FreeAllocTracker();
+    }
+
+    std::cout << "vkCreateInstance: " << allocation_calls[0] << " allocations without the instance arena, "
+              << allocation_calls[1] << " with it\n";
+    EXPECT_LT(allocation_calls[1], allocation_calls[0]);
+}
+
 // Test making sure the allocation functions are called to allocate and cleanup everything during
 // a CreateInstance/DestroyInstance call pair with a call to GetInstanceProcAddr.
 TEST(Allocation, GetInstanceProcAddr) {
@@ -1640,6 +2082,119 @@ TEST(EnumeratePhysicalDeviceGroupsKHX, TwoCallIncomplete) {
     vkDestroyInstance(instance, nullptr);
 }
 
+// Compares the trees of cJSON_Parse and cJSON_ParseInSitu, which the loader parses manifests with.
+static void ExpectSameJson(cJSON const *expected, cJSON const *actual, std::string const &path) {
+    ASSERT_TRUE(expected != nullptr && actual != nullptr) << path;
+    EXPECT_EQ(expected->type & 0xFF, actual->type & 0xFF) << path;
+    EXPECT_EQ(expected->string == nullptr, actual->string == nullptr) << path;
+    if (expected->string && actual->string) {
+        EXPECT_STREQ(expected->string, actual->string) << path;
+    }
+    EXPECT_EQ(expected->valuestring == nullptr, actual->valuestring == nullptr) << path;
+    if (expected->valuestring && actual->valuestring) {
+        EXPECT_STREQ(expected->valuestring, actual->valuestring) << path;
+    }
+    EXPECT_EQ(expected->valueint, actual->valueint) << path;
+    if (expected->valuedouble == expected->valuedouble) {
+        EXPECT_EQ(expected->valuedouble, actual->valuedouble) << path;
+    }
+
+    cJSON const *expected_child = expected->child;
+    cJSON const *actual_child = actual->child;
+    for (int i = 0; expected_child && actual_child; i++) {
+        ExpectSameJson(expected_child, actual_child, path + "/" + std::to_string(i));
+        expected_child = expected_child->next;
+        actual_child = actual_child->next;
+    }
+    EXPECT_EQ(expected_child == nullptr, actual_child == nullptr) << path;
+}
+
+// Parses text both ways and checks that they agree on whether it is valid and on the tree.
+static void ExpectSameParse(std::string const &text, std::string const &description) {
+    // cJSON_Parse reads past the end of the text when it ends inside an escape sequence; cJSON_ParseInSitu
+    // rejects such text instead, so there is nothing to compare.
+    size_t last_backslash = text.rfind('\\');
+    if (last_backslash != std::string::npos && text.size() - last_backslash <= 12) {
+        return;
+    }
+
+    cJSON *expected = cJSON_Parse(text.c_str());
+    std::vector<char> buffer(text.begin(), text.end());
+    buffer.push_back('\0');
+    cJSON *actual = cJSON_ParseInSitu(buffer.data());
+
+    EXPECT_EQ(expected != nullptr, actual != nullptr) << description << ": " << text;
+    if (expected && actual) {
+        ExpectSameJson(expected, actual, description);
+    }
+    cJSON_Delete(expected);
+    cJSON_DeleteInSitu(actual);
+}
+
+static std::string ReadManifest(char const *filename) {
+    std::ifstream file(filename, std::ios::binary);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+// Every manifest in the repository parses the same way.
+TEST(ManifestJson, InSituMatchesParse) {
+    for (char const *filename : loader_test_manifests) {
+        std::string const text = ReadManifest(filename);
+        ASSERT_FALSE(text.empty()) << filename;
+        cJSON *expected = cJSON_Parse(text.c_str());
+        ASSERT_TRUE(expected != nullptr) << filename;
+        cJSON_Delete(expected);
+        ExpectSameParse(text, filename);
+    }
+}
+
+// Truncated and corrupted manifests are accepted or rejected the same way, and accepted ones give the same tree.
+TEST(ManifestJson, InSituMatchesParseOnDamagedManifests) {
+    static char const replacements[] = {'"', '\\', '{', '}', '[', ']', ',', ':', ' ', '0', '-', 'e', '.', 'n', 'u', 'x', '\x01'};
+    for (char const *filename : loader_test_manifests) {
+        std::string const text = ReadManifest(filename);
+        for (size_t length = 0; length < text.size(); length++) {
+            ExpectSameParse(text.substr(0, length), std::string(filename) + " truncated to " + std::to_string(length));
+        }
+        for (size_t offset = 0; offset < text.size(); offset++) {
+            for (char const replacement : replacements) {
+                std::string damaged = text;
+                damaged[offset] = replacement;
+                ExpectSameParse(damaged, std::string(filename) + " with a replaced character at " + std::to_string(offset));
+            }
+        }
+    }
+}
+
+// Escapes, numbers and literals that the manifests don't use.
+TEST(ManifestJson, InSituMatchesParseOnEscapesAndNumbers) {
+    static char const *const texts[] = {
+        "\"plain\"",
+        "{\"a\\tb\": \"c\\\"d\\\\e\\/f\\b\\f\\n\\r\"}",
+        "[\"\\u0041\\u00e9\\u20ac\\ud83d\\ude00\", \"tail\"]",
+        "[\"\\ud83d\", \"lone high surrogate\"]",
+        "[\"\\ud83d\\u0041\", \"bad low surrogate\"]",
+        "[\"\\ude00\\u0000\", \"invalid code points\"]",
+        "[\"\\uZZZZ\", \"bad hex\"]",
+        "[\"\\q\", \"unknown escape\"]",
+        "[0, -0, 1.5, -2.25e3, 1E+2, 5e-1, 0123, 1., -, 3e]",
+        "[true, false, null, truex]",
+        "{\"nested\": {\"deeper\": [[[]], {}]}}",
+        "  {\"a\": 1} trailing text",
+        "\"unterminated",
+        "{\"a\" 1}",
+        "{\"a\": 1,}",
+        "[1 2]",
+        "",
+        "   ",
+    };
+    for (char const *text : texts) {
+        ExpectSameParse(text, text);
+    }
+}
+
 int main(int argc, char **argv) {
     int result;
 